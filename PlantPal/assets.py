@@ -0,0 +1,38 @@
+# Adds the uploadassets target: packs the artwork with tools/omegaAssetPack.py
+# and writes it into the assets partition without touching the app.
+Import("env")
+
+import csv
+import os
+
+project = env.subst("$PROJECT_DIR")
+root = os.path.dirname(project)
+pack = os.path.join(env.subst("$BUILD_DIR"), "assets.bin")
+
+
+def partition(name):
+    with open(os.path.join(project, "partitions.csv")) as f:
+        for row in csv.reader(line for line in f if not line.startswith("#")):
+            if row and row[0].strip() == name:
+                return row[3].strip(), row[4].strip()
+    raise ValueError("no %s partition in partitions.csv" % name)
+
+
+offset, size = partition("assets")
+
+env.AddCustomTarget(
+    name="uploadassets",
+    dependencies=None,
+    actions=[
+        '"$PYTHONEXE" "%s" --images "%s" --font "%s" --font "%s" --partition-size %s -o "%s"' % (
+            os.path.join(root, "tools", "omegaAssetPack.py"),
+            os.path.join(root, "assets", "omegaIcons.h"),
+            os.path.join(root, "lib", "omegaMenu", "NotoSansBold15.h"),
+            os.path.join(root, "lib", "omegaMenu", "NotoSansMonoSCB20.h"),
+            size, pack),
+        env.VerboseAction(env.AutodetectUploadPort, "Looking for upload port..."),
+        '"$PYTHONEXE" "$UPLOADER" --chip $BOARD_MCU --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED write_flash %s "%s"' % (
+            offset, pack),
+    ],
+    title="Upload assets",
+    description="Pack icons and fonts and write them into the assets partition")
@@ -0,0 +1,30 @@
+#ifndef ASSET_MANAGER_H
+#define ASSET_MANAGER_H
+
+#include <omegaTFT.h>
+
+#ifdef OMEGA_ASSET_PACK
+// Icons and fonts come from the assets partition, see tools/omegaAssetPack.py.
+// Flash it with: pio run -e c3_assets -t uploadassets
+omegaAssets assets;
+const uint8_t* NotoSansMonoSCB20 = nullptr; // Missing fonts fall back to the built in font
+const uint8_t* NotoSansBold15 = nullptr;
+
+void setup_assets() {
+  if (!assets.begin()) {
+    Serial.println("Asset partition missing, flash assets.bin");
+    return;
+  }
+  uint8_t missing = loadIcons(assets);
+  if (missing) Serial.printf("%u icons missing from the asset pack\n", missing);
+  NotoSansMonoSCB20 = assets.font("NotoSansMonoSCB20");
+  NotoSansBold15 = assets.font("NotoSansBold15");
+}
+#else
+#include "NotoSansMonoSCB20.h"
+#include "NotoSansBold15.h"
+
+void setup_assets() {}
+#endif
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef BLE_MANAGER_H
+#define BLE_MANAGER_H
+
+#include <Arduino.h>
+#include <omegaPlant.h>
+#include <omegaBLEScanner.h>
+#include "plantTable.h"
+#include "mqttManager.h"
+#include "linkManager.h"
+
+#define BLE_SCAN_MODE BLE_SCAN_BALANCED // BLE_SCAN_LOW_LATENCY hears pots sooner, BLE_SCAN_LOW_POWER saves the radio
+
+omegaBLEScanner bleScanner; // Pots that beacon their samples instead of connecting
+
+// Runs in the Bluetooth task once per new sample
+void onBeacon(const uint8_t* mac, int8_t rssi, const bleBeaconData& beacon, void* ctx) {
+  handlePlantFrame(plantFrame::of<plantStateSchema>(NOW_SENSOR, beacon.state.plantID, beacon.state));
+}
+
+// Call after plants.begin()
+void setup_ble() {
+  bleScanner.onBeacon(onBeacon);
+  bleScanner.setMode(BLE_SCAN_MODE);
+  if (!bleScanner.begin()) {
+    Serial.println("BLE scanner failed");
+  }
+}
+#endif
@@ -0,0 +1,109 @@
+#ifndef LINK_MANAGER_H
+#define LINK_MANAGER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <omegaPlant.h>
+#include <omegaSchema.h>
+#include <omegaPlantLink.h>
+#include <omegaGateway.h>
+#include "plantTable.h"
+#include "mqttManager.h"
+
+#define GATEWAY_DEVICE_PREFIX 'D'
+
+omegaMqttGateway gateway(client); // Pots heard over ESP-NOW or BLE reach the broker through this connection
+char gateway_topic[TOPIC_PLANT_LEN];
+uint16_t gatewayID;
+StaticJsonDocument<GATEWAY_JSON_SIZE> batchDoc; // Only used by the MQTT callback
+
+// Store one sample taken ageSec ago, call with the plant table locked
+void storeSample(const plantState& state, uint16_t ageSec = 0) {
+  plantEntry* entry = plants.findOrCreate(state.plantID, curProfile);
+  if (!entry) return;
+
+  sensorDataPacket sample;
+  toPacket(state, sample);
+  plants.pushSample(entry, sample, ageSec);
+}
+
+// Binary frames from any radio, runs in that radio's task
+void handlePlantFrame(const plantFrame& frame) {
+  if (frame.type == NOW_SENSOR) {
+    plantState state;
+    if (!plantStateSchema::fromBinary(frame.payload, frame.len, state)) return;
+    state.plantID = frame.src;
+    gateway.push(state);
+
+    if (!plants.lock()) return;
+    storeSample(state);
+    plants.unlock();
+  }
+  else if (frame.type == NOW_BATCH) {
+    // Records may belong to different plants, each carries its own id
+    nowBatchReader batch(frame.payload, frame.len);
+    if (!batch.valid()) return;
+
+    plantState state;
+    uint16_t ageSec;
+    if (!plants.lock()) return;
+    while (batch.next(state, ageSec)) {
+      if (state.plantID == 0) state.plantID = frame.src;
+      gateway.push(state, ageSec);
+      storeSample(state, ageSec);
+    }
+    plants.unlock();
+  }
+  else if (frame.type == NOW_PROFILE) {
+    PlantProfile profile;
+    if (!PlantProfileSchema::fromBinary(frame.payload, frame.len, profile)) return;
+    gateway.pushProfile(frame.src, profile);
+
+    if (!plants.lock()) return;
+    plantEntry* entry = plants.findOrCreate(frame.src, curProfile);
+    if (entry) entry->profile.write(profile);
+    plants.unlock();
+  }
+  else if (frame.type == NOW_STATE) {
+    // Sent on level up, the display only needs what the plant can wear
+    PlantSaveData save;
+    if (!PlantSaveDataSchema::fromBinary(frame.payload, frame.len, save)) return;
+    gateway.pushState(frame.src, save);
+
+    if (!plants.lock()) return;
+    plantEntry* entry = plants.findOrCreate(frame.src, curProfile);
+    if (entry) entry->unlocked = save.unlockedItems | save.unlockedBg | save.unlockedAvatar;
+    plants.unlock();
+  }
+}
+
+// Batch of another display's gateway, with the samples of pots only that display hears
+void onBatchMessage(const omegaTopicMatch& match, const uint8_t* payload, unsigned int length, void* ctx) {
+  uint16_t from;
+  if (!match.wildcardToID(0, from) || from == gatewayID) return; // Our own batch, stored when it was received
+  if (deserializeJson(batchDoc, payload, length)) return;
+
+  if (!plants.lock()) return;
+  for (JsonObjectConst obj : batchDoc["samples"].as<JsonArrayConst>()) {
+    plantState state = {};
+    plantStateSchema::fromJson(obj, state);
+    if (state.plantID) storeSample(state, obj["age"] | 0);
+  }
+  plants.unlock();
+}
+
+// Batches go to plantpal/<id>/batch, every display stores the batches of the others.
+// States and profiles go to the pot's own plantpal/<id>/state and /profile.
+void setup_gateway() {
+  uint8_t mac[6];
+  WiFi.macAddress(mac);
+  gatewayID = nowDeviceID(GATEWAY_DEVICE_PREFIX, mac);
+  snprintf(gateway_topic, sizeof(gateway_topic), TOPIC_PLANT_FORMAT, gatewayID, "batch");
+  if (!gateway.begin(gateway_topic)) {
+    Serial.println("Gateway failed");
+  }
+  // Receiving a full batch needs more than PubSubClient's default buffer
+  client.setBufferSize(GATEWAY_PAYLOAD_SIZE + TOPIC_PLANT_LEN + 8);
+  router.subscribe(batch_filter, onBatchMessage);
+}
+#endif
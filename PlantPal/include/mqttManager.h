@@ -6,6 +6,9 @@
 #include <PubSubClient.h>
 #include <ArduinoJson.h> // Include ArduinoJson library
 #include <omegaPlant.h>
+#include <omegaSchema.h>
+#include <omegaTopicRouter.h>
+#include "plantTable.h"
 
 #define ID 1
 uint8_t hi = (uint8_t)'P';
@@ -13,6 +16,7 @@ uint8_t counter = 1;
 uint16_t id = (hi << 8) | (counter & 0xFF);
 
 #define LED_PIN 15
+#define RECONNECT_INTERVAL 5000 // Milliseconds between MQTT connection attempts
 #define MQTT_PASSWORD "49937025" // Define the MQTT password here
 
 const char *ssid = "OMEGA";  // Replace with your Wi-Fi SSID
@@ -24,28 +28,21 @@ const char * friendly_name = "PlantPalF0";
 
 
 const char *alive_topic = "plantpal/alive";
-const char *sensor_topic = "plantpal/sensor";
+const char *sensor_topic = "plantpal/sensor"; // Legacy shared topics, id in payload
 const char *config_topic = "plantpal/config";
+const char *sensor_filter = "plantpal/+/sensor"; // Per-device topics, id in topic
+const char *config_filter = "plantpal/+/config";
+const char *batch_filter = "plantpal/+/batch"; // Samples other displays republish for their pots
+
+omegaTopicRouter router;
 
 WiFiClient espClient;
 PubSubClient client(espClient);
 
 
 
-typedef struct sensorDataPacket{
-    uint16_t id;
-    uint8_t tempc;
-    uint8_t hum;
-    uint8_t light;
-    uint8_t moist;
-    uint8_t xp;
-    uint8_t mood;
-    uint8_t emotion;
-};
-
-sensorDataPacket curData;
-PlantProfile curProfile;
-PlantSaveData curSave;
+PlantProfile curProfile; // Profile given to newly discovered pots
+plantTable plants;
 
 void setup_wifi() {
 
@@ -73,28 +70,30 @@ void setup_wifi() {
   }
 }
 
+unsigned long lastReconnectTime = 0;
+
+// One connection attempt per RECONNECT_INTERVAL, returns right away in between
+// so the caller's loop keeps serving ESP-NOW while the broker is unreachable
 void reconnect() {
-  // Loop until we're reconnected
-  while (!client.connected()) {
-    Serial.print("Attempting MQTT connection...");
-    // Attempt to connect
-    if (client.connect(friendly_name, mqtt_user, mqtt_pass)) {
-      Serial.println("connected");
-      vTaskDelay(100);
-      // Once connected, publish an "alive" message
-      client.publish(alive_topic, friendly_name);
-      // Subscribe to the configuration topic
-      client.subscribe(config_topic);
-      client.subscribe(sensor_topic);
-
-    } else {
-      Serial.print("failed, rc=");
-      Serial.print(client.state());
-      Serial.println(" try again in 5 seconds");
-      // Wait 5 seconds before retrying
-      vTaskDelay(5000);
-    }
-    
+  if (client.connected() || millis() - lastReconnectTime < RECONNECT_INTERVAL) return;
+  lastReconnectTime = millis();
+
+  Serial.print("Attempting MQTT connection...");
+  // Attempt to connect
+  if (client.connect(friendly_name, mqtt_user, mqtt_pass)) {
+    Serial.println("connected");
+    // Once connected, publish an "alive" message
+    client.publish(alive_topic, friendly_name);
+    // Subscribe to the configuration topic
+    client.subscribe(config_topic);
+    client.subscribe(sensor_topic);
+    client.subscribe(config_filter);
+    client.subscribe(sensor_filter);
+    client.subscribe(batch_filter);
+  } else {
+    Serial.print("failed, rc=");
+    Serial.print(client.state());
+    Serial.println(" try again in 5 seconds");
   }
 }
 
@@ -119,6 +118,68 @@ void publishSensorData() {
   client.publish(sensor_topic, jsonBuffer);
 }
 
+/**
+ * @brief Parse a JSON payload, the id comes from the topic or the payload
+ * @return True if the payload is valid and an id was found
+ */
+bool parseMessage(const omegaTopicMatch& match, const uint8_t* payload, unsigned int length,
+                  JsonDocument& doc, uint16_t& plantID) {
+  DeserializationError error = deserializeJson(doc, payload, length);
+  if (error) {
+    Serial.print("deserializeJson() failed: ");
+    Serial.println(error.f_str());
+    return false;
+  }
+
+  if (match.wildcardToID(0, plantID)) return true;
+  if (!doc.containsKey("id")) return false;
+  plantID = doc["id"].as<uint16_t>();
+  return true;
+}
+
+void onSensorMessage(const omegaTopicMatch& match, const uint8_t* payload, unsigned int length, void* ctx) {
+  StaticJsonDocument<256> doc;
+  uint16_t plantID;
+  if (!parseMessage(match, payload, length, doc, plantID)) return;
+
+  if (!plants.lock()) return;
+  plantEntry* entry = plants.findOrCreate(plantID, curProfile);
+  if (entry) {
+    // Sensor messages may only carry the changed fields, merge them
+    plantState state;
+    toState(entry->sample.read(), state);
+    plantStateSchema::fromJson(doc.as<JsonObjectConst>(), state);
+    state.plantID = plantID;
+
+    sensorDataPacket sample;
+    toPacket(state, sample);
+    plants.pushSample(entry, sample);
+  }
+  plants.unlock();
+}
+
+void onConfigMessage(const omegaTopicMatch& match, const uint8_t* payload, unsigned int length, void* ctx) {
+  StaticJsonDocument<256> doc;
+  uint16_t plantID;
+  if (!parseMessage(match, payload, length, doc, plantID)) return;
+
+  if (!plants.lock()) return;
+  plantEntry* entry = plants.findOrCreate(plantID, curProfile);
+  if (entry) {
+    PlantProfile profile = entry->profile.read();
+    PlantProfileSchema::fromJson(doc.as<JsonObjectConst>(), profile);
+    entry->profile.write(profile);
+  }
+  plants.unlock();
+}
+
+void setup_router() {
+  router.subscribe(sensor_filter, onSensorMessage);
+  router.subscribe(sensor_topic, onSensorMessage);
+  router.subscribe(config_filter, onConfigMessage);
+  router.subscribe(config_topic, onConfigMessage);
+}
+
 void callback(char* topic, byte* payload, unsigned int length) {
 
   Serial.print("Message arrived [");
@@ -129,51 +190,7 @@ void callback(char* topic, byte* payload, unsigned int length) {
   }
   Serial.println();
   Serial.println();
-  // Handle the configuration message if needed
- StaticJsonDocument<256> doc;
-        DeserializationError error = deserializeJson(doc, payload, length);
-        if (error) {
-            Serial.print("deserializeJson() failed: ");
-            Serial.println(error.f_str());
-            return;
-        }
-
-        // Example: Extract values from the parsed JSON document
-        if (doc.containsKey("id")) {
-          
-          if(String(sensor_topic) == String(topic)){
-            
-            curData.id = doc["id"].as<uint16_t>();
-            curData.tempc = doc["tempc"].as<uint8_t>();
-            curData.hum = doc["hum"].as<uint8_t>();  
-            curData.moist = doc["soilm"].as<uint8_t>();
-            curData.light = doc["light"].as<uint8_t>();
-            curData.xp = doc["xp"].as<uint8_t>();
-            curData.mood = doc["mood"].as<uint8_t>();
-            curData.emotion = doc["emotion"].as<uint8_t>();
-          }
-          
-          if(String(config_topic) == String(topic)){
-            
-            curData.id = doc["id"].as<uint16_t>();
-            //curProfile.name = doc["name"].as<const char>();
-            curProfile.tempc = doc["tempc"].as<uint8_t>();
-            curProfile.hum = doc["hum"].as<uint8_t>();
-            curProfile.soil_moisture = doc["soil_moisture"].as<uint8_t>();
-            
-            curProfile.light = doc["light"].as<uint8_t>();
-            curProfile.range_temp = doc["range_temp"].as<uint8_t>();
-            curProfile.range_hum = doc["range_hum"].as<uint8_t>();
-            curProfile.range_light = doc["range_light"].as<uint8_t>();
-            curProfile.range_soil_moisture = doc["range_soil_moisture"].as<uint8_t>();
-
-          }
-          
-
-        }
-
-
-
 
+  router.dispatch(topic, payload, length);
 }
 #endif
\ No newline at end of file
@@ -9,13 +9,16 @@
 #include <algorithm> // Include for std::clamp
 
 #include <omegaTFT.h>
+#include <omegaAnimation.h>
+#include <omegaAvatar.h>
+#include <omegaGauge.h>
 #include <omegaWireless.h>
 #include <omegaNOW.h>
 #include <omegaPlant.h>
 
-#include "NotoSansMonoSCB20.h"
-#include "NotoSansBold15.h"
+#include "assetManager.h"
 #include "mqttManager.h"
+#include "nowManager.h"
 
 volatile int gyroy = 0;
 volatile int gyrop = 0;
@@ -27,13 +30,17 @@ PlantProfile newProfile;
 
 omegaPlant myPlant = omegaPlant(newProfile);
 
-extern sensorDataPacket curData;
-extern PlantSaveData curSave;
  bool espNowActive= false;
 
 TFT_eSPI tft =TFT_eSPI();  // Create object "tft"
 TFT_eSprite menuSprite(&tft);
 
+// Plant screen gauges, drawn once and then updated by the sector that changed
+#define GAUGE_TRACK_COLOR 0x2104
+omegaArcGauge valueGauges[4] = {&tft, &tft, &tft, &tft}; // Light, temperature, humidity, soil
+omegaArcGauge moodGauge(&tft);
+omegaArcGauge xpGauge(&tft);
+
 struct Arc {
     int cx;
     int cy;
@@ -90,23 +97,11 @@ std::vector<MacAddress> getConnectedMacAddresses() {
   return macAddresses;
 }
 
-// Function to animate the avatar on the display
-void animateAvatar(TFT_eSPI* tft, TFT_eSprite* avatarSprite, uint8_t frame) {
-    TFT_eSprite itemSprite = TFT_eSprite(tft);
-    itemSprite.createSprite(50, 10);
-    itemSprite.pushImage(0, 0, 50, 10, icon_sunglasses);
-
-    if (frame > 3) return; // Exit if the frame is out of the valid range
-
-    uint8_t avatarInt = curData.hum % 3;
-    avatarSprite->pushImage(0, 0, 120, 120, plantArray[avatarInt]);
-    itemSprite.pushToSprite(avatarSprite, 40 + frame * 4, 30 - frame * 3, 0);
-}
-
-// Function to create an arc with given properties
-void createArc(TFT_eSprite* arcSprite, Arc arcData) {
+// Function to create an arc with given properties, the gauge caches the arc itself
+void createArc(TFT_eSprite* arcSprite, omegaArcGauge* gauge, Arc arcData) {
     arcSprite->fillScreen(0);
-    arcSprite->drawSmoothArc(16, 16, arcData.radius, arcData.width, arcData.startAngle, arcData.endAngle+1, arcData.color, TFT_TRANSPARENT, true);
+    gauge->setAngle(arcData.endAngle + 1);
+    gauge->push(arcSprite);
     arcSprite->drawFastVLine(16, 0, 7, TFT_WHITE);
     arcSprite->setCursor(5, 28);
     arcSprite->setTextColor(arcData.color);
@@ -137,35 +132,102 @@ void calculate_arc_positions(Arc arcs[], int numArcs) {
     }
 }
 
-// Function to draw the home screen, including updating various sprites and animations
-bool drawHomeScreen(TFT_eSPI* tft, TFT_eSprite* mainSprite) {
-    static int frameCounter = 0;
-    static bool spritesInitialized = false;
-    static uint8_t animationIndex = 0;
-    static TFT_eSprite txtSprite = TFT_eSprite(tft);
-    static TFT_eSprite avatarSprite = TFT_eSprite(tft);
-    static TFT_eSprite arcSprite = TFT_eSprite(tft);
-    static TFT_eSprite iconSprite = TFT_eSprite(tft);
+// Avatar scene of the plant screen, one cycle per plant while the home screen cycles
+#define PLANT_SCENE_MS 4000
+#define PLANT_REDRAW_GAP 250 // Longer pauses mean another menu drew on the display
+
+const animKey avatarKeys[] = {{0, 60, 60, 0, ANIM_STEP}};
+const animTrack avatarTrack = {avatarKeys, 1, 0};
+
+// The value dots make room for the thought bubble
+const animKey dotKeys[] = {
+    {0, 60, 60, 0, ANIM_STEP},
+    {2000, 60, 60, ANIM_HIDDEN, ANIM_STEP},
+    {3040, 60, 60, 0, ANIM_STEP}};
+const animTrack dotTrack = {dotKeys, 3, PLANT_SCENE_MS};
+
+const animKey bubbleKeys[] = {
+    {0, 18, 48, ANIM_HIDDEN, ANIM_STEP},
+    {2000, 18, 48, 1, ANIM_STEP},
+    {2240, 18, 48, 2, ANIM_STEP},
+    {2360, 18, 48, 3, ANIM_STEP},
+    {3040, 18, 48, ANIM_HIDDEN, ANIM_STEP}};
+const animTrack bubbleTrack = {bubbleKeys, 5, PLANT_SCENE_MS};
+
+const animKey thoughtKeys[] = {
+    {0, 20, 50, ANIM_HIDDEN, ANIM_STEP},
+    {2520, 20, 50, 0, ANIM_STEP},
+    {3040, 20, 50, ANIM_HIDDEN, ANIM_STEP}};
+const animTrack thoughtTrack = {thoughtKeys, 3, PLANT_SCENE_MS};
+
+const omegaPackedImage* const tooDarkSheet[] = {&icon_light};
+const omegaPackedImage* const tooColdSheet[] = {&icon_eye};
+
+// What the avatar can be composed of. Anchors of slots without artwork are estimates.
+const avatarBody avatarBodies[] = {
+    {0, &icon_Plant1, {{60, 8}, {65, 35}, {65, 48}, {60, 72}, {100, 60}}},
+    {ULCK_CACTUS1, &icon_cactus1, {{60, 8}, {65, 35}, {65, 48}, {60, 72}, {100, 60}}},
+    {ULCK_VASE1, &icon_vase_plant, {{60, 8}, {65, 35}, {65, 48}, {60, 72}, {100, 60}}}};
+
+// Plain colours until there is background artwork
+const avatarBackground avatarBackgrounds[] = {
+    {ULCK_BG1, nullptr, 0x0200},
+    {ULCK_BG2, nullptr, 0x0808}};
+
+const avatarItem avatarItems[] = {
+    {ULCK_SUNGLASSES, SLOT_FACE, &icon_sunglasses, {25, 5}},
+    {ULCK_GLASSES, SLOT_FACE, nullptr, {25, 5}},
+    {ULCK_BEARD, SLOT_CHIN, nullptr, {25, 0}},
+    {ULCK_TIE, SLOT_NECK, nullptr, {8, 0}},
+    {ULCK_TIE2, SLOT_NECK, nullptr, {8, 0}},
+    {ULCK_CROWN, SLOT_HEAD, nullptr, {20, 20}},
+    {ULCK_HAT, SLOT_HEAD, nullptr, {20, 20}},
+    {ULCK_BALOON, SLOT_HAND, nullptr, {10, 40}}};
+
+const avatarCatalog plantAvatars = {
+    avatarBodies, sizeof(avatarBodies) / sizeof(avatarBodies[0]),
+    avatarBackgrounds, sizeof(avatarBackgrounds) / sizeof(avatarBackgrounds[0]),
+    avatarItems, sizeof(avatarItems) / sizeof(avatarItems[0])};
+
+avatarOutfit equippedOutfit; // Everything on automatic: the last unlocked item of every slot
+
+// Avatar layer, pushes the composed avatar
+void drawAvatar(TFT_eSprite* sprite, int32_t x, int32_t y, uint8_t frame, void* ctx) {
+    ((omegaAvatarCompositor*)ctx)->push(sprite, x, y);
+}
 
-    if (!spritesInitialized) {
-        txtSprite.createSprite(180, 35);
-        txtSprite.loadFont(NotoSansBold15);
+// Colour dots of the four values, 66x106 box
+void drawValueDots(TFT_eSprite* sprite, int32_t x, int32_t y, uint8_t frame, void* ctx) {
+    sprite->fillCircle(x + 60, y + 100, 5, TFT_SILVER);
+    sprite->fillCircle(x + 60, y + 100, 4, COLOR_BROWN);
 
-        arcSprite.createSprite(34, 44);
-        arcSprite.loadFont(NotoSansBold15);
+    sprite->fillCircle(x + 20, y + 85, 5, TFT_SILVER);
+    sprite->fillCircle(x + 20, y + 85, 4, COLOR_PURPLE);
 
-        iconSprite.createSprite(40, 40);
-        avatarSprite.createSprite(120, 120, 1);
-        spritesInitialized = true;
-    }
+    sprite->fillCircle(x + 5, y + 45, 5, TFT_SILVER);
+    sprite->fillCircle(x + 5, y + 45, 4, COLOR_RED);
 
-    frameCounter = frameCounter % 100;
-    if (frameCounter < 20) animationIndex = 0;
-    else if (frameCounter < 21) animationIndex = 1;
-    else if (frameCounter < 23) animationIndex = 2;
-    else if (frameCounter < 25) animationIndex = 1;
-    else animationIndex = 0;
+    sprite->fillCircle(x + 25, y + 5, 5, TFT_SILVER);
+    sprite->fillCircle(x + 25, y + 5, 4, COLOR_YELLOW);
+}
 
+// Thought bubble growing out of the avatar, frames 1 to 3, 65x45 box
+void drawThoughtBubble(TFT_eSprite* sprite, int32_t x, int32_t y, uint8_t frame, void* ctx) {
+    sprite->fillCircle(x + 62, y + 38, 2, TFT_WHITE);
+    if (frame >= 2) sprite->fillCircle(x + 52, y + 32, 5, TFT_WHITE);
+    if (frame >= 3) sprite->fillCircle(x + 22, y + 22, 22, TFT_WHITE);
+}
+
+// Whether a background element at x, y, w, h reaches into area, nullptr stands for the whole screen
+bool inArea(const animRect* area, int16_t x, int16_t y, int16_t w, int16_t h) {
+    return !area || area->intersects(x, y, w, h);
+}
+
+// Everything on the plant screen that is not animated
+// area skips the elements outside of it, the viewport still clips the others
+void drawPlantBackground(TFT_eSprite* mainSprite, TFT_eSprite* txtSprite, TFT_eSprite* arcSprite,
+                         const sensorDataPacket& plant, const PlantProfile& profile,
+                         const animRect* area = nullptr) {
     uint16_t offset = 50;
     uint16_t startAngl = 45;
     uint16_t endAngl = 315;
@@ -173,15 +235,15 @@ bool drawHomeScreen(TFT_eSPI* tft, TFT_eSprite* mainSprite) {
     Arc valArcs[4];
     calculate_arc_positions(valArcs, 4);
 
-    uint8_t tempc = clamp<uint8_t>(curData.tempc,curProfile.tempc - curProfile.range_temp,curProfile.tempc + curProfile.range_temp);
-    uint8_t hum =   clamp<uint8_t>(curData.hum, (curProfile.hum - curProfile.range_hum),(curProfile.hum + curProfile.range_hum));
-    uint8_t light = clamp<uint8_t>(curData.light, (curProfile.light - curProfile.range_light),(curProfile.light + curProfile.range_light));
-    uint8_t moist = clamp<uint8_t>(curData.moist,(curProfile.soil_moisture - curProfile.range_soil_moisture), (curProfile.soil_moisture + curProfile.range_soil_moisture));
+    uint8_t tempc = clamp<uint8_t>(plant.tempc,profile.tempc - profile.range_temp,profile.tempc + profile.range_temp);
+    uint8_t hum =   clamp<uint8_t>(plant.hum, (profile.hum - profile.range_hum),(profile.hum + profile.range_hum));
+    uint8_t light = clamp<uint8_t>(plant.light, (profile.light - profile.range_light),(profile.light + profile.range_light));
+    uint8_t moist = clamp<uint8_t>(plant.moist,(profile.soil_moisture - profile.range_soil_moisture), (profile.soil_moisture + profile.range_soil_moisture));
 
-uint16_t tempc_angle = clamp<uint16_t>(map(tempc, (curProfile.tempc - curProfile.range_temp), (curProfile.tempc + curProfile.range_temp), startAngl, endAngl), startAngl, endAngl);
-uint16_t hum_angle = clamp<uint16_t>(map(hum, (curProfile.hum - curProfile.range_hum), (curProfile.hum + curProfile.range_hum), startAngl, endAngl), startAngl, endAngl);
-uint16_t light_angle = clamp<uint16_t>(map(light, (curProfile.light - curProfile.range_light), (curProfile.light + curProfile.range_light), startAngl, endAngl), startAngl, endAngl);
-uint16_t soil_angle = clamp<uint16_t>(map(moist, (curProfile.soil_moisture - curProfile.range_soil_moisture), (curProfile.soil_moisture + curProfile.range_soil_moisture), startAngl, endAngl), startAngl, endAngl);
+uint16_t tempc_angle = clamp<uint16_t>(map(tempc, (profile.tempc - profile.range_temp), (profile.tempc + profile.range_temp), startAngl, endAngl), startAngl, endAngl);
+uint16_t hum_angle = clamp<uint16_t>(map(hum, (profile.hum - profile.range_hum), (profile.hum + profile.range_hum), startAngl, endAngl), startAngl, endAngl);
+uint16_t light_angle = clamp<uint16_t>(map(light, (profile.light - profile.range_light), (profile.light + profile.range_light), startAngl, endAngl), startAngl, endAngl);
+uint16_t soil_angle = clamp<uint16_t>(map(moist, (profile.soil_moisture - profile.range_soil_moisture), (profile.soil_moisture + profile.range_soil_moisture), startAngl, endAngl), startAngl, endAngl);
 
 
     valArcs[0].endAngle = light_angle;
@@ -190,104 +252,191 @@ uint16_t soil_angle = clamp<uint16_t>(map(moist, (curProfile.soil_moisture - cur
     valArcs[3].endAngle = soil_angle;
 
 
-    valArcs[0].value = curData.light;
-    valArcs[1].value = curData.tempc;
-    valArcs[2].value = curData.hum;
-    valArcs[3].value = curData.moist;
+    valArcs[0].value = plant.light;
+    valArcs[1].value = plant.tempc;
+    valArcs[2].value = plant.hum;
+    valArcs[3].value = plant.moist;
 
     valArcs[0].color = COLOR_YELLOW;
     valArcs[1].color = COLOR_RED;
     valArcs[2].color = COLOR_PURPLE;
     valArcs[3].color = COLOR_BROWN;
 
-    mainSprite->setSwapBytes(1);
     mainSprite->fillScreen(0);
 
-    txtSprite.fillScreen(TFT_BLACK);
-    txtSprite.setCursor(0, 0);
-    txtSprite.setTextColor(TFT_WHITE);
-
-    uint8_t level = myPlant.calculateLevel(curData.xp);
-    uint8_t xp_progress = abs(curData.xp - (level - 1) * 2);
-
-    txtSprite.setTextColor(0x3F29);
-    txtSprite.printf("Mood\n  %d%%", curData.mood);
-    txtSprite.setSwapBytes(1);
-    txtSprite.setTextColor(TFT_WHITE);
-    txtSprite.pushToSprite(mainSprite, 155, 180);
-
-    txtSprite.fillScreen(0);
-    txtSprite.setTextColor(TFT_WHITE);
-    txtSprite.setCursor(0, 0);
-    txtSprite.setTextColor(TFT_SILVER);
-    txtSprite.printf("Level\n    %d\n", level);
-    txtSprite.pushToSprite(mainSprite, 180, 90);
-
-    txtSprite.fillScreen(0);
-    txtSprite.setTextColor(TFT_GOLD);
-    txtSprite.setCursor(0, 0);
-    txtSprite.printf(" %dXP", xp_progress);
-    txtSprite.pushToSprite(mainSprite, 180, 125);
-
-    uint16_t mood_angle = map(curData.mood, -1, 101, 360 - offset, 180 + offset);
+    uint8_t level = myPlant.calculateLevel(plant.xp);
+    uint8_t xp_progress = abs(plant.xp - (level - 1) * 2);
+
+    if (inArea(area, 155, 180, txtSprite->width(), txtSprite->height())) {
+        txtSprite->fillScreen(TFT_BLACK);
+        txtSprite->setCursor(0, 0);
+        txtSprite->setTextColor(0x3F29);
+        txtSprite->printf("Mood\n  %d%%", plant.mood);
+        txtSprite->pushToSprite(mainSprite, 155, 180);
+    }
+
+    if (inArea(area, 180, 90, txtSprite->width(), txtSprite->height())) {
+        txtSprite->fillScreen(0);
+        txtSprite->setCursor(0, 0);
+        txtSprite->setTextColor(TFT_SILVER);
+        txtSprite->printf("Level\n    %d\n", level);
+        txtSprite->pushToSprite(mainSprite, 180, 90);
+    }
+
+    if (inArea(area, 180, 125, txtSprite->width(), txtSprite->height())) {
+        txtSprite->fillScreen(0);
+        txtSprite->setTextColor(TFT_GOLD);
+        txtSprite->setCursor(0, 0);
+        txtSprite->printf(" %dXP", xp_progress);
+        txtSprite->pushToSprite(mainSprite, 180, 125);
+    }
+
+    uint16_t mood_angle = map(plant.mood, -1, 101, 360 - offset, 180 + offset);
     uint16_t xp_angle = map(xp_progress, 0, level * 2, 360 - offset, 180 + offset);
 
     mood_angle = clamp<uint16_t>(mood_angle, 180 + offset, (uint16_t)(360 - offset));
     xp_angle = clamp<uint16_t>(xp_angle, 180 + offset, (uint16_t)(360 - offset));
 
-    mainSprite->drawSmoothArc(120, 120, 118, 110, mood_angle-1, 360 - offset, 0x3F29, TFT_TRANSPARENT, true);
-    mainSprite->drawSmoothArc(120, 120, 106, 102, xp_angle-1, 360 - offset, TFT_GOLD, TFT_TRANSPARENT, true);
-    mainSprite->drawFastHLine(190, 120, 40, TFT_WHITE);
+    moodGauge.setAngle(mood_angle - 1);
+    if (inArea(area, moodGauge.x(), moodGauge.y(), moodGauge.width(), moodGauge.height())) moodGauge.push(mainSprite);
+    xpGauge.setAngle(xp_angle - 1);
+    if (inArea(area, xpGauge.x(), xpGauge.y(), xpGauge.width(), xpGauge.height())) xpGauge.push(mainSprite);
+    if (inArea(area, 190, 120, 40, 1)) mainSprite->drawFastHLine(190, 120, 40, TFT_WHITE);
 
-    int iPlant = (frameCounter / (100 / plantArrLen)) % plantArrLen;
-    mainSprite->setCursor(80, 10);
-    char msb = (char)((curData.id >> 8) & 0xFF);
-    char lsb = (char)(curData.id & 0xFF);
-    mainSprite->printf("Plant %c%d", msb, lsb);
-
-    animateAvatar(tft, &avatarSprite, animationIndex);
-    avatarSprite.pushToSprite(mainSprite, 60, 60, TFT_BLACK);
+    if (inArea(area, 80, 10, 160, 30)) {
+        mainSprite->setCursor(80, 10);
+        mainSprite->printf("Plant %04X", plant.id);
+    }
 
     for (int i = 0; i < 4; i++) {
-        createArc(&arcSprite, valArcs[i]);
-        arcSprite.pushToSprite(mainSprite, valArcs[i].cx - 16, valArcs[i].cy - 16);
+        if (!inArea(area, valArcs[i].cx - 16, valArcs[i].cy - 16, arcSprite->width(), arcSprite->height())) continue;
+        createArc(arcSprite, &valueGauges[i], valArcs[i]);
+        arcSprite->pushToSprite(mainSprite, valArcs[i].cx - 16, valArcs[i].cy - 16);
     }
+}
 
-    if (frameCounter < 50 || frameCounter > 75) {
-        mainSprite->fillCircle(120, 160, 5, TFT_SILVER);
-        mainSprite->fillCircle(120, 160, 4, COLOR_BROWN);
+// Function to draw the screen of one plant
+// pinned selects a plant table slot, -1 cycles through all known plants.
+// The background is only redrawn in full when the plant or its values
+// change, otherwise just the rects of the avatar layers that moved.
+bool drawPlantScreen(TFT_eSPI* tft, TFT_eSprite* mainSprite, int8_t pinned) {
+    static int8_t plantIndex = -1;
+    static int8_t lastPinned = -2;
+    static uint32_t shownAt = 0;
+    static uint32_t drawnAt = 0;
+    static bool spritesInitialized = false;
+    static sensorDataPacket lastPlant = {};
+    static PlantProfile lastProfile;
+    static TFT_eSprite txtSprite = TFT_eSprite(tft);
+    static TFT_eSprite arcSprite = TFT_eSprite(tft);
+    static omegaAvatarCompositor avatarCache(tft, plantAvatars);
+    static omegaAnimator scene;
+    static animLayer* avatar;
+    static animLayer* dots;
+    static animLayer* bubble;
+    static animLayer* thought;
 
-        mainSprite->fillCircle(80, 145, 5, TFT_SILVER);
-        mainSprite->fillCircle(80, 145, 4, COLOR_PURPLE);
+    if (!spritesInitialized) {
+        txtSprite.createSprite(180, 35);
+        txtSprite.loadFont(NotoSansBold15);
 
-        mainSprite->fillCircle(65, 105, 5, TFT_SILVER);
-        mainSprite->fillCircle(65, 105, 4, COLOR_RED);
+        arcSprite.createSprite(34, 44);
+        arcSprite.loadFont(NotoSansBold15);
 
-        mainSprite->fillCircle(85, 65, 5, TFT_SILVER);
-        mainSprite->fillCircle(85, 65, 4, COLOR_YELLOW);
-    } else {
-        if (curData.emotion > 0) {
-            mainSprite->fillCircle(80, 86, 2, TFT_WHITE);
-            if (frameCounter > 55) mainSprite->fillCircle(70, 80, 5, TFT_WHITE);
-            if (frameCounter > 58) mainSprite->fillCircle(40, 70, 22, TFT_WHITE);
-            if (frameCounter > 62) {
-              if(curData.emotion == TOO_DARK) 
-                iconSprite.pushImage(0, 0, 40, 40, icon_light);
-              if(curData.emotion == TOO_COLD) 
-                iconSprite.pushImage(0, 0, 40, 40, icon_eye);
+        // Same geometry as calculate_arc_positions, centred in arcSprite
+        const uint16_t valueColors[4] = {COLOR_YELLOW, COLOR_RED, COLOR_PURPLE, COLOR_BROWN};
+        for (uint8_t i = 0; i < 4; i++) valueGauges[i].begin(16, 16, 16, 14, 45, 316, GAUGE_TRACK_COLOR, valueColors[i]);
+        moodGauge.begin(120, 120, 118, 110, 229, 310, GAUGE_TRACK_COLOR, 0x3F29, true);
+        xpGauge.begin(120, 120, 106, 102, 229, 310, GAUGE_TRACK_COLOR, TFT_GOLD, true);
+
+        if (!avatarCache.begin(120, 120)) Serial.println("Avatar sprite failed");
+        avatar = scene.add();
+        avatar->setTrack(&avatarTrack);
+        avatar->setDraw(drawAvatar, 120, 120, &avatarCache);
+        dots = scene.add();
+        dots->setTrack(&dotTrack);
+        dots->setDraw(drawValueDots, 66, 106);
+        bubble = scene.add();
+        bubble->setTrack(&bubbleTrack);
+        bubble->setDraw(drawThoughtBubble, 65, 45);
+        thought = scene.add();
+        thought->setTrack(&thoughtTrack);
+        spritesInitialized = true;
+    }
 
+    uint32_t now = millis();
+    bool full = pinned != lastPinned || now - drawnAt > PLANT_REDRAW_GAP;
+    lastPinned = pinned;
+    drawnAt = now;
+
+    int8_t shown = plantIndex;
+    if (pinned >= 0) plantIndex = pinned;
+    else if (plantIndex < 0 || now - shownAt >= PLANT_SCENE_MS) plantIndex = plants.next(plantIndex);
+    if (plantIndex != shown || full) {
+        shownAt = now;
+        scene.start(now);
+        full = true;
+    }
 
-              iconSprite.pushToSprite(mainSprite, 20, 50, TFT_BLACK);
-            }
+    // Consistent copies of the followed plant, Wifi_Task may update it at any time
+    sensorDataPacket plant = {};
+    PlantProfile profile = curProfile;
+    plantEntry* entry = plantIndex >= 0 ? plants.at(plantIndex) : nullptr;
+    if (entry) {
+        entry->sample.read(plant);
+        entry->profile.read(profile);
+    }
+    if (memcmp(&plant, &lastPlant, sizeof(plant)) || memcmp(&profile, &lastProfile, sizeof(profile))) full = true;
+    lastPlant = plant;
+    lastProfile = profile;
+
+    // Composed again only when the plant unlocked something or wears something else
+    if (avatarCache.update(entry ? entry->unlocked : 0, equippedOutfit)) avatar->invalidate();
+    bubble->setVisible(plant.emotion > 0);
+    if (plant.emotion == TOO_DARK) thought->setSheet(tooDarkSheet, 1);
+    else if (plant.emotion == TOO_COLD) thought->setSheet(tooColdSheet, 1);
+    thought->setVisible(plant.emotion == TOO_DARK || plant.emotion == TOO_COLD);
+
+    uint8_t dirty = scene.update(now);
+
+    if (full) {
+        drawPlantBackground(mainSprite, &txtSprite, &arcSprite, plant, profile);
+        scene.draw(mainSprite);
+        mainSprite->pushSprite(0, 0);
+    } else if (dirty) {
+        // Background and layers again, once, clipped to the union of the rects that changed.
+        // Only the background elements inside it are drawn.
+        animRect r;
+        if (scene.dirtyBounds(r, mainSprite->width(), mainSprite->height())) {
+            mainSprite->setViewport(r.x, r.y, r.w, r.h, false);
+            drawPlantBackground(mainSprite, &txtSprite, &arcSprite, plant, profile, &r);
+            scene.draw(mainSprite);
+            mainSprite->resetViewport();
+            mainSprite->pushSprite(r.x, r.y, r.x, r.y, r.w, r.h);
         }
     }
-
-    mainSprite->pushSprite(0, 0);
-    frameCounter++;
+    scene.clean();
 
     return false; // Stay in the menu
 }
 
+bool drawHomeScreen(TFT_eSPI* tft, TFT_eSprite* mainSprite) {
+    return drawPlantScreen(tft, mainSprite, -1);
+}
+
+template <int8_t N>
+bool drawPlantN(TFT_eSPI* tft, TFT_eSprite* mainSprite) {
+    return drawPlantScreen(tft, mainSprite, N);
+}
+
+// One screen function per plant table slot
+const omegaTFT::externalFunction plantScreens[] = {
+    drawPlantN<0>, drawPlantN<1>, drawPlantN<2>, drawPlantN<3>,
+    drawPlantN<4>, drawPlantN<5>, drawPlantN<6>, drawPlantN<7>
+};
+static_assert(sizeof(plantScreens) / sizeof(plantScreens[0]) == PLANT_TABLE_SIZE, "One screen per plant slot");
+
+
 bool myFunc(TFT_eSPI* tft,TFT_eSprite * mainSprite)
 {
    
@@ -349,6 +498,45 @@ void sendData()
 
 }
 
+// Link quality of every paired pot: RSSI, hardware loss and ack latency
+bool drawPeerStats(TFT_eSPI* tft,TFT_eSprite * mainSprite)
+{
+  mainSprite->fillScreen(TFT_BLACK);
+  mainSprite->loadFont(NotoSansBold15);
+  mainSprite->setTextColor(TFT_GOLD);
+  mainSprite->setCursor(70, 30);
+  mainSprite->printf("ESP-NOW %d/%d", nowPeers.count(), NOW_MAX_PEERS);
+
+  // Receive rate over the last second, run a PotPal with NOW_FLOOD_TEST to find the limit
+  static uint32_t lastPushed = 0;
+  static uint32_t lastRateTime = 0;
+  static uint32_t rxRate = 0;
+  const nowRxQueue& rx = nowRadio.queue();
+  if (millis() - lastRateTime >= 1000) {
+    rxRate = (rx.pushed - lastPushed) * 1000 / (millis() - lastRateTime);
+    lastPushed = rx.pushed;
+    lastRateTime = millis();
+  }
+  mainSprite->setTextColor(TFT_SILVER);
+  mainSprite->setCursor(40, 48);
+  mainSprite->printf("rx %u/s drop %u max %u", rxRate, rx.dropped, rx.highWater);
+
+  mainSprite->setTextColor(TFT_WHITE);
+  nowPeer peer;
+  uint8_t row = 0;
+  for (uint8_t i = 0; i < NOW_MAX_PEERS && row < 7; i++) {
+    if (!nowPeers.get(i, peer)) continue;
+    mainSprite->setCursor(30, 70 + row * 18);
+    mainSprite->printf("%04X %ddBm %d%% %dms", peer.id,
+                       peer.stats.rssi, peer.stats.lossPercent(), peer.stats.latency);
+    row++;
+  }
+
+  mainSprite->pushSprite(0, 0);
+  mainSprite->loadFont(NotoSansMonoSCB20); // Menu font
+  return false; // Stay in the menu
+}
+
 bool restartESP(TFT_eSPI* tft,TFT_eSprite * mainSprite)
 {
   TFT_eSprite txtSprite = TFT_eSprite(tft);//120x120
@@ -386,12 +574,12 @@ std::vector<omegaTFT> macMenu(void)
   Serial.println("MACMENU");
 
   std::vector<omegaTFT> items;
-  items.push_back(omegaTFT(EXIT, "Back",icon_cross));
+  items.push_back(omegaTFT(EXIT, "Back",&icon_cross));
 
   std::vector<MacAddress> macList = wirelessManager.getConnectedMacAddresses();
   uint8_t i = 0; 
       for (const MacAddress&mac : macList) {
-        items.push_back(omegaTFT(VALUE,"Device:",icon_numeric,macList[i].mac[5]));
+        items.push_back(omegaTFT(VALUE,"Device:",&icon_numeric,macList[i].mac[5]));
         i++;
 
     }
@@ -418,34 +606,46 @@ omegaTFT(EXIT,"Back")
 
 };
 
-omegaTFT plantMenu[]{
-omegaTFT(SUBMENU,"Plant 1", icon_potted_plant,plantParams,sizeof(plantParams)/sizeof(omegaTFT)),
-omegaTFT(SUBMENU,"Plant 2", icon_potted_plant,plantParams,sizeof(plantParams)/sizeof(omegaTFT)),
-omegaTFT(EXIT,"Back")
+// One entry per pot in the plant table, opens the live screen of that pot
+std::vector<omegaTFT> plantMenu(void)
+{
+  std::vector<omegaTFT> items;
 
-};
+  if (plants.lock(100)) {
+    for (uint8_t i = 0; i < plants.size(); i++) {
+      plantEntry* entry = plants.at(i);
+      if (entry) items.push_back(omegaTFT(FUNCTION, entry->label, &icon_potted_plant, plantScreens[i]));
+    }
+    plants.unlock();
+  }
+
+  items.push_back(omegaTFT(SUBMENU, "Default Profile", &icon_potted_plant, plantParams, sizeof(plantParams)/sizeof(omegaTFT)));
+  items.push_back(omegaTFT(EXIT, "Back", &icon_cross));
+  return items;
+}
 
 
 omegaTFT wifiMenu[]{
-omegaTFT(FUNCTION,"Start AP", icon_satellite_antenna,startAP),
-omegaTFT(FUNCTION,"Stop AP", icon_satellite_antenna,stopAP),
-omegaTFT(MENU_FUNCTION,"Get MAC",icon_satellite_antenna,macMenu),
+omegaTFT(FUNCTION,"Start AP", &icon_satellite_antenna,startAP),
+omegaTFT(FUNCTION,"Stop AP", &icon_satellite_antenna,stopAP),
+omegaTFT(MENU_FUNCTION,"Get MAC",&icon_satellite_antenna,macMenu),
+omegaTFT(FUNCTION,"ESP-NOW Peers",&icon_satellite_antenna,drawPeerStats),
 omegaTFT(EXIT,"Back")
 
 
 };
 
 omegaTFT settingsMenu [] = {
-  omegaTFT(SUBMENU,"Plant Profiles", icon_potted_plant,plantMenu,sizeof(plantMenu)/sizeof(omegaTFT)),
-  omegaTFT(SUBMENU,"WiFi", icon_wifi,wifiMenu,sizeof(wifiMenu)/sizeof(omegaTFT)),
-  omegaTFT(EMPTY,"BLE", icon_bluetooth),
+  omegaTFT(MENU_FUNCTION,"Plants", &icon_potted_plant,plantMenu),
+  omegaTFT(SUBMENU,"WiFi", &icon_wifi,wifiMenu,sizeof(wifiMenu)/sizeof(omegaTFT)),
+  omegaTFT(EMPTY,"BLE", &icon_bluetooth),
   omegaTFT(EXIT,"Back")
 };
 
 omegaTFT submenus [] = {
-  omegaTFT(FUNCTION, "Home Screen",icon_potted_plant,drawHomeScreen),
-  omegaTFT(SUBMENU, "Settings",icon_gear,settingsMenu, sizeof(settingsMenu)/sizeof(omegaTFT)),
-  omegaTFT(FUNCTION,"Restart Device",icon_cross,restartESP)
+  omegaTFT(FUNCTION, "Home Screen",&icon_potted_plant,drawHomeScreen),
+  omegaTFT(SUBMENU, "Settings",&icon_gear,settingsMenu, sizeof(settingsMenu)/sizeof(omegaTFT)),
+  omegaTFT(FUNCTION,"Restart Device",&icon_cross,restartESP)
 };
 
 omegaTFT myMenu = omegaTFT(SUBMENU,"Main Menu",nullptr,submenus,sizeof(submenus)/sizeof(omegaTFT));
@@ -0,0 +1,46 @@
+#ifndef NOW_MANAGER_H
+#define NOW_MANAGER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <omegaPlant.h>
+#include <omegaSchema.h>
+#include <omegaNowLink.h>
+#include <omegaNowPeers.h>
+#include <omegaNowBatch.h>
+#include "plantTable.h"
+#include "mqttManager.h"
+#include "linkManager.h"
+
+#define NOW_DEVICE_PREFIX 'D'
+
+omegaNowPeers nowPeers; // Pots are paired the first time they send data
+omegaEspNowRadio nowRadio(&nowPeers);
+omegaNowLink nowLink(nowRadio);
+
+// Runs in the ESP-NOW rx task
+void onNowFrame(const uint8_t* mac, const nowHeader& header, const uint8_t* payload, uint8_t len, void* ctx) {
+  plantFrame frame;
+  frame.type = header.type;
+  frame.src = header.src;
+  frame.len = len;
+  memcpy(frame.payload, payload, len);
+  handlePlantFrame(frame);
+}
+
+// Call after WiFi is started, ESP-NOW shares its radio and runs on the AP's channel
+void setup_now() {
+  uint8_t mac[6];
+  WiFi.macAddress(mac);
+  WiFi.setSleep(false); // Modem sleep misses frames sent between AP beacons
+
+  nowPeers.autoPair((1 << NOW_SENSOR) | (1 << NOW_STATE) | (1 << NOW_PROFILE) | (1 << NOW_BATCH));
+  nowLink.onFrame(onNowFrame);
+  nowLink.setSink(true);  // Pots route their samples here
+  nowLink.setRelay(true); // Always powered, forwards frames addressed to other devices
+  nowLink.setAnnounceChannel(true); // Stays connected for MQTT, pots follow the AP's channel
+  if (!nowLink.begin(nowDeviceID(NOW_DEVICE_PREFIX, mac))) {
+    Serial.println("ESP-NOW link failed");
+  }
+}
+#endif
@@ -0,0 +1,166 @@
+#ifndef PLANT_TABLE_H
+#define PLANT_TABLE_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <omegaPlant.h>
+#include <omegaSeqlock.h>
+
+/** Settings */
+#define PLANT_TABLE_SIZE 8   // Pots followed at the same time
+#define PLANT_HISTORY_LEN 12 // Samples kept per pot
+/** End Settings */
+
+typedef struct sensorDataPacket{
+    uint16_t id;
+    uint8_t tempc;
+    uint8_t hum;
+    uint8_t light;
+    uint8_t moist;
+    uint8_t xp;
+    uint8_t mood;
+    uint8_t emotion;
+} sensorDataPacket;
+
+inline void toPacket(const plantState& state, sensorDataPacket& packet) {
+  packet.id = state.plantID;
+  packet.tempc = state.curData.temperature;
+  packet.hum = state.curData.humidity;
+  packet.moist = state.curData.moisture;
+  packet.light = state.curData.lightIntensity;
+  packet.xp = state.curXP;
+  packet.mood = state.curMood;
+  packet.emotion = state.curEmotion;
+}
+
+inline void toState(const sensorDataPacket& packet, plantState& state) {
+  state.plantID = packet.id;
+  state.curData.temperature = packet.tempc;
+  state.curData.humidity = packet.hum;
+  state.curData.moisture = packet.moist;
+  state.curData.lightIntensity = packet.light;
+  state.curXP = packet.xp;
+  state.curMood = packet.mood;
+  state.curEmotion = packet.emotion;
+}
+
+/**
+ * @brief Everything PlantPal knows about one pot
+ *
+ * sample and profile are published as complete frames by Wifi_Task, the
+ * display reads them without taking any lock.
+ */
+struct plantEntry {
+  uint16_t id = 0;  // 16-bit device id, 0 = free
+  char label[16];   // Menu label, e.g. "Plant 5A3C", the id as in its MQTT topics
+  omegaSeqlock<sensorDataPacket> sample;
+  omegaSeqlock<PlantProfile> profile;
+  volatile uint16_t unlocked; // Unlockables of the last state frame, a single store needs no seqlock
+  uint32_t lastSeen; // millis() when the newest sample was taken
+  sensorDataPacket history[PLANT_HISTORY_LEN];
+  uint8_t historyHead;
+  uint8_t historyCount;
+
+  bool used() const { return id != 0; }
+
+  /** @brief History sample, age 0 is the newest */
+  const sensorDataPacket& historyAt(uint8_t age) const {
+    return history[(historyHead + PLANT_HISTORY_LEN - 1 - age) % PLANT_HISTORY_LEN];
+  }
+};
+
+/**
+ * @brief Fixed-capacity table of all pots on the network, keyed by device id
+ *
+ * Entries never move, so the UI can keep a pointer and read sample and
+ * profile lock-free. Writers (Wifi_Task) take the lock for every update, the
+ * lock is otherwise only needed for the history and the label.
+ */
+class plantTable {
+private:
+  SemaphoreHandle_t mutex = nullptr;
+  plantEntry entries[PLANT_TABLE_SIZE];
+
+public:
+  bool begin() {
+    mutex = xSemaphoreCreateMutex();
+    return mutex != nullptr;
+  }
+
+  bool lock(TickType_t wait = portMAX_DELAY) { return mutex && xSemaphoreTake(mutex, wait) == pdTRUE; }
+  void unlock() { xSemaphoreGive(mutex); }
+
+  uint8_t size() const { return PLANT_TABLE_SIZE; }
+
+  /** @brief Entry at index, nullptr if the slot is free */
+  plantEntry* at(uint8_t index) {
+    if (index >= PLANT_TABLE_SIZE || !entries[index].used()) return nullptr;
+    return &entries[index];
+  }
+
+  /** @brief Index of the next used entry after index (wrapping), -1 if the table is empty */
+  int8_t next(int8_t index) const {
+    for (uint8_t i = 1; i <= PLANT_TABLE_SIZE; i++) {
+      uint8_t candidate = (index + i + PLANT_TABLE_SIZE) % PLANT_TABLE_SIZE;
+      if (entries[candidate].used()) return candidate;
+    }
+    return -1;
+  }
+
+  /** @brief Entry of a pot, nullptr if unknown. Call with the lock held */
+  plantEntry* find(uint16_t plantID) {
+    for (uint8_t i = 0; i < PLANT_TABLE_SIZE; i++) {
+      if (entries[i].id == plantID) return &entries[i];
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Entry of a pot, a new pot replaces the least recently seen one if full
+   * @param plantID 16-bit device id
+   * @param profile Profile of a newly created entry
+   * Call with the lock held.
+   */
+  plantEntry* findOrCreate(uint16_t plantID, const PlantProfile& profile) {
+    if (plantID == 0) return nullptr;
+
+    plantEntry* entry = find(plantID);
+    if (entry) return entry;
+
+    entry = &entries[0];
+    for (uint8_t i = 0; i < PLANT_TABLE_SIZE; i++) {
+      if (!entries[i].used()) { entry = &entries[i]; break; }
+      if (entries[i].lastSeen < entry->lastSeen) entry = &entries[i];
+    }
+
+    entry->id = plantID;
+    snprintf(entry->label, sizeof(entry->label), "Plant %04X", plantID);
+    sensorDataPacket empty = {};
+    empty.id = plantID;
+    entry->sample.write(empty);
+    entry->profile.write(profile);
+    entry->unlocked = 0;
+    entry->lastSeen = millis();
+    entry->historyHead = 0;
+    entry->historyCount = 0;
+    return entry;
+  }
+
+  /**
+   * @brief Store a new sample and append it to the history. Call with the lock held
+   * @param ageSec How long ago the sample was taken, e.g. from a batch; older than the stored one is dropped
+   */
+  void pushSample(plantEntry* entry, const sensorDataPacket& sample, uint16_t ageSec = 0) {
+    uint32_t sampledAt = millis() - ageSec * 1000UL;
+    if (entry->historyCount && (int32_t)(sampledAt - entry->lastSeen) < 0) return;
+
+    entry->sample.write(sample);
+    entry->lastSeen = sampledAt;
+    entry->history[entry->historyHead] = sample;
+    entry->historyHead = (entry->historyHead + 1) % PLANT_HISTORY_LEN;
+    if (entry->historyCount < PLANT_HISTORY_LEN) entry->historyCount++;
+  }
+};
+
+#endif
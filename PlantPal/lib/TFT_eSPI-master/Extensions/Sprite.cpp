@@ -36,6 +36,11 @@ TFT_eSprite::TFT_eSprite(TFT_eSPI *tft)
 
   _colorMap = nullptr;
 
+  _opaqueRuns = nullptr;
+  _opaqueSize = 0;
+  _opaqueTransp = 0;
+  _opaqueValid = false;
+
   _psram_enable = true;
   
   // Ensure end_tft_write() does nothing in inherited functions.
@@ -118,6 +123,7 @@ void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames)
 void* TFT_eSprite::getPointer(void)
 {
   if (!_created) return nullptr;
+  _opaqueValid = false; // The caller may write to the buffer
   return _img8_1;
 }
 
@@ -284,6 +290,8 @@ void* TFT_eSprite::frameBuffer(int8_t f)
   if ( f == 2 ) _img8 = _img8_2;
   else          _img8 = _img8_1;
 
+  _opaqueValid = false; // The mask was recorded from the other frame
+
   if (_bpp == 16) _img = (uint16_t*)_img8;
 
   //if (_bpp == 8) _img8 = _img8;
@@ -378,6 +386,8 @@ void TFT_eSprite::deleteSprite(void)
     _colorMap = nullptr;
   }
 
+  deleteOpaqueMask();
+
   if (_created)
   {
     free(_img8_1);
@@ -758,7 +768,24 @@ bool TFT_eSprite::pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t
   if (_bpp ==  4 || ds_bpp ==  4) return false;
   if (_bpp ==  1 && ds_bpp !=  1) return false;
 
+  // Sprite pixels are already byte swapped, like the pushToSprite() without transparency
   bool oldSwapBytes = dspr->getSwapBytes();
+  dspr->setSwapBytes(false);
+
+  // Copy the recorded opaque runs straight from the Sprite buffer
+  if (_opaqueValid && _bpp == 16 && _opaqueTransp == transp) {
+    const uint16_t* run = _opaqueRuns;
+    for (int32_t ys = 0; ys < height(); ys++) {
+      uint16_t count = *run++;
+      while (count--) {
+        dspr->pushImage(x + run[0], y + ys, run[1], 1, _img + run[0] + ys * width());
+        run += 2;
+      }
+    }
+    dspr->setSwapBytes(oldSwapBytes);
+    return true;
+  }
+
   uint16_t sline_buffer[width()];
 
   transp = transp>>8 | transp<<8;
@@ -794,6 +821,129 @@ bool TFT_eSprite::pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t
 }
 
 
+/***************************************************************************************
+** Function name:           opaqueRow (private helper function for createOpaqueMask)
+** Description:             Write the run count and runs of one row, return the entries
+***************************************************************************************/
+// With run == nullptr only the entries are counted. swapped is the transparent colour
+// as stored in the buffer
+static uint32_t opaqueRow(const uint16_t* line, int32_t w, uint16_t swapped, uint16_t* run)
+{
+  uint32_t count = 0;
+  int32_t xs = 0;
+  while (xs < w) {
+    while (xs < w && line[xs] == swapped) xs++;
+    if (xs == w) break;
+    int32_t start = xs;
+    while (xs < w && line[xs] != swapped) xs++;
+    if (run) {
+      run[1 + 2 * count] = start;
+      run[2 + 2 * count] = xs - start;
+    }
+    count++;
+  }
+  if (run) run[0] = count;
+  return 1 + 2 * count;
+}
+
+
+/***************************************************************************************
+** Function name:           reserveOpaqueMask
+** Description:             Grow the opaque run mask, keeping its entries
+***************************************************************************************/
+bool TFT_eSprite::reserveOpaqueMask(uint32_t entries)
+{
+  if (entries <= _opaqueSize) return true;
+
+  uint32_t size = _opaqueSize ? _opaqueSize * 2 : height() * 8;
+  if (size < entries) size = entries;
+  uint16_t* runs = (uint16_t*)realloc(_opaqueRuns, size * sizeof(uint16_t));
+  if (!runs) return false;
+  _opaqueRuns = runs;
+  _opaqueSize = size;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           createOpaqueMask
+** Description:             Record the runs of pixels that are not the transparent colour
+***************************************************************************************/
+// One pass into the memory of the last mask, grown only when a row might not fit
+bool TFT_eSprite::createOpaqueMask(uint16_t transp)
+{
+  _opaqueValid = false;
+  if (!_created || _bpp != 16) return false;
+
+  uint16_t swapped = transp>>8 | transp<<8;
+
+  uint32_t used = 0;
+  for (int32_t ys = 0; ys < height(); ys++) {
+    // Count plus at most (width + 1) / 2 runs
+    if (!reserveOpaqueMask(used + 2 + width())) return false;
+    used += opaqueRow(_img + ys * width(), width(), swapped, _opaqueRuns + used);
+  }
+
+  _opaqueTransp = transp;
+  _opaqueValid = true;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           createOpaqueMask
+** Description:             Record the runs of rows y to y + h - 1 again
+***************************************************************************************/
+// The rows after them are moved to fit, the rows before them are kept. Without a
+// previous mask for transp the whole Sprite is recorded
+bool TFT_eSprite::createOpaqueMask(uint16_t transp, int32_t y, int32_t h)
+{
+  if (!_opaqueRuns || _opaqueTransp != transp) return createOpaqueMask(transp);
+  _opaqueValid = false;
+  if (!_created || _bpp != 16) return false;
+
+  if (y < 0) { h += y; y = 0; }
+  if (y + h > height()) h = height() - y;
+  if (h < 0) h = 0;
+
+  uint16_t swapped = transp>>8 | transp<<8;
+
+  // Entries before the rows, in the rows as recorded and in the whole mask
+  uint32_t head = 0, old = 0, used = 0;
+  for (int32_t ys = 0; ys < height(); ys++) {
+    uint32_t n = 1 + 2 * _opaqueRuns[used];
+    if (ys < y) head += n;
+    else if (ys < y + h) old += n;
+    used += n;
+  }
+
+  uint32_t fresh = 0;
+  for (int32_t ys = y; ys < y + h; ys++) fresh += opaqueRow(_img + ys * width(), width(), swapped, nullptr);
+
+  if (!reserveOpaqueMask(used - old + fresh)) return false;
+  memmove(_opaqueRuns + head + fresh, _opaqueRuns + head + old, (used - head - old) * sizeof(uint16_t));
+
+  uint16_t* run = _opaqueRuns + head;
+  for (int32_t ys = y; ys < y + h; ys++) run += opaqueRow(_img + ys * width(), width(), swapped, run);
+
+  _opaqueValid = true;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           deleteOpaqueMask
+** Description:             Free the opaque run mask, pushToSprite tests every pixel again
+***************************************************************************************/
+void TFT_eSprite::deleteOpaqueMask(void)
+{
+  if (_opaqueRuns) free(_opaqueRuns);
+  _opaqueRuns = nullptr;
+  _opaqueSize = 0;
+  _opaqueValid = false;
+}
+
+
 /***************************************************************************************
 ** Function name:           pushSprite
 ** Description:             Push a cropped sprite to the TFT at tx, ty
@@ -1034,6 +1184,8 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_
 
   PI_CLIP;
 
+  _opaqueValid = false;
+
   if (_bpp == 16) // Plot a 16 bpp image into a 16 bpp Sprite
   {
     // Pointer within original image
@@ -1177,6 +1329,8 @@ void  TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const u
 
   PI_CLIP;
 
+  _opaqueValid = false;
+
   if (_bpp == 16) // Plot a 16 bpp image into a 16 bpp Sprite
   {
     for (int32_t yp = dy; yp < dy + dh; yp++)
@@ -1291,6 +1445,8 @@ void TFT_eSprite::pushColor(uint16_t color)
 {
   if (!_created ) return;
 
+  _opaqueValid = false;
+
   // Write the colour to RAM in set window
   if (_bpp == 16)
     _img [_xptr + _yptr * _iwidth] = (uint16_t) (color >> 8) | (color << 8);
@@ -1355,6 +1511,8 @@ void TFT_eSprite::writeColor(uint16_t color)
 {
   if (!_created ) return;
 
+  _opaqueValid = false;
+
   // Write 16-bit RGB 565 encoded colour to RAM
   if (_bpp == 16) _img [_xptr + _yptr * _iwidth] = color;
 
@@ -1417,6 +1575,8 @@ void TFT_eSprite::setScrollRect(int32_t x, int32_t y, int32_t w, int32_t h, uint
 ***************************************************************************************/
 void TFT_eSprite::scroll(int16_t dx, int16_t dy)
 {
+  _opaqueValid = false;
+
   if (abs(dx) >= _sw || abs(dy) >= _sh)
   {
     fillRect (_sx, _sy, _sw, _sh, _scolor);
@@ -1509,6 +1669,34 @@ void TFT_eSprite::scroll(int16_t dx, int16_t dy)
 }
 
 
+/***************************************************************************************
+** Function name:           fill16 (private helper function)
+** Description:             Fill n 16-bit pixels using 32-bit word stores
+***************************************************************************************/
+// color must already be byte swapped. Colours with equal bytes, e.g. black, use
+// memset. Otherwise unrolled 8 words (16 pixels) per loop, the single pixels before
+// the first word boundary and after the last word are written separately
+static inline void fill16(uint16_t* ptr, uint16_t color, uint32_t n)
+{
+  if ((uint8_t)color == (uint8_t)(color >> 8)) { memset(ptr, (uint8_t)color, n << 1); return; }
+
+  if (n && ((uintptr_t)ptr & 2)) { *ptr++ = color; n--; }
+
+  uint32_t  c32   = color | ((uint32_t)color << 16);
+  uint32_t* ptr32 = (uint32_t*)ptr;
+  uint32_t  words = n >> 1;
+
+  while (words >= 8) {
+    ptr32[0] = c32; ptr32[1] = c32; ptr32[2] = c32; ptr32[3] = c32;
+    ptr32[4] = c32; ptr32[5] = c32; ptr32[6] = c32; ptr32[7] = c32;
+    ptr32 += 8;
+    words -= 8;
+  }
+  while (words--) *ptr32++ = c32;
+
+  if (n & 1) *(uint16_t*)ptr32 = color;
+}
+
 /***************************************************************************************
 ** Function name:           fillSprite
 ** Description:             Fill the whole sprite with defined colour
@@ -1517,6 +1705,8 @@ void TFT_eSprite::fillSprite(uint32_t color)
 {
   if (!_created || _vpOoB) return;
 
+  _opaqueValid = false;
+
   // Use memset if possible as it is super fast
   if(_xDatum == 0 && _yDatum == 0  &&  _xWidth == width())
   {
@@ -1631,6 +1821,8 @@ void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
 {
   if (!_created || _vpOoB) return;
 
+  _opaqueValid = false;
+
   x+= _xDatum;
   y+= _yDatum;
 
@@ -1749,6 +1941,8 @@ void TFT_eSprite::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
 {
   if (!_created || _vpOoB) return;
 
+  _opaqueValid = false;
+
   x+= _xDatum;
   y+= _yDatum;
 
@@ -1810,6 +2004,8 @@ void TFT_eSprite::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
 {
   if (!_created || _vpOoB) return;
 
+  _opaqueValid = false;
+
   x+= _xDatum;
   y+= _yDatum;
 
@@ -1825,7 +2021,7 @@ void TFT_eSprite::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
-    while (w--) _img[_iwidth * y + x++] = (uint16_t) color;
+    fill16(_img + _iwidth * y + x, (uint16_t) color, w);
   }
   else if (_bpp == 8)
   {
@@ -1873,6 +2069,8 @@ void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
 {
   if (!_created || _vpOoB) return;
 
+  _opaqueValid = false;
+
   x+= _xDatum;
   y+= _yDatum;
 
@@ -1892,14 +2090,13 @@ void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t
   if (_bpp == 16)
   {
     color = (color >> 8) | (color << 8);
-    uint32_t iw = w;
-    int32_t ys = yp;
-    if(h--)  {while (iw--) _img[yp++] = (uint16_t) color;}
-    yp = ys;
-    while (h--)
-    {
-      yp += _iwidth;
-      memcpy( _img+yp, _img+ys, w<<1);
+    if (w == _iwidth) fill16(_img + yp, (uint16_t) color, w * h); // Full width rows are contiguous
+    else {
+      while (h--)
+      {
+        fill16(_img + yp, (uint16_t) color, w);
+        yp += _iwidth;
+      }
     }
   }
   else if (_bpp == 8)
@@ -2525,6 +2722,12 @@ void TFT_eSprite::drawGlyph(uint16_t code)
       }
     }
 
+    // Glyph rows blended straight into the 16-bit buffer, the background is the sprite.
+    // The rows are addressed in buffer coordinates, so a rotated sprite goes per pixel
+    bool spanRows = getBG && !_fillbg && _bpp == 16 && !_vpOoB && rotation == 0;
+    if (spanRows) _opaqueValid = false;
+    uint16_t fgSwapped = (fg >> 8) | (fg << 8); // As stored in the buffer
+
     for (int32_t y = 0; y < gHeight[gNum]; y++)
     {
 #ifdef FONT_FS_AVAILABLE
@@ -2533,6 +2736,33 @@ void TFT_eSprite::drawGlyph(uint16_t code)
       }
 #endif
 
+      if (spanRows)
+      {
+        const uint8_t* row = gPtr + gBitmap[gNum] + gWidth[gNum] * y;
+#ifdef FONT_FS_AVAILABLE
+        if (fs_font) row = pbuffer;
+#endif
+        // Clip the row to the viewport
+        int32_t py = y + cy + _yDatum;
+        if (py < _vpY || py >= _vpH) continue;
+        int32_t px = cx + _xDatum;
+        int32_t x0 = (px < _vpX) ? _vpX - px : 0;
+        int32_t x1 = (px + gWidth[gNum] > _vpW) ? _vpW - px : gWidth[gNum];
+        uint16_t* dst = _img + px + py * _iwidth;
+        for (int32_t x = x0; x < x1; x++)
+        {
+          pixel = row[x];
+          if (pixel == 0xFF) dst[x] = fgSwapped;
+          else if (pixel)
+          {
+            uint16_t p = (dst[x] >> 8) | (dst[x] << 8);
+            p = alphaBlend(pixel, fg, p);
+            dst[x] = (p >> 8) | (p << 8);
+          }
+        }
+        continue;
+      }
+
       for (int32_t x = 0; x < gWidth[gNum]; x++)
       {
 #ifdef FONT_FS_AVAILABLE
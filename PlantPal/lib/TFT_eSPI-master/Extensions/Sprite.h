@@ -130,6 +130,14 @@ class TFT_eSprite : public TFT_eSPI {
   bool     pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y);
   bool     pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t transparent);
 
+           // Record the opaque pixel runs of a 16-bit Sprite for pushToSprite() with that transparent
+           // colour, which then copies the runs without testing every pixel. Create it after drawing,
+           // drawing or getPointer() invalidates it until it is created again, which reuses the memory
+  bool     createOpaqueMask(uint16_t transparent);
+           // Record rows y to y + h - 1 again, the caller only drew into those since the last mask
+  bool     createOpaqueMask(uint16_t transparent, int32_t y, int32_t h);
+  void     deleteOpaqueMask(void);
+
            // Draw a single character in the selected font
   int16_t  drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font),
            drawChar(uint16_t uniCode, int32_t x, int32_t y);
@@ -155,6 +163,9 @@ class TFT_eSprite : public TFT_eSPI {
            // Reserve memory for the Sprite and return a pointer
   void*    callocSprite(int16_t width, int16_t height, uint8_t frames = 1);
 
+           // Grow the opaque run mask to hold at least entries
+  bool     reserveOpaqueMask(uint32_t entries);
+
            // Override the non-inlined TFT_eSPI functions
   void     begin_nin_write(void) { ; }
   void     end_nin_write(void) { ; }
@@ -170,6 +181,11 @@ class TFT_eSprite : public TFT_eSPI {
 
   uint16_t *_colorMap; // color map pointer: 16 entries, used with 4-bit color map.
 
+  uint16_t *_opaqueRuns;  // Per row: run count, then x start and length of each opaque run
+  uint32_t _opaqueSize;   // Entries allocated for _opaqueRuns
+  uint16_t _opaqueTransp; // Transparent colour of the mask
+  bool     _opaqueValid;  // _opaqueRuns matches the buffer, cleared by every write
+
   int32_t  _sinra;   // Sine of rotation angle in fixed point
   int32_t  _cosra;   // Cosine of rotation angle in fixed point
 
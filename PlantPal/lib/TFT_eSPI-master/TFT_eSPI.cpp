@@ -4053,6 +4053,104 @@ inline uint8_t TFT_eSPI::sqrt_fraction(uint32_t num) {
   return fpr>>osh;
 }
 
+/***************************************************************************************
+** Description:  U16.16 slope |cos|/|sin| of the arc ends, one entry per degree
+***************************************************************************************/
+// Same values as (fabsf(cosf(a))/(fabsf(sinf(a)) + 1.0f/0x8000)) * 65536.0f so the
+// arc end positions are unchanged, without soft-float sinf/cosf on every drawArc
+// Generated on the host with glibc (test/test_arc), newlib's sinf/cosf on the device
+// may round an entry differently in the last bit
+static const uint32_t arcSlope[361] PROGMEM = {
+  0x80000000, 0x003930A1, 0x001C9C7A, 0x001311EC, 0x000E4B5E, 0x000B6D11,
+  0x000982F7, 0x0008246E, 0x00071D22, 0x00065001, 0x0005AB97, 0x000524CB,
+  0x0004B435, 0x000454B5, 0x000402A1, 0x0003BB4A, 0x00037CAD, 0x00034540,
+  0x000313CF, 0x0002E768, 0x0002BF4A, 0x00029AD8, 0x00027992, 0x00025B0D,
+  0x00023EF1, 0x000224F4, 0x00020CD7, 0x0001F665, 0x0001E16F, 0x0001CDCE,
+  0x0001BB60, 0x0001AA07, 0x000199A9, 0x00018A2E, 0x00017B83, 0x00016D96,
+  0x00016055, 0x000153B4, 0x000147A6, 0x00013C1E, 0x00013113, 0x0001267B,
+  0x00011C4D, 0x00011283, 0x00010915, 0x0000FFFD, 0x0000F734, 0x0000EEB6,
+  0x0000E67E, 0x0000DE87, 0x0000D6CD, 0x0000CF4B, 0x0000C800, 0x0000C0E7,
+  0x0000B9FC, 0x0000B33F, 0x0000ACAA, 0x0000A63E, 0x00009FF5, 0x000099D0,
+  0x000093CB, 0x00008DE5, 0x0000881C, 0x0000826F, 0x00007CDA, 0x0000775E,
+  0x000071F9, 0x00006CA9, 0x0000676D, 0x00006244, 0x00005D2C, 0x00005825,
+  0x0000532D, 0x00004E43, 0x00004967, 0x00004497, 0x00003FD3, 0x00003B19,
+  0x00003669, 0x000031C2, 0x00002D23, 0x0000288B, 0x000023FA, 0x00001F6E,
+  0x00001AE7, 0x00001665, 0x000011E6, 0x00000D6A, 0x000008F0, 0x00000477,
+  0x00000000, 0x00000477, 0x000008F0, 0x00000D6A, 0x000011E6, 0x00001665,
+  0x00001AE7, 0x00001F6E, 0x000023FA, 0x0000288B, 0x00002D23, 0x000031C2,
+  0x00003669, 0x00003B19, 0x00003FD3, 0x00004497, 0x00004967, 0x00004E43,
+  0x0000532D, 0x00005825, 0x00005D2C, 0x00006244, 0x0000676D, 0x00006CA9,
+  0x000071F9, 0x0000775E, 0x00007CDA, 0x0000826F, 0x0000881C, 0x00008DE5,
+  0x000093CB, 0x000099D0, 0x00009FF5, 0x0000A63E, 0x0000ACAA, 0x0000B33F,
+  0x0000B9FC, 0x0000C0E7, 0x0000C800, 0x0000CF4B, 0x0000D6CD, 0x0000DE87,
+  0x0000E67E, 0x0000EEB6, 0x0000F734, 0x0000FFFD, 0x00010915, 0x00011283,
+  0x00011C4D, 0x0001267B, 0x00013113, 0x00013C1E, 0x000147A6, 0x000153B4,
+  0x00016055, 0x00016D96, 0x00017B83, 0x00018A2E, 0x000199A9, 0x0001AA07,
+  0x0001BB60, 0x0001CDCE, 0x0001E16F, 0x0001F664, 0x00020CD7, 0x000224F4,
+  0x00023EF1, 0x00025B0D, 0x00027992, 0x00029AD8, 0x0002BF4A, 0x0002E768,
+  0x000313CF, 0x00034540, 0x00037CAD, 0x0003BB4A, 0x000402A1, 0x000454B5,
+  0x0004B435, 0x000524CB, 0x0005AB97, 0x00065001, 0x00071D22, 0x0008246E,
+  0x000982F7, 0x000B6D10, 0x000E4B5E, 0x001311EA, 0x001C9C7C, 0x00393096,
+  0x7FA26580, 0x003930A3, 0x001C9C7F, 0x001311EB, 0x000E4B5F, 0x000B6D11,
+  0x000982F7, 0x0008246E, 0x00071D22, 0x00065001, 0x0005AB97, 0x000524CB,
+  0x0004B435, 0x000454B5, 0x000402A1, 0x0003BB4A, 0x00037CAD, 0x00034540,
+  0x000313CF, 0x0002E768, 0x0002BF4A, 0x00029AD8, 0x00027992, 0x00025B0D,
+  0x00023EF1, 0x000224F4, 0x00020CD7, 0x0001F664, 0x0001E16F, 0x0001CDCE,
+  0x0001BB60, 0x0001AA07, 0x000199A9, 0x00018A2E, 0x00017B83, 0x00016D96,
+  0x00016055, 0x000153B4, 0x000147A6, 0x00013C1E, 0x00013113, 0x0001267B,
+  0x00011C4D, 0x00011283, 0x00010915, 0x0000FFFD, 0x0000F734, 0x0000EEB6,
+  0x0000E67E, 0x0000DE87, 0x0000D6CD, 0x0000CF4B, 0x0000C800, 0x0000C0E7,
+  0x0000B9FC, 0x0000B33F, 0x0000ACAA, 0x0000A63E, 0x00009FF5, 0x000099D0,
+  0x000093CB, 0x00008DE5, 0x0000881C, 0x0000826F, 0x00007CDA, 0x0000775E,
+  0x000071F9, 0x00006CA9, 0x0000676D, 0x00006244, 0x00005D2C, 0x00005825,
+  0x0000532D, 0x00004E43, 0x00004967, 0x00004497, 0x00003FD3, 0x00003B19,
+  0x00003669, 0x000031C2, 0x00002D23, 0x0000288B, 0x000023FA, 0x00001F6E,
+  0x00001AE7, 0x00001665, 0x000011E6, 0x00000D6A, 0x000008F0, 0x00000477,
+  0x00000000, 0x00000477, 0x000008F0, 0x00000D6A, 0x000011E6, 0x00001665,
+  0x00001AE7, 0x00001F6E, 0x000023FA, 0x0000288B, 0x00002D23, 0x000031C2,
+  0x00003669, 0x00003B19, 0x00003FD3, 0x00004497, 0x00004967, 0x00004E43,
+  0x0000532D, 0x00005825, 0x00005D2C, 0x00006244, 0x0000676D, 0x00006CA9,
+  0x000071F9, 0x0000775E, 0x00007CDA, 0x0000826F, 0x0000881C, 0x00008DE5,
+  0x000093CB, 0x000099D0, 0x00009FF5, 0x0000A63E, 0x0000ACAA, 0x0000B33F,
+  0x0000B9FC, 0x0000C0E7, 0x0000C800, 0x0000CF4B, 0x0000D6CD, 0x0000DE87,
+  0x0000E67E, 0x0000EEB6, 0x0000F734, 0x0000FFFD, 0x00010915, 0x00011283,
+  0x00011C4D, 0x0001267B, 0x00013113, 0x00013C1E, 0x000147A6, 0x000153B4,
+  0x00016055, 0x00016D96, 0x00017B83, 0x00018A2E, 0x000199A9, 0x0001AA07,
+  0x0001BB60, 0x0001CDCE, 0x0001E16F, 0x0001F664, 0x00020CD7, 0x000224F4,
+  0x00023EF1, 0x00025B0D, 0x00027992, 0x00029AD8, 0x0002BF4A, 0x0002E768,
+  0x000313CF, 0x00034540, 0x00037CAD, 0x0003BB4A, 0x000402A1, 0x000454B5,
+  0x0004B435, 0x000524CB, 0x0005AB97, 0x00065001, 0x00071D22, 0x0008246D,
+  0x000982F6, 0x000B6D0F, 0x000E4B5F, 0x001311EC, 0x001C9C74, 0x00393075,
+  0x7F455500
+};
+
+/***************************************************************************************
+** Function name:           arcSpan (private helper function for drawArc)
+** Description:             x range of a quadrant scan line within the arc end slopes
+***************************************************************************************/
+// Pixels cx with (dy << 16)/(r - cx) between lo and hi are inside the arc ends. The
+// slope rises with cx, so they form one run, found with two divisions per line
+// instead of one per pixel. Returns false if there is no such pixel.
+static inline bool arcSpan(int32_t r, uint32_t dy, uint32_t lo, uint32_t hi, int32_t &first, int32_t &last)
+{
+  if (lo > hi) return false;
+  uint32_t num = dy << 16;
+
+  // slope <= hi  <=>  r - cx > num/(hi + 1)
+  uint32_t dxMin = (hi == 0xFFFFFFFF) ? 1 : num / (hi + 1) + 1;
+  if (dxMin > (uint32_t)r) return false;
+  last = r - dxMin;
+
+  // slope >= lo  <=>  r - cx <= num/lo
+  first = 0;
+  if (lo) {
+    uint32_t dxMax = num / lo;
+    if (dxMax < dxMin) return false;
+    if (dxMax < (uint32_t)r) first = r - dxMax;
+  }
+  return true;
+}
+
 /***************************************************************************************
 ** Function name:           drawArc
 ** Description:             Draw an arc clockwise from 6 o'clock position
@@ -4063,6 +4161,8 @@ inline uint8_t TFT_eSPI::sqrt_fraction(uint32_t num) {
 // Arc foreground fg_color anti-aliased with background colour along sides
 // smooth is optional, default is true, smooth=false means no antialiasing
 // Note: Arc ends are not anti-aliased (use drawSmoothArc instead for that)
+// Integer only: each scan line is split into the outer AA, fill and inner AA zones
+// and the fill zone is drawn as one run per quadrant, only AA pixels are blended
 void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
                        uint32_t startAngle, uint32_t endAngle,
                        uint32_t fg_color, uint32_t bg_color,
@@ -4083,7 +4183,9 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
   inTransaction = true;
 
   int32_t xs = 0;        // x start position for quadrant scan
-  uint8_t alpha = 0;     // alpha value for blending pixels
+  int32_t xo = 0;        // x start of the fill zone
+  int32_t xf = 0;        // x start of the inner AA zone
+  int32_t xe = 0;        // x end of the inner AA zone
 
   uint32_t r2 = r * r;   // Outer arc radius^2
   if (smooth) r++;       // Outer AA zone radius
@@ -4100,15 +4202,8 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
   uint32_t startSlope[4] = {0, 0, 0xFFFFFFFF, 0};
   uint32_t   endSlope[4] = {0, 0xFFFFFFFF, 0, 0};
 
-  // Ensure maximum U16.16 slope of arc ends is ~ 0x8000 0000
-  constexpr float minDivisor = 1.0f/0x8000;
-
-  // Fill in start slope table and empty quadrants
-  float fabscos = fabsf(cosf(startAngle * deg2rad));
-  float fabssin = fabsf(sinf(startAngle * deg2rad));
-
   // U16.16 slope of arc start
-  uint32_t slope = (fabscos/(fabssin + minDivisor)) * (float)(1UL<<16);
+  uint32_t slope = pgm_read_dword(&arcSlope[startAngle]);
 
   // Update slope table, add slope for arc start
   if (startAngle <= 90) {
@@ -4127,12 +4222,8 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
     startSlope[3] = slope;
   }
 
-  // Fill in end slope table and empty quadrants
-  fabscos  = fabsf(cosf(endAngle * deg2rad));
-  fabssin  = fabsf(sinf(endAngle * deg2rad));
-
   // U16.16 slope of arc end
-  slope   = (uint32_t)((fabscos/(fabssin + minDivisor)) * (float)(1UL<<16));
+  slope = pgm_read_dword(&arcSlope[endAngle]);
 
   // Work out which quadrants will need to be drawn and add slope for arc end
   if (endAngle <= 90) {
@@ -4151,72 +4242,68 @@ void TFT_eSPI::drawArc(int32_t x, int32_t y, int32_t r, int32_t ir,
     endSlope[3] =  slope;
   }
 
+  // Lowest and highest slope inside the arc ends per quadrant
+  const uint32_t loSlope[4] = {  endSlope[0], startSlope[1],   endSlope[2], startSlope[3] };
+  const uint32_t hiSlope[4] = {startSlope[0],   endSlope[1], startSlope[2],   endSlope[3] };
+
   // Scan quadrant
   for (int32_t cy = r - 1; cy > 0; cy--)
   {
-    uint32_t len[4] = { 0,  0,  0,  0}; // Pixel run length
-    int32_t  xst[4] = {-1, -1, -1, -1}; // Pixel run x start
-    uint32_t dy2 = (r - cy) * (r - cy);
+    uint32_t dy = r - cy;
+    uint32_t dy2 = dy * dy;
 
-    // Find and track arc zone start point
+    // Track the zone boundaries, radius^2 falls with cx and every boundary moves right
+    // as dy grows: outer AA [xs, xo), fill [xo, xf), inner AA [xf, xe)
     while ((r - xs) * (r - xs) + dy2 >= r1) xs++;
+    if (xo < xs) xo = xs;
+    while (xo < r && (r - xo) * (r - xo) + dy2 > r2) xo++;
+    if (xf < xo) xf = xo;
+    while (xf < r && (r - xf) * (r - xf) + dy2 >= r3) xf++;
+    if (xe < xf) xe = xf;
+    while (xe < r && (r - xe) * (r - xe) + dy2 > r4) xe++;
+
+    // Pixel run of each quadrant within the arc ends, empty if first > last
+    int32_t first[4], last[4];
+    for (uint32_t q = 0; q < 4; q++) {
+      if (!arcSpan(r, dy, loSlope[q], hiSlope[q], first[q], last[q])) { first[q] = r; last[q] = -1; }
+    }
 
-    for (int32_t cx = xs; cx < r; cx++)
+    for (int32_t cx = xs; cx < xe; cx++)
     {
+      if (cx == xo) cx = xf; // Skip the fill zone
+      if (cx >= xe) break;
+
+      // Check if an AA pixels need to be drawn before the square root
+      bool bl = cx >= first[0] && cx <= last[0];
+      bool tl = cx >= first[1] && cx <= last[1];
+      bool tr = cx >= first[2] && cx <= last[2];
+      bool br = cx >= first[3] && cx <= last[3];
+      if (!(bl || tl || tr || br)) continue;
+
       // Calculate radius^2
       uint32_t hyp = (r - cx) * (r - cx) + dy2;
-
-      // If in outer zone calculate alpha
-      if (hyp > r2) {
-        alpha = ~sqrt_fraction(hyp); // Outer AA zone
-      }
-      // If within arc fill zone, get line start and lengths for each quadrant
-      else if (hyp >= r3) {
-        // Calculate U16.16 slope
-        slope = ((r - cy) << 16)/(r - cx);
-        if (slope <= startSlope[0] && slope >= endSlope[0]) { // slope hi -> lo
-          xst[0] = cx; // Bottom left line end
-          len[0]++;
-        }
-        if (slope >= startSlope[1] && slope <= endSlope[1]) { // slope lo -> hi
-          xst[1] = cx; // Top left line end
-          len[1]++;
-        }
-        if (slope <= startSlope[2] && slope >= endSlope[2]) { // slope hi -> lo
-          xst[2] = cx; // Bottom right line start
-          len[2]++;
-        }
-        if (slope <= endSlope[3] && slope >= startSlope[3]) { // slope lo -> hi
-          xst[3] = cx; // Top right line start
-          len[3]++;
-        }
-        continue; // Next x
-      }
-      else {
-        if (hyp <= r4) break;  // Skip inner pixels
-        alpha = sqrt_fraction(hyp); // Inner AA zone
-      }
+      uint8_t alpha = (cx < xo) ? ~sqrt_fraction(hyp) : sqrt_fraction(hyp); // Outer or inner AA zone
 
       if (alpha < 16) continue;  // Skip low alpha pixels
 
-      // If background is read it must be done in each quadrant
       uint16_t pcol = fastBlend(alpha, fg_color, bg_color);
-      // Check if an AA pixels need to be drawn
-      slope = ((r - cy)<<16)/(r - cx);
-      if (slope <= startSlope[0] && slope >= endSlope[0]) // BL
-        drawPixel(x + cx - r, y - cy + r, pcol);
-      if (slope >= startSlope[1] && slope <= endSlope[1]) // TL
-        drawPixel(x + cx - r, y + cy - r, pcol);
-      if (slope <= startSlope[2] && slope >= endSlope[2]) // TR
-        drawPixel(x - cx + r, y + cy - r, pcol);
-      if (slope <= endSlope[3] && slope >= startSlope[3]) // BR
-        drawPixel(x - cx + r, y - cy + r, pcol);
+      if (bl) drawPixel(x + cx - r, y - cy + r, pcol);
+      if (tl) drawPixel(x + cx - r, y + cy - r, pcol);
+      if (tr) drawPixel(x - cx + r, y + cy - r, pcol);
+      if (br) drawPixel(x - cx + r, y - cy + r, pcol);
+    }
+
+    // Add line in inner zone, clipped to the quadrant run
+    int32_t xst[4], len[4];
+    for (uint32_t q = 0; q < 4; q++) {
+      int32_t a = (first[q] > xo) ? first[q] : xo;
+      xst[q] = (last[q] < xf - 1) ? last[q] : xf - 1; // Line end nearest the centre
+      len[q] = xst[q] - a + 1;
     }
-    // Add line in inner zone
-    if (len[0]) drawFastHLine(x + xst[0] - len[0] + 1 - r, y - cy + r, len[0], fg_color); // BL
-    if (len[1]) drawFastHLine(x + xst[1] - len[1] + 1 - r, y + cy - r, len[1], fg_color); // TL
-    if (len[2]) drawFastHLine(x - xst[2] + r, y + cy - r, len[2], fg_color); // TR
-    if (len[3]) drawFastHLine(x - xst[3] + r, y - cy + r, len[3], fg_color); // BR
+    if (len[0] > 0) drawFastHLine(x + xst[0] - len[0] + 1 - r, y - cy + r, len[0], fg_color); // BL
+    if (len[1] > 0) drawFastHLine(x + xst[1] - len[1] + 1 - r, y + cy - r, len[1], fg_color); // TL
+    if (len[2] > 0) drawFastHLine(x - xst[2] + r, y + cy - r, len[2], fg_color); // TR
+    if (len[3] > 0) drawFastHLine(x - xst[3] + r, y - cy + r, len[3], fg_color); // BR
   }
 
   // Fill in centre lines
@@ -12,6 +12,8 @@
 #include <vector>
 #include "myMenu.h"
 #include "mqttManager.h"
+#include "nowManager.h"
+#include "bleManager.h"
 
 #include "WiFi.h"
 
@@ -143,18 +145,19 @@ void wifiTask(void * params){
   
   //wifiMQTTManager.setup();
   setup_wifi();
+  setup_now();
   vTaskDelay(200);
   client.setKeepAlive(60);
+  setup_router();
   client.setCallback(callback);
   client.setServer(mqtt_server, 1883);
   vTaskDelay(200);
   while (1)
   {
-     if (!client.connected()) {
-    vTaskDelay(2000);
-    reconnect();
-  }
+  reconnect(); // Returns at once while connected or waiting for the next attempt
   client.loop();
+  nowLink.loop();
+  gateway.loop();
   vTaskDelay(1);
   // Publish sensor data every 10 seconds
 
@@ -178,6 +181,7 @@ void setup(void) {
   Wire.begin();
   
  
+  setup_assets();
   menuSprite.createSprite(240,240);
 
     
@@ -193,6 +197,10 @@ void setup(void) {
     xSemaphore4tft =xSemaphoreCreateBinary();
 
 
+    if (!plants.begin()) {Serial.println("PlantTable Fail");}
+    setup_gateway();
+    setup_ble();
+
     if (xSemaphore4tft == NULL) {Serial.println("Semaphore Fail");}
     if (xCalibrationMutex == NULL) {Serial.println("CalibrationMutex Fail");}
 
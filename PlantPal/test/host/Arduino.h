@@ -0,0 +1,107 @@
+// Just enough of the Arduino core to build TFT_eSPI and the ESP-NOW link on
+// the host for the native test env, see platformio.ini. Drawing into sprites
+// only, no display; frames only over omegaLoopbackRadio.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define PI 3.1415926535897932384626433832795
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+// Reads through memcpy, byte arrays are read as words without breaking strict aliasing.
+// A typed address reads its own type, so the 32-bit reads of font pointers stay
+// pointers on a 64-bit host; an untyped one is a pointer table entry.
+template <typename T> inline T pgmRead(const T* a) {
+    T v;
+    memcpy(&v, a, sizeof(v));
+    return v;
+}
+inline const void* pgmRead(const void* a) {
+    const void* v;
+    memcpy(&v, a, sizeof(v));
+    return v;
+}
+
+#define PROGMEM
+#define pgm_read_byte(a) pgmRead((const uint8_t*)(a))
+#define pgm_read_word(a) pgmRead((const uint16_t*)(a))
+#define pgm_read_dword(a) pgmRead(a)
+#define pgm_read_float(a) pgmRead((const float*)(a))
+#define pgm_read_ptr(a) pgmRead((const void*)(a))
+#define yield()
+
+// Pin numbers of the generic processor setup, no pin is ever driven
+enum { D0, D1, D2, D3, D4, D5, D6, D7, D8, D9, D10 };
+#define digitalPinToBitMask(p) (1UL << ((p) & 31))
+#define digitalPinToPort(p) 0
+#define portOutputRegister(p) ((volatile uint32_t*)0)
+
+using std::min;
+using std::max;
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Added to the clock, tests step over timeouts instead of sleeping through them
+static unsigned long hostClockSkew = 0;
+inline void hostAdvance(unsigned long ms) { hostClockSkew += ms * 1000; }
+
+inline unsigned long micros() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000UL + t.tv_nsec / 1000 + hostClockSkew;
+}
+inline unsigned long millis() { return micros() / 1000; }
+inline void delay(unsigned long) {}
+inline void delayMicroseconds(unsigned int) {}
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline int digitalRead(int) { return LOW; }
+inline long random(long hi) { return hi > 0 ? rand() % hi : 0; }
+inline long random(long lo, long hi) { return hi > lo ? lo + random(hi - lo) : lo; }
+inline char* ltoa(long v, char* buf, int base) {
+    sprintf(buf, base == 16 ? "%lx" : "%ld", v);
+    return buf;
+}
+
+// Log output is dropped
+struct HostSerial {
+    void begin(unsigned long) {}
+    template <typename T> void print(T) {}
+    template <typename T> void println(T) {}
+    void println() {}
+    int printf(const char*, ...) { return 0; }
+};
+static HostSerial Serial __attribute__((unused));
+
+class String {
+    std::string s;
+
+public:
+    String(const char* c = "") : s(c ? c : "") {}
+    const char* c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    bool operator==(const char* c) const { return s == c; }
+    void toCharArray(char* buf, unsigned int len) const {
+        if (!len) return;
+        strncpy(buf, s.c_str(), len);
+        buf[len - 1] = 0;
+    }
+};
+
+#endif // HOST_ARDUINO_H
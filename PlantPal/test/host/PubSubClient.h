@@ -0,0 +1,27 @@
+// MQTT client without a broker, keeps the last message published
+#ifndef HOST_PUBSUBCLIENT_H
+#define HOST_PUBSUBCLIENT_H
+
+#include <Arduino.h>
+#include <string>
+
+class PubSubClient {
+public:
+    bool online = true;     // What connected() reports
+    bool refuse = false;    // Fail every publish, e.g. a full socket
+    uint32_t published = 0;
+    std::string topic;
+    std::string payload;
+
+    bool connected() { return online; }
+    bool publish(const char* to, const uint8_t* data, unsigned int len) {
+        if (!online || refuse) return false;
+        topic = to;
+        payload.assign((const char*)data, len);
+        published++;
+        return true;
+    }
+    bool publish(const char* to, const char* data) { return publish(to, (const uint8_t*)data, strlen(data)); }
+};
+
+#endif // HOST_PUBSUBCLIENT_H
@@ -0,0 +1,28 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0
+#define MSBFIRST 1
+
+struct SPISettings {
+    SPISettings() {}
+    SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+public:
+    void begin() {}
+    void begin(int, int, int, int) {}
+    void beginTransaction(SPISettings) {}
+    void endTransaction() {}
+    uint8_t transfer(uint8_t) { return 0; }
+    uint16_t transfer16(uint16_t) { return 0; }
+    void transfer(void*, uint32_t) {}
+    void setFrequency(uint32_t) {}
+};
+
+static SPIClass SPI; // The tests build TFT_eSPI in their own translation unit
+
+#endif // HOST_SPI_H
@@ -0,0 +1,8 @@
+// Only included for the driver headers, the host tests never associate
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+#include <esp_wifi.h>
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,9 @@
+#ifndef HOST_ESP_BT_H
+#define HOST_ESP_BT_H
+
+#include <esp_err.h>
+
+inline bool btStarted() { return true; }
+inline bool btStart() { return true; }
+
+#endif // HOST_ESP_BT_H
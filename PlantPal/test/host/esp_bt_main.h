@@ -0,0 +1,16 @@
+#ifndef HOST_ESP_BT_MAIN_H
+#define HOST_ESP_BT_MAIN_H
+
+#include <esp_err.h>
+
+typedef enum {
+    ESP_BLUEDROID_STATUS_UNINITIALIZED = 0,
+    ESP_BLUEDROID_STATUS_INITIALIZED,
+    ESP_BLUEDROID_STATUS_ENABLED,
+} esp_bluedroid_status_t;
+
+inline esp_bluedroid_status_t esp_bluedroid_get_status() { return ESP_BLUEDROID_STATUS_ENABLED; }
+inline esp_err_t esp_bluedroid_init() { return ESP_OK; }
+inline esp_err_t esp_bluedroid_enable() { return ESP_OK; }
+
+#endif // HOST_ESP_BT_MAIN_H
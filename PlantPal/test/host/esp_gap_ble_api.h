@@ -0,0 +1,168 @@
+// Bluedroid GAP API with a controller that completes every request at once,
+// the completion event is raised before the call returns. hostGap records
+// what was configured and feeds scan results to the registered callback.
+#ifndef HOST_ESP_GAP_BLE_API_H
+#define HOST_ESP_GAP_BLE_API_H
+
+#include <stdint.h>
+#include <string.h>
+#include <esp_err.h>
+
+typedef uint8_t esp_bd_addr_t[6];
+
+typedef enum { ESP_BT_STATUS_SUCCESS = 0, ESP_BT_STATUS_FAIL } esp_bt_status_t;
+typedef enum { ADV_TYPE_IND = 0, ADV_TYPE_DIRECT_IND_HIGH, ADV_TYPE_SCAN_IND, ADV_TYPE_NONCONN_IND } esp_ble_adv_type_t;
+typedef enum { BLE_ADDR_TYPE_PUBLIC = 0, BLE_ADDR_TYPE_RANDOM } esp_ble_addr_type_t;
+typedef enum { ADV_CHNL_37 = 1, ADV_CHNL_38 = 2, ADV_CHNL_39 = 4, ADV_CHNL_ALL = 7 } esp_ble_adv_channel_t;
+typedef enum { ADV_FILTER_ALLOW_SCAN_ANY_CON_ANY = 0 } esp_ble_adv_filter_t;
+typedef enum { BLE_SCAN_TYPE_PASSIVE = 0, BLE_SCAN_TYPE_ACTIVE } esp_ble_scan_type_t;
+typedef enum {
+    BLE_SCAN_FILTER_ALLOW_ALL = 0,
+    BLE_SCAN_FILTER_ALLOW_ONLY_WLST,
+    BLE_SCAN_FILTER_ALLOW_UND_RPA_DIR,
+    BLE_SCAN_FILTER_ALLOW_WLIST_RPA_DIR,
+} esp_ble_scan_filter_t;
+typedef enum { BLE_SCAN_DUPLICATE_DISABLE = 0, BLE_SCAN_DUPLICATE_ENABLE } esp_ble_scan_duplicate_t;
+typedef enum { BLE_WL_ADDR_TYPE_PUBLIC = 0, BLE_WL_ADDR_TYPE_RANDOM } esp_ble_wl_addr_type_t;
+
+typedef struct {
+    uint16_t adv_int_min;
+    uint16_t adv_int_max;
+    esp_ble_adv_type_t adv_type;
+    esp_ble_addr_type_t own_addr_type;
+    esp_bd_addr_t peer_addr;
+    esp_ble_addr_type_t peer_addr_type;
+    esp_ble_adv_channel_t channel_map;
+    esp_ble_adv_filter_t adv_filter_policy;
+} esp_ble_adv_params_t;
+
+typedef struct {
+    esp_ble_scan_type_t scan_type;
+    esp_ble_addr_type_t own_addr_type;
+    esp_ble_scan_filter_t scan_filter_policy;
+    uint16_t scan_interval;
+    uint16_t scan_window;
+    esp_ble_scan_duplicate_t scan_duplicate;
+} esp_ble_scan_params_t;
+
+typedef enum {
+    ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT = 2,
+    ESP_GAP_BLE_SCAN_RESULT_EVT = 3,
+    ESP_GAP_BLE_ADV_DATA_RAW_SET_COMPLETE_EVT = 4,
+    ESP_GAP_BLE_ADV_START_COMPLETE_EVT = 6,
+    ESP_GAP_BLE_SCAN_START_COMPLETE_EVT = 7,
+    ESP_GAP_BLE_ADV_STOP_COMPLETE_EVT = 17,
+    ESP_GAP_BLE_SCAN_STOP_COMPLETE_EVT = 18,
+} esp_gap_ble_cb_event_t;
+
+typedef enum { ESP_GAP_SEARCH_INQ_RES_EVT = 0, ESP_GAP_SEARCH_INQ_CMPL_EVT } esp_gap_search_evt_t;
+
+typedef union {
+    struct {
+        esp_gap_search_evt_t search_evt;
+        esp_bd_addr_t bda;
+        int rssi;
+        uint8_t ble_adv[62];
+        uint8_t adv_data_len;
+        uint8_t scan_rsp_len;
+    } scan_rst;
+    struct {
+        esp_bt_status_t status;
+    } adv_data_raw_cmpl, scan_param_cmpl, adv_start_cmpl, scan_start_cmpl, scan_stop_cmpl;
+} esp_ble_gap_cb_param_t;
+
+typedef void (*esp_gap_ble_cb_t)(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
+
+struct hostGap {
+    esp_gap_ble_cb_t callback = nullptr;
+    uint8_t adv[31];
+    uint32_t advLen = 0;
+    bool advertising = false;
+    bool scanning = false;
+    uint32_t advStarts = 0;
+    uint32_t scanStarts = 0;
+    uint32_t scanStops = 0;
+    int whitelist = 0; // Entries in the controller whitelist
+    esp_ble_adv_params_t advParams;
+    esp_ble_scan_params_t scanParams;
+
+    static hostGap& get() {
+        static hostGap gap;
+        return gap;
+    }
+
+    void complete(esp_gap_ble_cb_event_t event) {
+        esp_ble_gap_cb_param_t param;
+        memset(&param, 0, sizeof(param));
+        param.adv_data_raw_cmpl.status = ESP_BT_STATUS_SUCCESS; // Every completion starts with its status
+        if (callback) callback(event, &param);
+    }
+
+    /** @brief An advertisement heard by the scanner */
+    void result(const uint8_t* bda, int rssi, const uint8_t* data, uint8_t len) {
+        esp_ble_gap_cb_param_t param;
+        memset(&param, 0, sizeof(param));
+        param.scan_rst.search_evt = ESP_GAP_SEARCH_INQ_RES_EVT;
+        memcpy(param.scan_rst.bda, bda, sizeof(esp_bd_addr_t));
+        param.scan_rst.rssi = rssi;
+        memcpy(param.scan_rst.ble_adv, data, len);
+        param.scan_rst.adv_data_len = len;
+        if (callback && scanning) callback(ESP_GAP_BLE_SCAN_RESULT_EVT, &param);
+    }
+};
+
+inline esp_err_t esp_ble_gap_register_callback(esp_gap_ble_cb_t callback) {
+    hostGap::get().callback = callback;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ble_gap_config_adv_data_raw(uint8_t* data, uint32_t len) {
+    if (len > sizeof(hostGap::get().adv)) return ESP_FAIL;
+    memcpy(hostGap::get().adv, data, len);
+    hostGap::get().advLen = len;
+    hostGap::get().complete(ESP_GAP_BLE_ADV_DATA_RAW_SET_COMPLETE_EVT);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ble_gap_start_advertising(esp_ble_adv_params_t* params) {
+    hostGap::get().advParams = *params;
+    hostGap::get().advertising = true;
+    hostGap::get().advStarts++;
+    hostGap::get().complete(ESP_GAP_BLE_ADV_START_COMPLETE_EVT);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ble_gap_stop_advertising() {
+    hostGap::get().advertising = false;
+    hostGap::get().complete(ESP_GAP_BLE_ADV_STOP_COMPLETE_EVT);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ble_gap_set_scan_params(esp_ble_scan_params_t* params) {
+    // Refused while scanning, as by the controller
+    if (hostGap::get().scanning) return ESP_FAIL;
+    hostGap::get().scanParams = *params;
+    hostGap::get().complete(ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ble_gap_start_scanning(uint32_t) {
+    hostGap::get().scanning = true;
+    hostGap::get().scanStarts++;
+    hostGap::get().complete(ESP_GAP_BLE_SCAN_START_COMPLETE_EVT);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ble_gap_stop_scanning() {
+    hostGap::get().scanning = false;
+    hostGap::get().scanStops++;
+    hostGap::get().complete(ESP_GAP_BLE_SCAN_STOP_COMPLETE_EVT);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ble_gap_update_whitelist(bool add, esp_bd_addr_t, esp_ble_wl_addr_type_t) {
+    hostGap::get().whitelist += add ? 1 : -1;
+    return ESP_OK;
+}
+
+#endif // HOST_ESP_GAP_BLE_API_H
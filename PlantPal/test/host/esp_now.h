@@ -0,0 +1,67 @@
+// ESP-NOW driver with an in-memory peer list, enough for omegaNowPeers
+#ifndef HOST_ESP_NOW_H
+#define HOST_ESP_NOW_H
+
+#include <stdint.h>
+#include <string.h>
+#include <esp_err.h>
+#include <esp_wifi.h>
+
+#define ESP_NOW_ETH_ALEN 6
+#define ESP_NOW_MAX_DATA_LEN 250
+#define ESP_NOW_MAX_TOTAL_PEER_NUM 20
+
+typedef enum { ESP_NOW_SEND_SUCCESS = 0, ESP_NOW_SEND_FAIL } esp_now_send_status_t;
+
+typedef struct {
+    uint8_t peer_addr[ESP_NOW_ETH_ALEN];
+    uint8_t channel;
+    wifi_interface_t ifidx;
+    bool encrypt;
+} esp_now_peer_info_t;
+
+typedef void (*esp_now_recv_cb_t)(const uint8_t* mac, const uint8_t* data, int len);
+typedef void (*esp_now_send_cb_t)(const uint8_t* mac, esp_now_send_status_t status);
+
+struct hostNowPeers {
+    uint8_t mac[ESP_NOW_MAX_TOTAL_PEER_NUM][ESP_NOW_ETH_ALEN];
+    bool used[ESP_NOW_MAX_TOTAL_PEER_NUM];
+
+    static hostNowPeers& get() {
+        static hostNowPeers table;
+        return table;
+    }
+    int find(const uint8_t* addr) {
+        for (int i = 0; i < ESP_NOW_MAX_TOTAL_PEER_NUM; i++) {
+            if (used[i] && memcmp(mac[i], addr, ESP_NOW_ETH_ALEN) == 0) return i;
+        }
+        return -1;
+    }
+};
+
+inline esp_err_t esp_now_init() { return ESP_OK; }
+inline esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t) { return ESP_OK; }
+inline esp_err_t esp_now_register_send_cb(esp_now_send_cb_t) { return ESP_OK; }
+inline esp_err_t esp_now_send(const uint8_t*, const uint8_t*, size_t) { return ESP_OK; }
+inline bool esp_now_is_peer_exist(const uint8_t* addr) { return hostNowPeers::get().find(addr) >= 0; }
+
+inline esp_err_t esp_now_add_peer(const esp_now_peer_info_t* info) {
+    hostNowPeers& t = hostNowPeers::get();
+    if (t.find(info->peer_addr) >= 0) return ESP_FAIL;
+    for (int i = 0; i < ESP_NOW_MAX_TOTAL_PEER_NUM; i++) {
+        if (t.used[i]) continue;
+        memcpy(t.mac[i], info->peer_addr, ESP_NOW_ETH_ALEN);
+        t.used[i] = true;
+        return ESP_OK;
+    }
+    return ESP_FAIL;
+}
+
+inline esp_err_t esp_now_del_peer(const uint8_t* addr) {
+    int i = hostNowPeers::get().find(addr);
+    if (i < 0) return ESP_FAIL;
+    hostNowPeers::get().used[i] = false;
+    return ESP_OK;
+}
+
+#endif // HOST_ESP_NOW_H
@@ -0,0 +1,13 @@
+#ifndef HOST_SEMPHR_H
+#define HOST_SEMPHR_H
+
+#include <freertos/FreeRTOS.h>
+
+typedef void* SemaphoreHandle_t;
+
+// Single threaded, a mutex is always free
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return (SemaphoreHandle_t)1; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+
+#endif // HOST_SEMPHR_H
@@ -0,0 +1,61 @@
+// NVS blobs kept in memory for the lifetime of the test
+#ifndef HOST_NVS_H
+#define HOST_NVS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+#include <esp_err.h>
+
+typedef uint32_t nvs_handle_t;
+typedef enum { NVS_READONLY, NVS_READWRITE } nvs_open_mode_t;
+
+struct hostNvs {
+    std::map<std::string, std::vector<uint8_t> > blobs;
+    std::map<nvs_handle_t, std::string> spaces;
+    nvs_handle_t next = 1;
+    uint32_t writes = 0; // Blobs set or erased, what the tests count flash wear by
+
+    static hostNvs& get() {
+        static hostNvs store;
+        return store;
+    }
+    std::string key(nvs_handle_t h, const char* k) { return spaces[h] + "/" + k; }
+};
+
+inline esp_err_t nvs_open(const char* space, nvs_open_mode_t, nvs_handle_t* h) {
+    *h = hostNvs::get().next++;
+    hostNvs::get().spaces[*h] = space;
+    return ESP_OK;
+}
+inline void nvs_close(nvs_handle_t h) { hostNvs::get().spaces.erase(h); }
+inline esp_err_t nvs_commit(nvs_handle_t) { return ESP_OK; }
+
+inline esp_err_t nvs_set_blob(nvs_handle_t h, const char* k, const void* data, size_t len) {
+    hostNvs& s = hostNvs::get();
+    s.blobs[s.key(h, k)].assign((const uint8_t*)data, (const uint8_t*)data + len);
+    s.writes++;
+    return ESP_OK;
+}
+
+inline esp_err_t nvs_get_blob(nvs_handle_t h, const char* k, void* data, size_t* len) {
+    hostNvs& s = hostNvs::get();
+    std::map<std::string, std::vector<uint8_t> >::iterator it = s.blobs.find(s.key(h, k));
+    if (it == s.blobs.end()) return ESP_ERR_NVS_NOT_FOUND;
+    if (data && *len < it->second.size()) return ESP_ERR_NVS_INVALID_LENGTH;
+    if (data) memcpy(data, it->second.data(), it->second.size());
+    *len = it->second.size();
+    return ESP_OK;
+}
+
+inline esp_err_t nvs_erase_key(nvs_handle_t h, const char* k) {
+    hostNvs& s = hostNvs::get();
+    if (!s.blobs.erase(s.key(h, k))) return ESP_ERR_NVS_NOT_FOUND;
+    s.writes++;
+    return ESP_OK;
+}
+
+#endif // HOST_NVS_H
@@ -0,0 +1,8 @@
+#ifndef HOST_NVS_FLASH_H
+#define HOST_NVS_FLASH_H
+
+#include <nvs.h>
+
+inline esp_err_t nvs_flash_init() { return ESP_OK; }
+
+#endif // HOST_NVS_FLASH_H
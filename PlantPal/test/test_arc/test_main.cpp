@@ -0,0 +1,243 @@
+// drawArc against the float implementation it replaced, pixel for pixel, and
+// the arcSlope table against the formula it was generated from.
+//   pio test -e native -f test_arc -v
+#include <unity.h>
+#include <TFT_eSPI.cpp> // The whole library in this translation unit, for its static helpers
+
+TFT_eSPI tft;
+
+// Same expression the float drawArc used for the slope of an arc end
+static uint32_t floatSlope(uint32_t angle) {
+  constexpr float minDivisor = 1.0f/0x8000;
+  float fabscos = fabsf(cosf(angle * deg2rad));
+  float fabssin = fabsf(sinf(angle * deg2rad));
+  return (uint32_t)((fabscos/(fabssin + minDivisor)) * (float)(1UL<<16));
+}
+
+// TFT_eSPI::sqrt_fraction is private, same fixed point square root fraction
+static uint8_t refSqrt(uint32_t num) {
+  if (num > (0x40000000)) return 0;
+  uint32_t bsh = 0x00004000;
+  uint32_t fpr = 0;
+  uint32_t osh = 0;
+
+  while (num>bsh) {bsh <<= 2; osh++;}
+
+  do {
+    uint32_t bod = bsh + fpr;
+    if(num >= bod)
+    {
+      num -= bod;
+      fpr = bsh + bod;
+    }
+    num <<= 1;
+  } while(bsh >>= 1);
+
+  return fpr>>osh;
+}
+
+// drawArc as it was before the integer scan, the reference for the new one
+class floatArcSprite : public TFT_eSprite {
+public:
+  floatArcSprite(TFT_eSPI* tft) : TFT_eSprite(tft) {}
+
+  void drawFloatArc(int32_t x, int32_t y, int32_t r, int32_t ir,
+                    uint32_t startAngle, uint32_t endAngle,
+                    uint32_t fg_color, uint32_t bg_color, bool smooth)
+  {
+    if (endAngle   > 360)   endAngle = 360;
+    if (startAngle > 360) startAngle = 360;
+    if (_vpOoB || startAngle == endAngle) return;
+    if (r < ir) transpose(r, ir);
+    if (r <= 0 || ir < 0) return;
+
+    if (endAngle < startAngle) {
+      if (startAngle < 360) drawFloatArc(x, y, r, ir, startAngle, 360, fg_color, bg_color, smooth);
+      if (endAngle == 0) return;
+      startAngle = 0;
+    }
+
+    int32_t xs = 0;
+    uint8_t alpha = 0;
+
+    uint32_t r2 = r * r;
+    if (smooth) r++;
+    uint32_t r1 = r * r;
+    int16_t w  = r - ir;
+    uint32_t r3 = ir * ir;
+    if (smooth) ir--;
+    uint32_t r4 = ir * ir;
+
+    uint32_t startSlope[4] = {0, 0, 0xFFFFFFFF, 0};
+    uint32_t   endSlope[4] = {0, 0xFFFFFFFF, 0, 0};
+
+    uint32_t slope = floatSlope(startAngle);
+    if (startAngle <= 90) {
+      startSlope[0] =  slope;
+    }
+    else if (startAngle <= 180) {
+      startSlope[1] =  slope;
+    }
+    else if (startAngle <= 270) {
+      startSlope[1] = 0xFFFFFFFF;
+      startSlope[2] = slope;
+    }
+    else {
+      startSlope[1] = 0xFFFFFFFF;
+      startSlope[2] =  0;
+      startSlope[3] = slope;
+    }
+
+    slope = floatSlope(endAngle);
+    if (endAngle <= 90) {
+      endSlope[0] = slope;
+      endSlope[1] =  0;
+      startSlope[2] =  0;
+    }
+    else if (endAngle <= 180) {
+      endSlope[1] = slope;
+      startSlope[2] =  0;
+    }
+    else if (endAngle <= 270) {
+      endSlope[2] =  slope;
+    }
+    else {
+      endSlope[3] =  slope;
+    }
+
+    for (int32_t cy = r - 1; cy > 0; cy--)
+    {
+      uint32_t len[4] = { 0,  0,  0,  0};
+      int32_t  xst[4] = {-1, -1, -1, -1};
+      uint32_t dy2 = (r - cy) * (r - cy);
+
+      while ((r - xs) * (r - xs) + dy2 >= r1) xs++;
+
+      for (int32_t cx = xs; cx < r; cx++)
+      {
+        uint32_t hyp = (r - cx) * (r - cx) + dy2;
+
+        if (hyp > r2) {
+          alpha = ~refSqrt(hyp);
+        }
+        else if (hyp >= r3) {
+          slope = ((r - cy) << 16)/(r - cx);
+          if (slope <= startSlope[0] && slope >= endSlope[0]) { xst[0] = cx; len[0]++; }
+          if (slope >= startSlope[1] && slope <= endSlope[1]) { xst[1] = cx; len[1]++; }
+          if (slope <= startSlope[2] && slope >= endSlope[2]) { xst[2] = cx; len[2]++; }
+          if (slope <= endSlope[3] && slope >= startSlope[3]) { xst[3] = cx; len[3]++; }
+          continue;
+        }
+        else {
+          if (hyp <= r4) break;
+          alpha = refSqrt(hyp);
+        }
+
+        if (alpha < 16) continue;
+
+        uint16_t pcol = fastBlend(alpha, fg_color, bg_color);
+        slope = ((r - cy)<<16)/(r - cx);
+        if (slope <= startSlope[0] && slope >= endSlope[0]) drawPixel(x + cx - r, y - cy + r, pcol);
+        if (slope >= startSlope[1] && slope <= endSlope[1]) drawPixel(x + cx - r, y + cy - r, pcol);
+        if (slope <= startSlope[2] && slope >= endSlope[2]) drawPixel(x - cx + r, y + cy - r, pcol);
+        if (slope <= endSlope[3] && slope >= startSlope[3]) drawPixel(x - cx + r, y - cy + r, pcol);
+      }
+      if (len[0]) drawFastHLine(x + xst[0] - len[0] + 1 - r, y - cy + r, len[0], fg_color);
+      if (len[1]) drawFastHLine(x + xst[1] - len[1] + 1 - r, y + cy - r, len[1], fg_color);
+      if (len[2]) drawFastHLine(x - xst[2] + r, y + cy - r, len[2], fg_color);
+      if (len[3]) drawFastHLine(x - xst[3] + r, y - cy + r, len[3], fg_color);
+    }
+
+    if (startAngle ==   0 || endAngle == 360) drawFastVLine(x, y + r - w, w, fg_color);
+    if (startAngle <=  90 && endAngle >=  90) drawFastHLine(x - r + 1, y, w, fg_color);
+    if (startAngle <= 180 && endAngle >= 180) drawFastVLine(x, y - r + 1, w, fg_color);
+    if (startAngle <= 270 && endAngle >= 270) drawFastHLine(x + r - w, y, w, fg_color);
+  }
+};
+
+#define ARC_SPRITE 240
+#define ARC_CASES 50000
+#define ARC_BENCH_RUNS 2000
+
+floatArcSprite newArc(&tft), oldArc(&tft);
+
+void setUp() {}
+void tearDown() {}
+
+// A mismatch prints the regenerated table, paste it over arcSlope in TFT_eSPI.cpp.
+// This compares against the host's libm (glibc), newlib on the device may differ in the last bit.
+void test_arc_slope_table() {
+  uint32_t bad = 0;
+  for (uint32_t a = 0; a <= 360; a++) {
+    if (pgm_read_dword(&arcSlope[a]) != floatSlope(a)) bad++;
+  }
+  if (bad) {
+    printf("static const uint32_t arcSlope[361] PROGMEM = {");
+    for (uint32_t a = 0; a <= 360; a++) {
+      if (a % 6 == 0) printf("\n  ");
+      printf("0x%08X%s", floatSlope(a), a < 360 ? ", " : "");
+    }
+    printf("\n};\n");
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, bad);
+}
+
+// Random arcs, also off the sprite, clipped by a viewport and sweeping through 0
+void test_arc_matches_float() {
+  srand(46);
+  uint32_t bad = 0;
+  for (uint32_t i = 0; i < ARC_CASES; i++) {
+    int32_t x = rand() % 320 - 40, y = rand() % 320 - 40;
+    int32_t r = rand() % 130, ir = rand() % 130;
+    if (i % 3 == 0) ir = r - rand() % 12;
+    uint32_t s = rand() % 380, e = rand() % 380;
+    if (i % 11 == 0) { s = 0; e = 360; }
+    if (i % 13 == 0) s = (rand() % 5) * 90;
+    if (i % 17 == 0) e = (rand() % 5) * 90;
+    bool smooth = rand() % 4;
+    uint16_t fg = rand(), bg = rand();
+
+    newArc.fillSprite(0x1234);
+    oldArc.fillSprite(0x1234);
+    if (i % 9 == 0) {
+      newArc.setViewport(20, 30, 150, 100);
+      oldArc.setViewport(20, 30, 150, 100);
+    }
+    newArc.drawArc(x, y, r, ir, s, e, fg, bg, smooth);
+    oldArc.drawFloatArc(x, y, r, ir, s, e, fg, bg, smooth);
+    newArc.resetViewport();
+    oldArc.resetViewport();
+
+    if (memcmp(newArc.getPointer(), oldArc.getPointer(), ARC_SPRITE * ARC_SPRITE * 2)) {
+      if (bad++ < 5) printf("mismatch at %d,%d r %d ir %d %u..%u smooth %d\n", x, y, r, ir, s, e, smooth);
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, bad);
+}
+
+// The gauge arcs of the plant screen, thin and thick, short and full
+void test_arc_benchmark() {
+  const struct { int32_t r, ir; uint32_t s, e; } arcs[] = {
+    {118, 110, 229, 310}, {16, 14, 45, 316}, {106, 102, 229, 250}, {100, 60, 0, 360}, {119, 0, 10, 200}
+  };
+  for (uint8_t i = 0; i < sizeof(arcs) / sizeof(arcs[0]); i++) {
+    unsigned long t0 = micros();
+    for (int n = 0; n < ARC_BENCH_RUNS; n++) oldArc.drawFloatArc(120, 120, arcs[i].r, arcs[i].ir, arcs[i].s, arcs[i].e, TFT_WHITE, TFT_BLACK, true);
+    unsigned long t1 = micros();
+    for (int n = 0; n < ARC_BENCH_RUNS; n++) newArc.drawArc(120, 120, arcs[i].r, arcs[i].ir, arcs[i].s, arcs[i].e, TFT_WHITE, TFT_BLACK, true);
+    unsigned long t2 = micros();
+    printf("r %3d ir %3d %3u..%3u: float %7.2f us, integer %7.2f us\n", arcs[i].r, arcs[i].ir, arcs[i].s, arcs[i].e,
+           (float)(t1 - t0) / ARC_BENCH_RUNS, (float)(t2 - t1) / ARC_BENCH_RUNS);
+  }
+}
+
+int main() {
+  newArc.createSprite(ARC_SPRITE, ARC_SPRITE);
+  oldArc.createSprite(ARC_SPRITE, ARC_SPRITE);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_arc_slope_table);
+  RUN_TEST(test_arc_matches_float);
+  RUN_TEST(test_arc_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,231 @@
+// Plant beacons against the host GAP controller in test/host: the
+// advertising data, the beacon's GAP event flow, and the scanner's duplicate
+// table, whitelist and duty cycle.
+//   pio test -e native -f test_ble -v
+#define CONFIG_BLUEDROID_ENABLED 1
+#include <unity.h>
+#include <omegaBLE.cpp> // The beacon and the scanner in this translation unit
+#include <omegaBLEScanner.cpp>
+
+// Bluedroid takes a fixed number of GAP handlers, one beacon and one scanner for all tests
+omegaBLEBeacon beacon;
+omegaBLEScanner scanner;
+
+struct heardBeacon {
+    uint32_t count = 0;
+    int8_t rssi = 0;
+    bleBeaconData data;
+};
+
+static void onBeacon(const uint8_t*, int8_t rssi, const bleBeaconData& data, void* ctx) {
+    heardBeacon* h = static_cast<heardBeacon*>(ctx);
+    h->count++;
+    h->rssi = rssi;
+    h->data = data;
+}
+
+static plantState sample(uint16_t id, uint8_t xp) {
+    plantState s = {};
+    s.plantID = id;
+    s.curXP = xp;
+    s.curMood = 3;
+    s.curData.moisture = 55;
+    s.curData.temperature = 21;
+    return s;
+}
+
+// Advertisement of pot n with a sample numbered seq, as heard by the scanner
+static void advertise(uint8_t n, uint8_t seq, bool foreign = false) {
+    bleBeaconData data;
+    data.seq = seq;
+    data.state = sample(0x5100 + n, seq);
+    uint8_t adv[BLE_ADV_MAX];
+    uint8_t len = data.encode(adv, sizeof(adv));
+    if (foreign) adv[5] = 0x4C; // Another company id
+    const uint8_t pot[6] = {0x24, 0x0A, 0xC4, 0x00, 0x01, n};
+    hostGap::get().result(pot, -70, adv, len);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_ble_beacon_roundtrip() {
+    bleBeaconData out;
+    out.seq = 42;
+    out.state = sample(0x5012, 7);
+
+    uint8_t adv[BLE_ADV_MAX];
+    uint8_t len = out.encode(adv, sizeof(adv));
+    TEST_ASSERT_EQUAL_UINT8(3 + 2 + BLE_BEACON_DATA_SIZE, len);
+    TEST_ASSERT_LESS_OR_EQUAL(BLE_ADV_MAX, len);
+    TEST_ASSERT_EQUAL_UINT8(0, out.encode(adv, len - 1));
+
+    bleBeaconData in;
+    TEST_ASSERT_TRUE(in.decode(adv, len));
+    TEST_ASSERT_EQUAL_UINT8(42, in.seq);
+    TEST_ASSERT_EQUAL_UINT16(0x5012, in.state.plantID);
+    TEST_ASSERT_EQUAL_UINT8(7, in.state.curXP);
+    TEST_ASSERT_EQUAL_UINT8(3, in.state.curMood);
+    TEST_ASSERT_EQUAL_UINT8(55, in.state.curData.moisture);
+    TEST_ASSERT_EQUAL_UINT8(21, in.state.curData.temperature);
+}
+
+void test_ble_beacon_decode_rejects() {
+    bleBeaconData out;
+    out.seq = 1;
+    out.state = sample(0x5012, 7);
+    uint8_t adv[BLE_ADV_MAX + 5];
+
+    // The beacon need not be the first AD structure
+    const uint8_t name[] = {4, 0x09, 'a', 'b', 'c'};
+    memcpy(adv, name, sizeof(name));
+    uint8_t len = sizeof(name) + out.encode(adv + sizeof(name), BLE_ADV_MAX);
+    bleBeaconData in;
+    TEST_ASSERT_TRUE(in.decode(adv, len));
+
+    // A cut advertisement, another company id or another version is no beacon
+    TEST_ASSERT_FALSE(in.decode(adv, len - 1));
+    uint8_t* manufacturer = adv + sizeof(name) + 3;
+    manufacturer[2] = 0x4C;
+    TEST_ASSERT_FALSE(in.decode(adv, len));
+    manufacturer[2] = BLE_COMPANY_ID & 0xFF;
+    manufacturer[4] = BLE_BEACON_VERSION + 1;
+    TEST_ASSERT_FALSE(in.decode(adv, len));
+
+    // A zero length structure ends the walk
+    const uint8_t empty[] = {0, 0, 0};
+    TEST_ASSERT_FALSE(in.decode(empty, sizeof(empty)));
+}
+
+void test_ble_beacon_advertises_updates() {
+    hostGap& gap = hostGap::get();
+    TEST_ASSERT_FALSE(beacon.update(sample(0x5012, 1))); // Not started
+    TEST_ASSERT_TRUE(beacon.begin());
+    TEST_ASSERT_FALSE(beacon.isAdvertising());
+
+    // Advertising starts once the first data is set, non-connectable
+    TEST_ASSERT_TRUE(beacon.update(sample(0x5012, 1)));
+    TEST_ASSERT_TRUE(beacon.isAdvertising());
+    TEST_ASSERT_EQUAL_UINT32(1, gap.advStarts);
+    TEST_ASSERT_EQUAL(ADV_TYPE_NONCONN_IND, gap.advParams.adv_type);
+    TEST_ASSERT_EQUAL_UINT16(BLE_ADV_INTERVAL * 8 / 5, gap.advParams.adv_int_min);
+
+    bleBeaconData first;
+    TEST_ASSERT_TRUE(first.decode(gap.adv, gap.advLen));
+
+    // Later samples only swap the data, with the next sequence number
+    TEST_ASSERT_TRUE(beacon.update(sample(0x5012, 2)));
+    TEST_ASSERT_EQUAL_UINT32(1, gap.advStarts);
+    bleBeaconData second;
+    TEST_ASSERT_TRUE(second.decode(gap.adv, gap.advLen));
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)(first.seq + 1), second.seq);
+    TEST_ASSERT_EQUAL_UINT8(2, second.state.curXP);
+
+    beacon.stop();
+    TEST_ASSERT_FALSE(beacon.isAdvertising());
+    TEST_ASSERT_FALSE(gap.advertising);
+}
+
+void test_ble_scanner_delivers_beacon() {
+    hostGap& gap = hostGap::get();
+    heardBeacon heard;
+    scanner.onBeacon(onBeacon, &heard);
+    TEST_ASSERT_TRUE(scanner.begin());
+    TEST_ASSERT_TRUE(scanner.isScanning());
+    TEST_ASSERT_EQUAL(BLE_SCAN_TYPE_PASSIVE, gap.scanParams.scan_type);
+
+    TEST_ASSERT_TRUE(beacon.update(sample(0x5013, 9)));
+    const uint8_t pot[6] = {0x24, 0x0A, 0xC4, 0x00, 0x00, 0x01};
+    gap.result(pot, -60, gap.adv, gap.advLen);
+    TEST_ASSERT_EQUAL_UINT32(1, heard.count);
+    TEST_ASSERT_EQUAL_INT8(-60, heard.rssi);
+    TEST_ASSERT_EQUAL_UINT16(0x5013, heard.data.state.plantID);
+    TEST_ASSERT_EQUAL_UINT8(9, heard.data.state.curXP);
+    TEST_ASSERT_EQUAL_UINT32(1, scanner.stats.beacons);
+}
+
+void test_ble_scanner_dedup() {
+    heardBeacon heard;
+    scanner.onBeacon(onBeacon, &heard);
+    bleScanStats before = scanner.stats;
+
+    // Every advert is repeated until the next sample, it is delivered once
+    advertise(1, 10);
+    advertise(1, 10);
+    advertise(1, 11);
+    advertise(1, 11, true);
+    TEST_ASSERT_EQUAL_UINT32(2, heard.count);
+    TEST_ASSERT_EQUAL_UINT8(11, heard.data.state.curXP);
+    TEST_ASSERT_EQUAL_UINT32(before.adverts + 4, scanner.stats.adverts);
+    TEST_ASSERT_EQUAL_UINT32(before.duplicates + 1, scanner.stats.duplicates);
+    TEST_ASSERT_EQUAL_UINT32(before.foreign + 1, scanner.stats.foreign);
+}
+
+void test_ble_scanner_evicts_stalest() {
+    hostGap& gap = hostGap::get();
+    heardBeacon heard;
+    scanner.onBeacon(onBeacon, &heard);
+
+    // More pots than tracked, each heard a little later than the one before
+    const uint8_t pots = BLE_MAX_BEACONS + 8;
+    for (uint8_t n = 0; n < pots; n++) {
+        hostAdvance(1);
+        advertise(100 + n, 1);
+    }
+    TEST_ASSERT_EQUAL_UINT32(pots, heard.count);
+    // Evicted pots leave the whitelist and make room for new ones
+    TEST_ASSERT_EQUAL_INT(BLE_WHITELIST_SIZE, gap.whitelist);
+
+    // The first pots were evicted and their sample counts as new, the last are still known
+    advertise(100, 1);
+    advertise(100 + pots - 1, 1);
+    TEST_ASSERT_EQUAL_UINT32(pots + 1, heard.count);
+    TEST_ASSERT_EQUAL_INT(BLE_WHITELIST_SIZE, gap.whitelist);
+}
+
+void test_ble_scanner_duty_cycle() {
+    hostGap& gap = hostGap::get();
+    TEST_ASSERT_TRUE(scanner.isScanning());
+
+    // A running scan is stopped and restarted with the new parameters
+    uint32_t stops = gap.scanStops;
+    uint32_t starts = gap.scanStarts;
+    TEST_ASSERT_TRUE(scanner.setMode(BLE_SCAN_LOW_POWER));
+    TEST_ASSERT_EQUAL_UINT32(stops + 1, gap.scanStops);
+    TEST_ASSERT_EQUAL_UINT32(starts + 1, gap.scanStarts);
+    TEST_ASSERT_TRUE(scanner.isScanning());
+    TEST_ASSERT_EQUAL_UINT16(BLE_SCAN_INTERVAL * 10 * 8 / 5, gap.scanParams.scan_interval);
+    TEST_ASSERT_EQUAL_UINT16(BLE_SCAN_INTERVAL * 8 / 5, gap.scanParams.scan_window);
+    TEST_ASSERT_EQUAL(BLE_SCAN_DUPLICATE_DISABLE, gap.scanParams.scan_duplicate);
+
+    TEST_ASSERT_FALSE(scanner.setDutyCycle(100, 200));
+    TEST_ASSERT_FALSE(scanner.setDutyCycle(2, 2));
+
+    // Known pots are whitelisted, the controller may drop everything else
+    TEST_ASSERT_TRUE(scanner.setWhitelistOnly(true));
+    TEST_ASSERT_EQUAL(BLE_SCAN_FILTER_ALLOW_ONLY_WLST, gap.scanParams.scan_filter_policy);
+    TEST_ASSERT_TRUE(scanner.setWhitelistOnly(false));
+    TEST_ASSERT_EQUAL(BLE_SCAN_FILTER_ALLOW_ALL, gap.scanParams.scan_filter_policy);
+
+    // Once stopped, new parameters wait for the next begin()
+    scanner.stop();
+    TEST_ASSERT_FALSE(scanner.isScanning());
+    starts = gap.scanStarts;
+    TEST_ASSERT_TRUE(scanner.setMode(BLE_SCAN_BALANCED));
+    TEST_ASSERT_EQUAL_UINT32(starts, gap.scanStarts);
+    TEST_ASSERT_TRUE(scanner.begin());
+    TEST_ASSERT_TRUE(scanner.isScanning());
+    TEST_ASSERT_EQUAL_UINT16(BLE_SCAN_WINDOW * 8 / 5, gap.scanParams.scan_window);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_ble_beacon_roundtrip);
+    RUN_TEST(test_ble_beacon_decode_rejects);
+    RUN_TEST(test_ble_beacon_advertises_updates);
+    RUN_TEST(test_ble_scanner_delivers_beacon);
+    RUN_TEST(test_ble_scanner_dedup);
+    RUN_TEST(test_ble_scanner_evicts_stalest);
+    RUN_TEST(test_ble_scanner_duty_cycle);
+    return UNITY_END();
+}
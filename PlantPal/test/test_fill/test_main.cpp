@@ -0,0 +1,143 @@
+// 16-bit sprite fills with word stores (fill16, fillRect, fillSprite and
+// drawFastHLine) against the same shapes drawn pixel by pixel.
+//   pio test -e native -f test_fill -v
+#include <unity.h>
+#include <TFT_eSPI.cpp> // The whole library in this translation unit, for its static helpers
+
+TFT_eSPI tft;
+TFT_eSprite spr(&tft);
+TFT_eSprite ref(&tft);
+
+// Odd width, so that rows start at alternating 32-bit alignment
+#define FILL_W 239
+#define FILL_H 97
+#define FILL_CASES 20000
+#define FILL_BENCH_RUNS 2000
+
+void setUp() {}
+void tearDown() {}
+
+// Colour with equal bytes (memset) or not (word stores)
+static uint16_t randomColor() {
+  uint8_t b = rand();
+  return (rand() & 3) == 0 ? (b << 8 | b) : rand();
+}
+
+void test_fill16_matches_loop() {
+  srand(48);
+  uint32_t bad = 0;
+  for (uint32_t t = 0; t < FILL_CASES; t++) {
+    uint16_t buf[80], expect[80];
+    uint32_t off = rand() % 4, n = rand() % 72;
+    uint16_t color = randomColor();
+    for (int i = 0; i < 80; i++) buf[i] = expect[i] = rand();
+
+    fill16(buf + off, color, n);
+
+    for (uint32_t i = off; i < off + n; i++) expect[i] = color;
+    // Pixels either side of the run must be untouched too
+    if (memcmp(buf, expect, sizeof buf)) bad++;
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, bad);
+}
+
+// drawPixel clips to the viewport and applies its datum, one pixel at a time
+static void perPixelRect(TFT_eSprite& s, int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+  for (int32_t j = y; j < y + h; j++) {
+    for (int32_t i = x; i < x + w; i++) s.drawPixel(i, j, color);
+  }
+}
+
+static void setViewports(int32_t x, int32_t y, int32_t w, int32_t h, bool datum) {
+  spr.setViewport(x, y, w, h, datum);
+  ref.setViewport(x, y, w, h, datum);
+}
+
+// Random rects, lines and clears in both sprites, some cut by the sprite or viewport edges.
+// fillSprite memsets the whole buffer for colours with equal bytes unless the viewport has
+// its own datum, so clears are left out of viewports without one
+static void fillBoth(uint32_t cases, bool clears = true) {
+  for (uint32_t t = 0; t < cases; t++) {
+    int32_t x = rand() % (FILL_W + 40) - 20;
+    int32_t y = rand() % (FILL_H + 40) - 20;
+    int32_t w = rand() % 64 - 2;
+    int32_t h = rand() % 16 - 2;
+    uint16_t color = randomColor();
+
+    switch (rand() % 8) {
+      case 0: // Full width rows are filled as one run
+        x = 0;
+        w = FILL_W;
+        // fall through
+      case 1:
+      case 2:
+        spr.fillRect(x, y, w, h, color);
+        perPixelRect(ref, x, y, w, h, color);
+        break;
+      case 7:
+        if (clears && t % 64 == 0) {
+          spr.fillSprite(color);
+          perPixelRect(ref, -FILL_W, -FILL_H, 3 * FILL_W, 3 * FILL_H, color);
+          break;
+        }
+        // fall through
+      default:
+        spr.drawFastHLine(x, y, w, color);
+        perPixelRect(ref, x, y, w, 1, color);
+        break;
+    }
+  }
+}
+
+void test_fill_matches_per_pixel() {
+  srand(48);
+  uint16_t* p = (uint16_t*)spr.getPointer();
+  for (int i = 0; i < FILL_W * FILL_H; i++) p[i] = rand();
+  memcpy(ref.getPointer(), spr.getPointer(), FILL_W * FILL_H * 2);
+
+  fillBoth(FILL_CASES);
+  TEST_ASSERT_EQUAL_MEMORY(ref.getPointer(), spr.getPointer(), FILL_W * FILL_H * 2);
+
+  // Viewports with and without their own origin, at odd and even x, one partly and one fully off the sprite
+  setViewports(31, 7, 101, 60, true);
+  fillBoth(FILL_CASES);
+  setViewports(16, 20, 77, 51, false);
+  fillBoth(FILL_CASES, false);
+  setViewports(-9, 50, 150, 100, true);
+  fillBoth(FILL_CASES);
+  setViewports(300, 300, 20, 20, true);
+  fillBoth(FILL_CASES / 10);
+  spr.resetViewport();
+  ref.resetViewport();
+  TEST_ASSERT_EQUAL_MEMORY(ref.getPointer(), spr.getPointer(), FILL_W * FILL_H * 2);
+}
+
+// Every row as a line and a colour clear, per pixel and with word stores
+void test_fill_benchmark() {
+  unsigned long t0 = micros();
+  for (int n = 0; n < FILL_BENCH_RUNS / 10; n++) {
+    for (int y = 0; y < FILL_H; y++) perPixelRect(ref, 0, y, FILL_W, 1, TFT_GOLD);
+  }
+  unsigned long t1 = micros();
+  for (int n = 0; n < FILL_BENCH_RUNS; n++) {
+    for (int y = 0; y < FILL_H; y++) spr.drawFastHLine(0, y, FILL_W, TFT_GOLD);
+  }
+  unsigned long t2 = micros();
+  for (int n = 0; n < FILL_BENCH_RUNS; n++) spr.fillSprite(TFT_GOLD);
+  unsigned long t3 = micros();
+
+  printf("%d lines of %d: per pixel %.2f us, drawFastHLine %.2f us\n", FILL_H, FILL_W,
+         (float)(t1 - t0) * 10 / FILL_BENCH_RUNS, (float)(t2 - t1) / FILL_BENCH_RUNS);
+  printf("fillSprite colour: %.2f us\n", (float)(t3 - t2) / FILL_BENCH_RUNS);
+}
+
+int main() {
+  spr.createSprite(FILL_W, FILL_H);
+  ref.createSprite(FILL_W, FILL_H);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_fill16_matches_loop);
+  RUN_TEST(test_fill_matches_per_pixel);
+  RUN_TEST(test_fill_benchmark);
+  return UNITY_END();
+}
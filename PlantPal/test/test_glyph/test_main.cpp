@@ -0,0 +1,168 @@
+// Smooth font glyphs blended row by row into a 16-bit sprite, against the
+// per-pixel drawGlyph they replace, and the cost of a text heavy screen.
+//   pio test -e native -f test_glyph -v
+#include <unity.h>
+#include <TFT_eSPI.cpp> // The whole library in this translation unit, see test_arc
+#include <NotoSansBold15.h>
+#include <NotoSansMonoSCB20.h>
+
+TFT_eSPI tft;
+TFT_eSprite spr(&tft);
+TFT_eSprite ref(&tft);
+
+#define GLYPH_CASES 4000
+#define GLYPH_BENCH_RUNS 20
+#define TEXT_BENCH_RUNS 300
+
+static const char glyphs[] = "Monstera 23C 61% soil 44% light 812 lx PlantPal 0123456789 Too dark!";
+
+void setUp() {}
+void tearDown() {}
+
+// drawGlyph before glyph rows were blended in place: runs of opaque pixels as
+// lines, every other covered pixel read back, blended and drawn on its own
+static void perPixelGlyph(TFT_eSprite& s, int16_t x, int16_t y, uint16_t code, uint16_t fg) {
+  uint16_t gNum;
+  if (!s.getUnicodeIndex(code, &gNum)) return;
+  if (x == 0) x -= s.gdX[gNum];
+  int32_t cy = y + s.gFont.maxAscent - s.gdY[gNum];
+  int32_t cx = x + s.gdX[gNum];
+  const uint8_t* bitmap = s.gFont.gArray + s.gBitmap[gNum];
+
+  for (int32_t gy = 0; gy < s.gHeight[gNum]; gy++) {
+    int32_t fxs = 0, fl = 0;
+    for (int32_t gx = 0; gx < s.gWidth[gNum]; gx++) {
+      uint8_t pixel = bitmap[gx + s.gWidth[gNum] * gy];
+      if (pixel == 0xFF) {
+        if (fl == 0) fxs = gx + cx;
+        fl++;
+        continue;
+      }
+      if (fl) { s.drawFastHLine(fxs, gy + cy, fl, fg); fl = 0; }
+      if (pixel) s.drawPixel(gx + cx, gy + cy, s.alphaBlend(pixel, fg, s.readPixel(gx + cx, gy + cy)));
+    }
+    if (fl) s.drawFastHLine(fxs, gy + cy, fl, fg);
+  }
+}
+
+// Noise, so that every blend reads a different background
+static void noise(TFT_eSprite& s) {
+  uint16_t* p = (uint16_t*)s.getPointer();
+  for (int i = 0; i < 240 * 240; i++) p[i] = rand();
+}
+
+// Glyphs at random places in both sprites, some cut by the sprite or viewport edges
+static void drawBoth(const uint8_t* font, uint32_t cases) {
+  spr.loadFont(font);
+  ref.loadFont(font);
+  for (uint32_t t = 0; t < cases; t++) {
+    uint16_t code = glyphs[rand() % (sizeof(glyphs) - 1)];
+    int16_t x = rand() % 280 - 30;
+    int16_t y = rand() % 280 - 30;
+    if (t % 16 == 0) x = 0; // drawGlyph moves a glyph at the left edge by its extent
+    uint16_t fg = rand();
+
+    spr.setTextColor(fg);
+    spr.setCursor(x, y);
+    spr.drawGlyph(code);
+    perPixelGlyph(ref, x, y, code, fg);
+  }
+  spr.unloadFont();
+  ref.unloadFont();
+}
+
+static void setViewports(int32_t x, int32_t y, int32_t w, int32_t h, bool datum) {
+  spr.setViewport(x, y, w, h, datum);
+  ref.setViewport(x, y, w, h, datum);
+}
+
+void test_glyph_matches_per_pixel() {
+  srand(47);
+  noise(spr);
+  memcpy(ref.getPointer(), spr.getPointer(), 240 * 240 * 2);
+
+  drawBoth(NotoSansBold15, GLYPH_CASES);
+  TEST_ASSERT_EQUAL_MEMORY(ref.getPointer(), spr.getPointer(), 240 * 240 * 2);
+
+  // Viewports with and without their own origin, one partly and one fully off the sprite
+  setViewports(30, 40, 170, 150, true);
+  drawBoth(NotoSansMonoSCB20, GLYPH_CASES);
+  setViewports(17, 9, 93, 201, false);
+  drawBoth(NotoSansBold15, GLYPH_CASES);
+  setViewports(-20, 190, 100, 100, true);
+  drawBoth(NotoSansMonoSCB20, GLYPH_CASES);
+  setViewports(300, 300, 20, 20, true);
+  drawBoth(NotoSansBold15, GLYPH_CASES / 10);
+  spr.resetViewport();
+  ref.resetViewport();
+  TEST_ASSERT_EQUAL_MEMORY(ref.getPointer(), spr.getPointer(), 240 * 240 * 2);
+}
+
+// The same glyphs drawn per pixel and by drawGlyph
+void test_glyph_benchmark() {
+  spr.loadFont(NotoSansBold15);
+  spr.setTextColor(TFT_WHITE);
+  spr.fillSprite(0x0841);
+  unsigned long t0 = micros();
+  for (int n = 0; n < GLYPH_BENCH_RUNS; n++) {
+    for (int i = 0; i < 12; i++) {
+      for (int c = 0; glyphs[c]; c++) perPixelGlyph(spr, 3 + c * 9, i * 20 - 3, glyphs[c], TFT_WHITE);
+    }
+  }
+  unsigned long t1 = micros();
+  for (int n = 0; n < GLYPH_BENCH_RUNS; n++) {
+    for (int i = 0; i < 12; i++) {
+      for (int c = 0; glyphs[c]; c++) {
+        spr.setCursor(3 + c * 9, i * 20 - 3);
+        spr.drawGlyph(glyphs[c]);
+      }
+    }
+  }
+  unsigned long t2 = micros();
+  spr.unloadFont();
+
+  printf("%d glyphs: per pixel %.1f us, rows %.1f us\n", (int)(12 * (sizeof(glyphs) - 1)),
+         (float)(t1 - t0) / GLYPH_BENCH_RUNS, (float)(t2 - t1) / GLYPH_BENCH_RUNS);
+}
+
+// Plant screen like text: small labels in several colours, a clipped line and a centred title
+static void textScreen(TFT_eSprite& s) {
+  s.fillSprite(0x0841);
+  s.fillRect(0, 100, 240, 40, 0x3F29);
+  s.loadFont(NotoSansBold15);
+  const uint16_t cols[] = {TFT_WHITE, TFT_GOLD, 0x3F29, TFT_SILVER, TFT_RED};
+  for (int i = 0; i < 12; i++) {
+    s.setTextColor(cols[i % 5]);
+    s.setCursor((i * 7) % 23 - 5, i * 20 - 3);
+    s.print("Monstera 23C 61% soil 44% light 812 lx");
+  }
+  s.unloadFont();
+  s.loadFont(NotoSansMonoSCB20);
+  s.setTextColor(TFT_WHITE);
+  s.setViewport(30, 40, 170, 150);
+  s.drawString("PlantPal 0123456789", -10, 60);
+  s.resetViewport();
+  s.setTextDatum(MC_DATUM);
+  s.drawString("Too dark!", 120, 120);
+  s.setTextDatum(TL_DATUM);
+  s.unloadFont();
+}
+
+void test_text_benchmark() {
+  unsigned long t0 = micros();
+  for (int n = 0; n < TEXT_BENCH_RUNS; n++) textScreen(spr);
+  unsigned long t1 = micros();
+  printf("text screen: %.1f us\n", (float)(t1 - t0) / TEXT_BENCH_RUNS);
+}
+
+int main() {
+  spr.createSprite(240, 240);
+  ref.createSprite(240, 240);
+  spr.setTextWrap(false, false);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_glyph_matches_per_pixel);
+  RUN_TEST(test_glyph_benchmark);
+  RUN_TEST(test_text_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,215 @@
+// PlantLink backends and the selector that picks one per frame: cheapest
+// healthy link first, probes of skipped links, the unconfirmed beacon, MQTT
+// routes and the ESP-NOW backend's batches.
+//   pio test -e native -f test_links -v
+#define CONFIG_BLUEDROID_ENABLED 1
+#include <unity.h>
+#include <omegaPlantLink.cpp> // The backends and what they send through in this translation unit
+#include <omegaNowLink.cpp>
+#include <omegaNowPeers.cpp>
+#include <omegaNowRoutes.cpp>
+#include <omegaNowBatch.cpp>
+#include <omegaBLE.cpp>
+
+// Backend whose transport confirms or refuses every frame as told
+class fakeLink : public PlantLink {
+private:
+    const char* label;
+
+public:
+    bool up = true;
+    bool ok = true;
+    uint32_t sent = 0;
+
+    explicit fakeLink(const char* name) : label(name) {}
+    const char* name() const override { return label; }
+    bool available() override { return up; }
+    bool publish(const plantFrame&) override {
+        stats.published++;
+        sent++;
+        if (ok) delivered(5);
+        else failed();
+        return ok;
+    }
+};
+
+static plantFrame sensorFrame(uint8_t xp) {
+    plantState s = {};
+    s.plantID = 0x5001;
+    s.curXP = xp;
+    s.curData.moisture = 40;
+    return plantFrame::of<plantStateSchema>(NOW_SENSOR, 0x5001, s);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_links_cheapest_first() {
+    fakeLink now("now"), ble("ble"), mqtt("mqtt");
+    plantLinkSelector links;
+    links.add(now);
+    links.add(ble);
+    links.add(mqtt);
+
+    for (uint8_t i = 0; i < 5; i++) TEST_ASSERT_TRUE(links.publish(sensorFrame(i)) == &now);
+    TEST_ASSERT_EQUAL_UINT32(5, now.sent);
+    TEST_ASSERT_EQUAL_UINT32(0, ble.sent + mqtt.sent);
+    TEST_ASSERT_TRUE(links.last() == &now);
+}
+
+void test_links_skip_unhealthy_and_probe() {
+    fakeLink now("now"), mqtt("mqtt");
+    plantLinkSelector links;
+    links.add(now);
+    links.add(mqtt);
+
+    // A refused frame goes on to the next link, after a few the link is skipped
+    now.ok = false;
+    for (uint8_t i = 0; i < 5; i++) TEST_ASSERT_TRUE(links.publish(sensorFrame(i)) == &mqtt);
+    TEST_ASSERT_FALSE(now.healthy());
+    uint32_t tries = now.sent;
+    TEST_ASSERT_LESS_THAN(5, tries);
+
+    // Recovered, but only a probe every LINK_PROBE_INTERVAL finds out
+    now.ok = true;
+    links.publish(sensorFrame(0));
+    TEST_ASSERT_EQUAL_UINT32(tries, now.sent);
+    for (uint8_t i = 0; i < 5 && !now.healthy(); i++) {
+        hostAdvance(LINK_PROBE_INTERVAL);
+        TEST_ASSERT_TRUE(links.publish(sensorFrame(0)) == &mqtt); // Probed, still sent on the healthy link
+    }
+    TEST_ASSERT_TRUE(now.healthy());
+    TEST_ASSERT_TRUE(links.publish(sensorFrame(0)) == &now);
+}
+
+void test_links_unavailable_and_fallback() {
+    fakeLink now("now"), mqtt("mqtt");
+    plantLinkSelector links;
+    links.add(now);
+    links.add(mqtt);
+
+    mqtt.up = false;
+    now.ok = false;
+    for (uint8_t i = 0; i < 3; i++) TEST_ASSERT_TRUE(links.publish(sensorFrame(i)) == nullptr);
+    TEST_ASSERT_EQUAL_UINT32(0, mqtt.sent);
+    TEST_ASSERT_FALSE(now.healthy());
+
+    // Nothing healthy is left, the cheapest unhealthy link still gets the frame
+    now.ok = true;
+    TEST_ASSERT_TRUE(links.publish(sensorFrame(0)) == &now);
+}
+
+void test_links_beacon_is_unconfirmed() {
+    omegaBLEBeacon beacon;
+    TEST_ASSERT_TRUE(beacon.begin());
+    fakeLink now("now"), mqtt("mqtt");
+    blePlantLink ble(beacon);
+    plantLinkSelector links;
+    links.add(now);
+    links.add(ble);
+    links.add(mqtt);
+
+    // The beacon is updated on the way, the frame still goes to MQTT
+    now.up = false;
+    for (uint8_t i = 0; i < 10; i++) TEST_ASSERT_TRUE(links.publish(sensorFrame(i)) == &mqtt);
+    TEST_ASSERT_EQUAL_UINT32(10, ble.stats.published);
+    TEST_ASSERT_EQUAL_UINT32(0, ble.stats.delivered);
+    TEST_ASSERT_EQUAL_UINT32(0, ble.stats.failed);
+    TEST_ASSERT_TRUE(ble.healthy());
+
+    bleBeaconData advertised;
+    TEST_ASSERT_TRUE(advertised.decode(hostGap::get().adv, hostGap::get().advLen));
+    TEST_ASSERT_EQUAL_UINT8(9, advertised.state.curXP);
+
+    // Only sensor frames fit into the beacon
+    TEST_ASSERT_FALSE(ble.supports(NOW_STATE));
+}
+
+void test_links_mqtt_routes() {
+    PubSubClient client;
+    mqttPlantLink mqtt(client);
+    TEST_ASSERT_TRUE(mqtt.routeSchema<plantStateSchema>(NOW_SENSOR, "plantpal/5001/sensor"));
+    TEST_ASSERT_FALSE(mqtt.routeSchema<plantStateSchema>(NOW_SENSOR, "plantpal/5001/other"));
+    TEST_ASSERT_TRUE(mqtt.supports(NOW_SENSOR));
+    TEST_ASSERT_FALSE(mqtt.supports(NOW_STATE));
+
+    TEST_ASSERT_TRUE(mqtt.publish(sensorFrame(12)));
+    TEST_ASSERT_TRUE(client.topic == "plantpal/5001/sensor");
+    StaticJsonDocument<LINK_MQTT_BUFFER> doc;
+    TEST_ASSERT_FALSE(deserializeJson(doc, client.payload));
+    plantState s = {};
+    plantStateSchema::fromJson(doc.as<JsonObjectConst>(), s);
+    TEST_ASSERT_EQUAL_UINT8(12, s.curXP);
+    TEST_ASSERT_EQUAL_UINT8(40, s.curData.moisture);
+    TEST_ASSERT_EQUAL_UINT32(1, mqtt.stats.delivered);
+
+    client.refuse = true;
+    TEST_ASSERT_FALSE(mqtt.publish(sensorFrame(13)));
+    TEST_ASSERT_EQUAL_UINT32(1, mqtt.stats.failed);
+    client.online = false;
+    TEST_ASSERT_FALSE(mqtt.available());
+}
+
+struct batchDelivery {
+    uint32_t frames = 0;
+    uint8_t type = 0;
+    uint8_t records = 0;
+};
+
+static void onNowFrame(const uint8_t*, const nowHeader& header, const uint8_t* payload, uint8_t len, void* ctx) {
+    batchDelivery* d = static_cast<batchDelivery*>(ctx);
+    d->frames++;
+    d->type = header.type;
+    nowBatchReader reader(payload, len);
+    d->records = header.type == NOW_BATCH && reader.valid() ? reader.size() : 0;
+}
+
+void test_links_now_batch_deadline() {
+    omegaLoopbackRadio ra(1), rb(2);
+    omegaNowLink pot(ra, 0x5001), display(rb, 0x4401);
+    omegaNowPeers peers;
+    batchDelivery got;
+    omegaLoopbackRadio::pair(ra, rb);
+    pot.begin();
+    display.begin();
+    display.setSink(true);
+    display.onFrame(onNowFrame, &got);
+    peers.begin();
+    nowPlantLink now(pot, peers, 4);
+
+    // Samples published together share a frame
+    TEST_ASSERT_TRUE(now.publish(sensorFrame(1)));
+    TEST_ASSERT_TRUE(now.publish(sensorFrame(2)));
+    now.loop();
+    TEST_ASSERT_EQUAL_UINT32(0, got.frames);
+
+    // A partial batch is not held back for more than LINK_BATCH_MAX_AGE
+    hostAdvance(LINK_BATCH_MAX_AGE);
+    now.loop();
+    TEST_ASSERT_EQUAL_UINT32(1, got.frames);
+    TEST_ASSERT_EQUAL_UINT8(NOW_BATCH, got.type);
+    TEST_ASSERT_EQUAL_UINT8(2, got.records);
+    TEST_ASSERT_EQUAL_UINT32(1, now.stats.delivered);
+
+    // A full batch goes out at once
+    for (uint8_t i = 0; i < 4; i++) now.publish(sensorFrame(i));
+    TEST_ASSERT_EQUAL_UINT32(2, got.frames);
+    TEST_ASSERT_EQUAL_UINT8(4, got.records);
+
+    // Other frames are never batched
+    PlantSaveData save = {};
+    TEST_ASSERT_TRUE(now.publish(plantFrame::of<PlantSaveDataSchema>(NOW_STATE, 0x5001, save)));
+    TEST_ASSERT_EQUAL_UINT32(3, got.frames);
+    TEST_ASSERT_EQUAL_UINT8(NOW_STATE, got.type);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_links_cheapest_first);
+    RUN_TEST(test_links_skip_unhealthy_and_probe);
+    RUN_TEST(test_links_unavailable_and_fallback);
+    RUN_TEST(test_links_beacon_is_unconfirmed);
+    RUN_TEST(test_links_mqtt_routes);
+    RUN_TEST(test_links_now_batch_deadline);
+    return UNITY_END();
+}
@@ -0,0 +1,252 @@
+// Transparent pushToSprite by recorded opaque runs (createOpaqueMask) against
+// the per-pixel push, masks invalidated by drawing after them, and the arc
+// gauge that records its mask again for every new angle.
+//   pio test -e native -f test_mask -v
+#include <unity.h>
+#include <TFT_eSPI.cpp> // The whole library in this translation unit, see test_arc
+#include <omegaGauge.h>
+
+TFT_eSPI tft;
+TFT_eSprite src(&tft);   // Pushed by its mask
+TFT_eSprite plain(&tft); // Same pixels, pushed per pixel
+TFT_eSprite dstA(&tft);
+TFT_eSprite dstB(&tft);
+
+#define DST_W 100
+#define DST_H 80
+#define MASK_CASES 3000
+#define MASK_BENCH_RUNS 2000
+
+void setUp() {}
+void tearDown() {}
+
+// Both destinations filled with the same noise
+static void noise(uint32_t seed) {
+  srand(seed);
+  dstA.resetViewport();
+  for (int32_t y = 0; y < DST_H; y++) {
+    for (int32_t x = 0; x < DST_W; x++) dstA.drawPixel(x, y, rand());
+  }
+  memcpy(dstB.getPointer(), dstA.getPointer(), DST_W * DST_H * 2);
+}
+
+// Shapes on a transparent background, the same for the same seed
+static void shapes(TFT_eSprite& s, uint32_t seed, uint16_t transp) {
+  srand(seed);
+  s.fillSprite(transp);
+  int n = rand() % 6;
+  for (int i = 0; i < n; i++) {
+    uint16_t c = rand();
+    if (c == transp) c ^= 1;
+    int32_t x = rand() % s.width(), y = rand() % s.height();
+    if (rand() & 1) s.fillRect(x - 5, y - 3, rand() % 30 + 1, rand() % 12 + 1, c);
+    else s.fillCircle(x, y, rand() % 15, c);
+  }
+  // Single pixels and runs of one between transparent gaps
+  for (int i = 0; i < 10; i++) s.drawPixel(rand() % s.width(), rand() % s.height(), transp ^ 0x0020);
+}
+
+static void pushBoth(int32_t x, int32_t y, uint16_t transp) {
+  src.pushToSprite(&dstA, x, y, transp);
+  plain.pushToSprite(&dstB, x, y, transp);
+}
+
+static void setViewports(int32_t x, int32_t y, int32_t w, int32_t h, bool datum) {
+  dstA.setViewport(x, y, w, h, datum);
+  dstB.setViewport(x, y, w, h, datum);
+}
+
+static void setSwapBytes(bool swap) {
+  dstA.setSwapBytes(swap);
+  dstB.setSwapBytes(swap);
+}
+
+void test_mask_matches_per_pixel() {
+  uint32_t bad = 0;
+  for (uint32_t t = 0; t < MASK_CASES; t++) {
+    noise(t);
+    int32_t w = rand() % 70 + 1, h = rand() % 40 + 1;
+    uint16_t transp = rand() & 1 ? TFT_BLACK : rand();
+    int32_t x = rand() % (DST_W + 60) - 40, y = rand() % (DST_H + 60) - 40;
+    uint32_t mode = rand() % 4;
+
+    src.createSprite(w, h);
+    plain.createSprite(w, h);
+    shapes(src, t, transp);
+    shapes(plain, t, transp);
+    TEST_ASSERT_TRUE(src.createOpaqueMask(transp));
+
+    if (mode == 1) setViewports(13, 9, 61, 47, true);
+    if (mode == 2) setViewports(20, 5, 50, 70, false);
+    setSwapBytes(mode == 3);
+    pushBoth(x, y, transp);
+    dstA.resetViewport();
+    dstB.resetViewport();
+    setSwapBytes(false);
+
+    if (memcmp(dstA.getPointer(), dstB.getPointer(), DST_W * DST_H * 2)) bad++;
+    src.deleteSprite();
+    plain.deleteSprite();
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, bad);
+}
+
+// Every way of writing to a Sprite after its mask was recorded
+static void draw(TFT_eSprite& s, uint8_t op) {
+  static const uint16_t image[12] = {TFT_RED, TFT_RED, TFT_BLACK, TFT_GREEN, TFT_BLUE, TFT_WHITE,
+                                     TFT_BLACK, TFT_BLACK, TFT_GOLD, TFT_GOLD, TFT_SILVER, TFT_RED};
+  uint16_t copy[12];
+  memcpy(copy, image, sizeof(copy));
+  switch (op) {
+    case 0: s.fillSprite(TFT_NAVY); break;
+    case 1: s.fillRect(3, 4, 20, 9, TFT_NAVY); break;
+    case 2: s.drawPixel(33, 17, TFT_NAVY); break;
+    case 3: s.drawFastHLine(0, 30, 50, TFT_NAVY); break;
+    case 4: s.drawFastVLine(41, 0, 40, TFT_NAVY); break;
+    case 5: s.pushImage(7, 21, 4, 3, copy); break;
+    case 6: s.pushImage(40, 2, 6, 2, image); break;
+    case 7: s.setWindow(10, 10, 14, 12); s.pushColor(TFT_NAVY, 15); break;
+    case 8: s.setScrollRect(0, 0, 60, 40, TFT_NAVY); s.scroll(3, -2); break;
+    case 9: s.drawSmoothArc(30, 20, 18, 12, 40, 300, TFT_NAVY, TFT_BLACK, true); break;
+    case 10: ((uint16_t*)s.getPointer())[5 * 60 + 5] = TFT_NAVY; break;
+  }
+}
+
+void test_mask_invalidated_by_drawing() {
+  src.createSprite(60, 40);
+  plain.createSprite(60, 40);
+  for (uint8_t op = 0; op <= 10; op++) {
+    shapes(src, 100 + op, TFT_BLACK);
+    shapes(plain, 100 + op, TFT_BLACK);
+    TEST_ASSERT_TRUE(src.createOpaqueMask(TFT_BLACK));
+    draw(src, op);
+    draw(plain, op);
+
+    noise(op);
+    pushBoth(17, 21, TFT_BLACK);
+    TEST_ASSERT_EQUAL_MEMORY(dstB.getPointer(), dstA.getPointer(), DST_W * DST_H * 2);
+
+    // Recorded again in the memory of the last mask
+    TEST_ASSERT_TRUE(src.createOpaqueMask(TFT_BLACK));
+    noise(op);
+    pushBoth(-9, 50, TFT_BLACK);
+    TEST_ASSERT_EQUAL_MEMORY(dstB.getPointer(), dstA.getPointer(), DST_W * DST_H * 2);
+  }
+
+  // A mask for another colour is not used
+  shapes(src, 7, TFT_BLACK);
+  shapes(plain, 7, TFT_BLACK);
+  src.createOpaqueMask(TFT_BLACK);
+  noise(7);
+  pushBoth(5, 5, TFT_RED);
+  TEST_ASSERT_EQUAL_MEMORY(dstB.getPointer(), dstA.getPointer(), DST_W * DST_H * 2);
+  src.deleteSprite();
+  plain.deleteSprite();
+}
+
+// Rows drawn into after the mask, recorded again on their own
+void test_mask_rows() {
+  src.createSprite(60, 40);
+  plain.createSprite(60, 40);
+  for (uint8_t t = 0; t < 4; t++) {
+    shapes(src, 200 + t, TFT_BLACK);
+    shapes(plain, 200 + t, TFT_BLACK);
+    TEST_ASSERT_TRUE(src.createOpaqueMask(TFT_BLACK));
+    for (int i = 0; i < 2; i++) {
+      TFT_eSprite& s = i ? plain : src;
+      if (t == 0) s.fillRect(0, 10, 60, 6, TFT_BLACK); // Fewer runs
+      if (t == 1) for (int x = 0; x < 60; x += 2) s.drawFastVLine(x, 10, 6, TFT_GOLD); // More runs
+      if (t == 2) s.fillRect(0, 0, 60, 3, TFT_GOLD); // First rows
+      if (t == 3) s.drawFastHLine(1, 39, 57, TFT_GOLD); // Last row
+    }
+    if (t < 2) src.createOpaqueMask(TFT_BLACK, 10, 6);
+    else if (t == 2) src.createOpaqueMask(TFT_BLACK, -5, 8);
+    else src.createOpaqueMask(TFT_BLACK, 39, 10);
+
+    noise(t);
+    pushBoth(20, 20, TFT_BLACK);
+    TEST_ASSERT_EQUAL_MEMORY(dstB.getPointer(), dstA.getPointer(), DST_W * DST_H * 2);
+  }
+  src.deleteSprite();
+  plain.deleteSprite();
+}
+
+// The gauge pushed after each step against the same arc drawn anew on the target,
+// filling from the start, from the end and around a closed ring
+void test_mask_gauge_steps() {
+  const uint16_t track = 0x3186, value = TFT_GREEN;
+  const uint16_t starts[] = {30, 60, 0};
+  const uint16_t ends[] = {330, 300, 360};
+
+  srand(49);
+  uint32_t bad = 0;
+  for (int g = 0; g < 3; g++) {
+    uint16_t from = starts[g], to = ends[g];
+    bool grows = g == 1;
+    omegaArcGauge gauge(&tft);
+    TEST_ASSERT_TRUE(gauge.begin(50, 40, 36, 28, from, to, track, value, grows));
+
+    for (int i = 0; i < 200; i++) {
+      uint16_t angle = from + rand() % (to - from + 1);
+      gauge.setAngle(angle);
+
+      dstA.fillSprite(TFT_BLACK);
+      gauge.push(&dstA);
+      dstB.fillSprite(TFT_BLACK);
+      dstB.drawArc(50, 40, 36, 28, from, to, track, TFT_BLACK, true);
+      if (!grows && angle > from) dstB.drawArc(50, 40, 36, 28, from, angle, value, TFT_BLACK, true);
+      if (grows && angle < to) dstB.drawArc(50, 40, 36, 28, angle, to, value, TFT_BLACK, true);
+      if (memcmp(dstA.getPointer(), dstB.getPointer(), DST_W * DST_H * 2)) bad++;
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, bad);
+}
+
+// A 120x120 avatar, about half opaque, pushed per pixel and by its mask, and a gauge step
+void test_mask_benchmark() {
+  TFT_eSprite target(&tft);
+  target.createSprite(240, 240);
+  src.createSprite(120, 120);
+  plain.createSprite(120, 120);
+  for (int i = 0; i < 2; i++) {
+    TFT_eSprite& s = i ? plain : src;
+    s.fillSprite(TFT_BLACK);
+    s.fillCircle(60, 66, 46, TFT_DARKGREEN);
+    s.fillEllipse(60, 30, 30, 18, TFT_GREEN);
+    s.fillRect(35, 100, 50, 20, TFT_BROWN);
+  }
+
+  unsigned long t0 = micros();
+  for (int n = 0; n < MASK_BENCH_RUNS; n++) plain.pushToSprite(&target, 60, 60, TFT_BLACK);
+  unsigned long t1 = micros();
+  for (int n = 0; n < MASK_BENCH_RUNS; n++) src.createOpaqueMask(TFT_BLACK);
+  unsigned long t2 = micros();
+  for (int n = 0; n < MASK_BENCH_RUNS; n++) src.pushToSprite(&target, 60, 60, TFT_BLACK);
+  unsigned long t3 = micros();
+
+  omegaArcGauge gauge(&tft);
+  gauge.begin(120, 120, 110, 100, 30, 330, 0x3186, TFT_GREEN);
+  gauge.setAngle(180);
+  unsigned long t4 = micros();
+  for (int n = 0; n < MASK_BENCH_RUNS; n++) gauge.setAngle(n & 1 ? 180 : 183);
+  unsigned long t5 = micros();
+
+  printf("120x120 push: per pixel %.2f us, mask %.2f us, recording the mask %.2f us\n",
+         (float)(t1 - t0) / MASK_BENCH_RUNS, (float)(t3 - t2) / MASK_BENCH_RUNS, (float)(t2 - t1) / MASK_BENCH_RUNS);
+  printf("gauge step of 3 degrees: %.2f us\n", (float)(t5 - t4) / MASK_BENCH_RUNS);
+  src.deleteSprite();
+  plain.deleteSprite();
+}
+
+int main() {
+  dstA.createSprite(DST_W, DST_H);
+  dstB.createSprite(DST_W, DST_H);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_mask_matches_per_pixel);
+  RUN_TEST(test_mask_invalidated_by_drawing);
+  RUN_TEST(test_mask_rows);
+  RUN_TEST(test_mask_gauge_steps);
+  RUN_TEST(test_mask_benchmark);
+  return UNITY_END();
+}
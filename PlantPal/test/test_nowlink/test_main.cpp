@@ -0,0 +1,362 @@
+// The ESP-NOW link on a pair of loopback radios: acks and retries, duplicate
+// filtering, samples batched into one frame, channel announcements and the
+// channel hunt. The peer table against the in-memory NVS.
+//   pio test -e native -f test_nowlink -v
+#include <unity.h>
+#include <omegaNowLink.cpp> // The link and its tables in this translation unit
+#include <omegaNowPeers.cpp>
+#include <omegaNowRoutes.cpp>
+#include <omegaNowBatch.cpp>
+
+#define POT_ID 0x5001
+#define DISPLAY_ID 0x4401
+
+// Loopback radio that also takes hand-made frames, as if heard on the air
+class injectRadio : public omegaLoopbackRadio {
+public:
+    explicit injectRadio(uint8_t id) : omegaLoopbackRadio(id) {}
+    void inject(const uint8_t* mac, const uint8_t* frame, int len) { deliver(mac, frame, len); }
+};
+
+struct delivery {
+    uint32_t frames = 0;
+    uint16_t lastSeq = 0;
+    uint8_t lastType = 0;
+    uint8_t payload[NOW_MAX_PAYLOAD];
+    uint8_t len = 0;
+};
+
+static void onFrame(const uint8_t*, const nowHeader& header, const uint8_t* payload, uint8_t len, void* ctx) {
+    delivery* d = static_cast<delivery*>(ctx);
+    d->frames++;
+    d->lastSeq = header.seq;
+    d->lastType = header.type;
+    memcpy(d->payload, payload, len);
+    d->len = len;
+}
+
+// Steps the clock past the ack timeout until nothing is pending
+static void settle(omegaNowLink& link) {
+    for (int i = 0; i < 100 && link.pendingCount(); i++) {
+        hostAdvance(NOW_ACK_TIMEOUT);
+        link.loop();
+    }
+}
+
+static void sendSample(omegaNowLink& link, uint8_t xp) {
+    plantState s = {};
+    s.plantID = POT_ID;
+    s.curXP = xp;
+    link.sendSchema<plantStateSchema>(NOW_BROADCAST, NOW_SENSOR, s);
+}
+
+void setUp() { srand(1); }
+void tearDown() {}
+
+void test_nowlink_acked_without_retry() {
+    omegaLoopbackRadio ra(1), rb(2);
+    omegaNowLink pot(ra, POT_ID), display(rb, DISPLAY_ID);
+    delivery got;
+    omegaLoopbackRadio::pair(ra, rb);
+    pot.begin();
+    display.begin();
+    display.setSink(true);
+    display.onFrame(onFrame, &got);
+
+    sendSample(pot, 7);
+    TEST_ASSERT_EQUAL_UINT8(0, pot.pendingCount());
+    TEST_ASSERT_EQUAL_UINT32(1, pot.stats.acked);
+    TEST_ASSERT_EQUAL_UINT32(0, pot.stats.retries);
+    TEST_ASSERT_EQUAL_UINT32(1, got.frames);
+    TEST_ASSERT_EQUAL_UINT8(NOW_SENSOR, got.lastType);
+}
+
+void test_nowlink_retries_until_dropped() {
+    omegaLoopbackRadio ra(1), rb(2);
+    omegaNowLink pot(ra, POT_ID), display(rb, DISPLAY_ID);
+    delivery got;
+    omegaLoopbackRadio::pair(ra, rb);
+    pot.begin();
+    display.begin();
+    display.setSink(true);
+    display.onFrame(onFrame, &got);
+
+    // Every ack is lost: the frame arrives once, its retries are filtered
+    rb.setLoss(100);
+    sendSample(pot, 7);
+    TEST_ASSERT_EQUAL_UINT8(1, pot.pendingCount());
+    settle(pot);
+    TEST_ASSERT_EQUAL_UINT8(0, pot.pendingCount());
+    TEST_ASSERT_EQUAL_UINT32(NOW_MAX_RETRIES, pot.stats.retries);
+    TEST_ASSERT_EQUAL_UINT32(1, pot.stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(0, pot.stats.acked);
+    TEST_ASSERT_EQUAL_UINT32(1, got.frames);
+    TEST_ASSERT_EQUAL_UINT32(NOW_MAX_RETRIES, display.stats.duplicates);
+}
+
+void test_nowlink_lossy_delivers_once() {
+    omegaLoopbackRadio ra(1), rb(2);
+    omegaNowLink pot(ra, POT_ID), display(rb, DISPLAY_ID);
+    delivery got;
+    omegaLoopbackRadio::pair(ra, rb);
+    pot.begin();
+    display.begin();
+    display.setSink(true);
+    display.onFrame(onFrame, &got);
+    ra.setLoss(30);
+    rb.setLoss(30);
+
+    const uint32_t frames = 500;
+    for (uint32_t i = 0; i < frames; i++) {
+        while (pot.pendingCount() == NOW_MAX_PENDING) {
+            hostAdvance(NOW_ACK_TIMEOUT);
+            pot.loop();
+        }
+        sendSample(pot, i);
+    }
+    settle(pot);
+
+    // Every frame is acked or given up; acked ones arrived exactly once
+    TEST_ASSERT_EQUAL_UINT32(frames, pot.stats.sent);
+    TEST_ASSERT_EQUAL_UINT32(frames, pot.stats.acked + pot.stats.dropped);
+    TEST_ASSERT_GREATER_THAN(0, pot.stats.retries);
+    TEST_ASSERT_EQUAL_UINT32(display.stats.received, got.frames);
+    TEST_ASSERT_LESS_OR_EQUAL(frames, got.frames);
+    TEST_ASSERT_LESS_OR_EQUAL(got.frames, pot.stats.acked);
+}
+
+void test_nowlink_dedup_window() {
+    injectRadio ra(1), rb(2);
+    omegaNowLink display(rb, DISPLAY_ID);
+    delivery got;
+    omegaLoopbackRadio::pair(ra, rb);
+    display.begin();
+    display.setSink(true);
+    display.onFrame(onFrame, &got);
+
+    // Out of order and repeated, each sequence number is delivered once
+    const uint16_t seqs[] = {10, 12, 11, 12, 10, 13, 11};
+    for (uint8_t i = 0; i < sizeof(seqs) / sizeof(seqs[0]); i++) {
+        uint8_t frame[NOW_HEADER_SIZE + 1];
+        nowHeader h = {NOW_SENSOR, NOW_MESH_TTL, seqs[i], POT_ID, NOW_ANY};
+        h.encode(frame);
+        frame[NOW_HEADER_SIZE] = i;
+        rb.inject(ra.address(), frame, sizeof(frame));
+    }
+    TEST_ASSERT_EQUAL_UINT32(4, got.frames);
+    TEST_ASSERT_EQUAL_UINT32(3, display.stats.duplicates);
+
+    // A restarted sender jumps far behind the window and is heard again
+    uint8_t frame[NOW_HEADER_SIZE];
+    nowHeader h = {NOW_SENSOR, NOW_MESH_TTL, (uint16_t)(13 - NOW_DEDUP_WINDOW), POT_ID, NOW_ANY};
+    h.encode(frame);
+    rb.inject(ra.address(), frame, sizeof(frame));
+    TEST_ASSERT_EQUAL_UINT32(5, got.frames);
+}
+
+void test_nowlink_batch_fills_frame() {
+    omegaLoopbackRadio ra(1), rb(2);
+    omegaNowLink pot(ra, POT_ID), display(rb, DISPLAY_ID);
+    delivery got;
+    omegaLoopbackRadio::pair(ra, rb);
+    pot.begin();
+    display.begin();
+    display.setSink(true);
+    display.onFrame(onFrame, &got);
+
+    // The link does not fragment, a payload larger than one frame is refused
+    uint8_t big[NOW_MAX_PAYLOAD + 1] = {};
+    TEST_ASSERT_FALSE(pot.send(NOW_BROADCAST, NOW_SENSOR, big, sizeof(big)));
+
+    // Samples are split over frames by the batch writer instead
+    nowBatchWriter batch;
+    uint32_t now = millis();
+    uint8_t added = 0;
+    plantState s = {};
+    s.plantID = POT_ID;
+    while (true) {
+        s.curXP = added;
+        if (!batch.add(s, now - (NOW_BATCH_MAX_RECORDS - added) * 1000)) break;
+        added++;
+    }
+    TEST_ASSERT_EQUAL_UINT8(NOW_BATCH_MAX_RECORDS, added);
+    TEST_ASSERT_TRUE(batch.full());
+
+    uint8_t len = batch.finish(now);
+    TEST_ASSERT_LESS_OR_EQUAL(NOW_MAX_PAYLOAD, len);
+    TEST_ASSERT_TRUE(pot.send(NOW_BROADCAST, NOW_BATCH, batch.data(), len));
+    TEST_ASSERT_EQUAL_UINT32(1, got.frames);
+    TEST_ASSERT_EQUAL_UINT8(NOW_BATCH, got.lastType);
+
+    nowBatchReader reader(got.payload, got.len);
+    TEST_ASSERT_TRUE(reader.valid());
+    TEST_ASSERT_EQUAL_UINT8(added, reader.size());
+    uint16_t age;
+    for (uint8_t i = 0; i < added; i++) {
+        plantState r;
+        TEST_ASSERT_TRUE(reader.next(r, age));
+        TEST_ASSERT_EQUAL_UINT16(POT_ID, r.plantID);
+        TEST_ASSERT_EQUAL_UINT8(i, r.curXP);
+        TEST_ASSERT_EQUAL_UINT16(NOW_BATCH_MAX_RECORDS - i, age);
+    }
+    plantState r;
+    TEST_ASSERT_FALSE(reader.next(r, age));
+
+    // A truncated frame is rejected as a whole
+    nowBatchReader cut(got.payload, got.len - 1);
+    TEST_ASSERT_FALSE(cut.valid());
+}
+
+void test_nowlink_channel_hunt() {
+    omegaLoopbackRadio ra(1), rb(2);
+    omegaNowLink pot(ra, POT_ID), display(rb, DISPLAY_ID);
+    delivery got;
+    omegaLoopbackRadio::pair(ra, rb);
+    pot.begin();
+    display.begin();
+    display.setSink(true);
+    display.setAnnounceChannel(true);
+    display.onFrame(onFrame, &got);
+    pot.setFollowChannel(true);
+
+    // The display's access point moved it to channel 6, the pot is still on 1
+    rb.associate(6);
+    display.loop();
+    TEST_ASSERT_EQUAL_UINT8(1, ra.channel());
+
+    // The announcement goes out once, it is neither retried nor given up
+    TEST_ASSERT_EQUAL_UINT32(1, display.stats.channels);
+    TEST_ASSERT_EQUAL_UINT8(0, display.pendingCount());
+    TEST_ASSERT_EQUAL_UINT32(0, display.stats.sent);
+    hostAdvance(NOW_ACK_TIMEOUT * (NOW_MAX_RETRIES + 1));
+    display.loop();
+    TEST_ASSERT_EQUAL_UINT32(1, rb.sent);
+    TEST_ASSERT_EQUAL_UINT32(0, display.stats.dropped);
+
+    for (int i = 0; i < 40 && !got.frames; i++) {
+        if (pot.pendingCount() < NOW_MAX_PENDING) sendSample(pot, i);
+        hostAdvance(NOW_ACK_TIMEOUT);
+        pot.loop();
+    }
+    TEST_ASSERT_EQUAL_UINT8(6, ra.channel());
+    TEST_ASSERT_GREATER_THAN(0, got.frames);
+    TEST_ASSERT_EQUAL_UINT32(5, pot.stats.channels);
+
+    // The associated display never leaves its access point's channel
+    TEST_ASSERT_FALSE(rb.setChannel(1));
+    TEST_ASSERT_EQUAL_UINT8(6, rb.channel());
+}
+
+// Announcement of channel ch from the display, as heard by radio r
+static void announce(injectRadio& r, const uint8_t* from, uint16_t seq, uint8_t ch) {
+    uint8_t frame[NOW_HEADER_SIZE + 1];
+    nowHeader h = {NOW_CHANNEL, NOW_MESH_TTL | NOW_FLAG_SINK, seq, DISPLAY_ID, NOW_ANY};
+    h.encode(frame);
+    frame[NOW_HEADER_SIZE] = ch;
+    r.inject(from, frame, sizeof(frame));
+}
+
+void test_nowlink_channel_follow() {
+    injectRadio ra(1), rb(2);
+    omegaNowLink pot(rb, POT_ID);
+    delivery got;
+    omegaLoopbackRadio::pair(ra, rb);
+    pot.begin();
+    pot.onFrame(onFrame, &got);
+
+    // Without setFollowChannel the pot stays where it is
+    announce(rb, ra.address(), 1, 6);
+    TEST_ASSERT_EQUAL_UINT8(1, rb.channel());
+
+    // A follower moves, the link handles the frame and nobody acks it
+    pot.setFollowChannel(true);
+    announce(rb, ra.address(), 2, 6);
+    TEST_ASSERT_EQUAL_UINT8(6, rb.channel());
+    TEST_ASSERT_EQUAL_UINT32(1, pot.stats.channels);
+    TEST_ASSERT_EQUAL_UINT32(0, rb.sent);
+    TEST_ASSERT_EQUAL_UINT32(0, got.frames);
+
+    // Channels out of range are ignored
+    announce(rb, ra.address(), 3, 0);
+    announce(rb, ra.address(), 4, NOW_MAX_CHANNEL + 1);
+    TEST_ASSERT_EQUAL_UINT8(6, rb.channel());
+
+    // Once associated the pot keeps its access point's channel
+    rb.associate(11);
+    announce(rb, ra.address(), 5, 6);
+    TEST_ASSERT_EQUAL_UINT8(11, rb.channel());
+    TEST_ASSERT_EQUAL_UINT32(1, pot.stats.channels);
+}
+
+void test_nowlink_channel_relayed() {
+    injectRadio ra(1), rb(2);
+    omegaNowLink relay(rb, 0x4402);
+    omegaLoopbackRadio::pair(ra, rb);
+    relay.begin();
+    relay.setSink(true);
+    relay.setRelay(true);
+    relay.setFollowChannel(true);
+
+    // A sink passes announcements on once, outside the retry table, and follows them itself
+    announce(rb, ra.address(), 1, 6);
+    TEST_ASSERT_EQUAL_UINT32(1, rb.sent);
+    TEST_ASSERT_EQUAL_UINT32(1, relay.stats.relayed);
+    TEST_ASSERT_EQUAL_UINT8(0, relay.pendingCount());
+    TEST_ASSERT_EQUAL_UINT8(6, rb.channel());
+
+    // A repeated announcement is neither acked nor forwarded again
+    announce(rb, ra.address(), 1, 6);
+    TEST_ASSERT_EQUAL_UINT32(1, rb.sent);
+    TEST_ASSERT_EQUAL_UINT32(1, relay.stats.duplicates);
+}
+
+void test_nowpeers_persist_and_count() {
+    const uint8_t potA[6] = {0x02, 0, 0, 0, 0, 0x0A};
+    const uint8_t potB[6] = {0x02, 0, 0, 0, 0, 0x0B};
+    omegaNowPeers peers;
+    TEST_ASSERT_TRUE(peers.begin());
+    peers.clear();
+
+    // Saved once when paired, not again for a known peer
+    uint32_t writes = hostNvs::get().writes;
+    TEST_ASSERT_TRUE(peers.add(potA, 0x5001));
+    TEST_ASSERT_TRUE(peers.add(potB, 0x5002));
+    TEST_ASSERT_TRUE(peers.add(potA, 0x5001));
+    TEST_ASSERT_EQUAL_UINT32(writes + 2, hostNvs::get().writes);
+
+    // Hardware acks are counted without the mutex
+    peers.sendResult(potA, true);
+    peers.sendResult(potA, false);
+    peers.sendResult(potB, true);
+    nowPeer peer;
+    TEST_ASSERT_TRUE(peers.get(0, peer));
+    TEST_ASSERT_EQUAL_UINT32(2, peer.stats.sent);
+    TEST_ASSERT_EQUAL_UINT32(1, peer.stats.failed);
+    TEST_ASSERT_EQUAL_UINT8(50, peer.stats.lossPercent());
+
+    // A restart loads both from NVS
+    omegaNowPeers restarted;
+    TEST_ASSERT_TRUE(restarted.begin());
+    TEST_ASSERT_EQUAL_UINT8(2, restarted.count());
+    TEST_ASSERT_TRUE(restarted.isPaired(potB));
+    TEST_ASSERT_TRUE(restarted.remove(potB));
+
+    omegaNowPeers again;
+    again.begin();
+    TEST_ASSERT_EQUAL_UINT8(1, again.count());
+    TEST_ASSERT_FALSE(again.isPaired(potB));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_nowlink_acked_without_retry);
+    RUN_TEST(test_nowlink_retries_until_dropped);
+    RUN_TEST(test_nowlink_lossy_delivers_once);
+    RUN_TEST(test_nowlink_dedup_window);
+    RUN_TEST(test_nowlink_batch_fills_frame);
+    RUN_TEST(test_nowlink_channel_hunt);
+    RUN_TEST(test_nowlink_channel_follow);
+    RUN_TEST(test_nowlink_channel_relayed);
+    RUN_TEST(test_nowpeers_persist_and_count);
+    return UNITY_END();
+}
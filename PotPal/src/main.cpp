@@ -7,6 +7,14 @@
  * 
  * @custom_headers
  *  - omegaPlant.h
+ *  - omegaSchema.h
+ *  - omegaDelta.h
+ *  - omegaTopicRouter.h
+ *  - omegaNowLink.h
+ *  - omegaNowPeers.h
+ *  - omegaNowBatch.h
+ *  - omegaBLE.h
+ *  - omegaPlantLink.h
  * 
  * @external_headers
  *  - Arduino.h
@@ -40,6 +48,14 @@
  *  Created by Group 1
  */
 #include <omegaPlant.h>
+#include <omegaSchema.h>
+#include <omegaDelta.h>
+#include <omegaTopicRouter.h>
+#include <omegaNowLink.h>
+#include <omegaNowPeers.h>
+#include <omegaNowBatch.h>
+#include <omegaBLE.h>
+#include <omegaPlantLink.h>
 
 /** WiFi and MQTT setup */
 #define LED_PIN 15
@@ -52,15 +68,21 @@ const char *password = WIFI_PASSWORD;
 const char *mqtt_server = "192.168.2.5";
 const char *mqtt_user = "containership";
 const char *mqtt_pass = MQTT_PASSWORD;
-const char *sensor_topic = "plantpal/sensor";
 const char *alive_topic = "plantpal/alive";
-const char *state_topic = "plantpal/state";
 const char *friendly_name = "PotPal8A";
 
+/** Per-device topics, filled in setup() from the device id */
+#define DEVICE_ID_PREFIX 'P'
+uint16_t deviceID;
+char sensor_topic[TOPIC_PLANT_LEN];
+char state_topic[TOPIC_PLANT_LEN];
+
 WiFiClient espClient;
 PubSubClient client(espClient);
 
 #define PUBLISH_INTERVAL 5000 // Publish interval in milliseconds
+#define RECONNECT_INTERVAL 5000 // Time between MQTT connection attempts
+#define MQTT_BUFFER_SIZE 512  // Fits the full PlantSaveData state message
 
 /** I2C Pins */
 #define I2C_SDA 21
@@ -69,6 +91,10 @@ PubSubClient client(espClient);
 /** Sensor activation */
 #define USE_DUMMY
 
+/** ESP-NOW flood test, sends sensor frames back to back to measure PlantPal's receive rate */
+//#define NOW_FLOOD_TEST
+#define FLOOD_ID_PREFIX 'F' // Sender id of the flood frames
+
 #ifndef USE_DUMMY
   #define USE_VEML6075
   #define USE_BME280
@@ -94,8 +120,30 @@ BH1750 lightMeter;
 
 PlantProfile profile;
 omegaPlant myPlant(profile);
+omegaDelta delta(profile);
+
+/** ESP-NOW fast path to PlantPal, works without the broker */
+#define NOW_BATCH_SAMPLES 4 // Samples per ESP-NOW frame, those published within LINK_BATCH_MAX_AGE share one
+//#define NOW_RELAY // Forward frames of pots out of display range, mains powered pots only
+omegaNowPeers nowPeers;
+omegaEspNowRadio nowRadio(&nowPeers);
+omegaNowLink nowLink(nowRadio);
+
+#if defined(CONFIG_BLUEDROID_ENABLED)
+/** BLE beacon with the latest sample, only on chips with BLE (not the S2) */
+omegaBLEBeacon beacon;
+#endif
+
+/** Every frame goes out once, on the cheapest link that confirms it: ESP-NOW, MQTT; BLE only advertises on the way */
+nowPlantLink nowBackend(nowLink, nowPeers, NOW_BATCH_SAMPLES);
+#if defined(CONFIG_BLUEDROID_ENABLED)
+blePlantLink bleBackend(beacon);
+#endif
+mqttPlantLink mqttBackend(client);
+plantLinkSelector links;
 
 unsigned long lastPublishTime = 0;
+unsigned long lastReconnectTime = 0;
 
 /**
  * @brief Connect to WiFi
@@ -121,23 +169,34 @@ void setup_wifi() {
 }
 
 /**
- * @brief Reconnect to MQTT server if disconnected
+ * @brief Try once to reconnect to the MQTT server
+ *
+ * Does not wait for the broker, sensor frames keep flowing over ESP-NOW
+ * while it is unreachable.
  */
 void reconnect() {
-  while (!client.connected()) {
-    digitalWrite(LED_PIN, HIGH); // Turn LED on while attempting to reconnect
-    delay(100);
-    digitalWrite(LED_PIN, LOW); // Blink LED while reconnecting
-    delay(100);
-    if (client.connect(friendly_name, mqtt_user, mqtt_pass)) {
-      digitalWrite(LED_PIN, HIGH); // Turn LED on when connected
-      client.publish(alive_topic, friendly_name);
-    } else {
-      delay(5000); // Wait 5 seconds before retrying
-    }
+  digitalWrite(LED_PIN, HIGH); // Turn LED on while attempting to reconnect
+  delay(100);
+  digitalWrite(LED_PIN, LOW); // Blink LED while reconnecting
+  delay(100);
+  if (client.connect(friendly_name, mqtt_user, mqtt_pass)) {
+    digitalWrite(LED_PIN, HIGH); // Turn LED on when connected
+    client.publish(alive_topic, friendly_name);
   }
 }
 
+/**
+ * @brief Whether the pot needs its own broker connection
+ *
+ * A display that acknowledges ESP-NOW frames republishes them through its
+ * gateway, so the pot only connects while that path is unconfirmed or
+ * unhealthy. This keeps one broker connection per display instead of one
+ * per pot.
+ */
+bool needBroker() {
+  return nowBackend.stats.delivered == 0 || !nowBackend.healthy();
+}
+
 /**
  * @brief Get sensor data and store it in theData
  * @param theData Pointer to sensorData struct to store the readings
@@ -170,48 +229,86 @@ void getSensorData(sensorData *theData) {
 }
 
 /**
- * @brief Publish sensor data to MQTT server
+ * @brief MQTT encoder for sensor frames, only the fields that changed beyond their deadband
+ * @return JSON length, 0 if nothing changed
+ */
+size_t encodeSensorDelta(const plantFrame& frame, char* out, size_t size, void* ctx) {
+  plantState state;
+  if (!plantStateSchema::fromBinary(frame.payload, frame.len, state)) return 0;
+
+  uint32_t changed = delta.update(state);
+  if (!changed) return 0;
+
+  StaticJsonDocument<256> doc;
+  plantStateSchema::toJson(doc.to<JsonObject>(), state, changed);
+  return serializeJson(doc, out, size);
+}
+
+/**
+ * @brief Publish sensor data on the cheapest working link
+ *
+ * ESP-NOW carries the full binary state, batched by NOW_BATCH_SAMPLES.
+ * Over MQTT only the fields that changed beyond their deadband are sent,
+ * every DELTA_KEYFRAME_INTERVAL calls a full message is sent. Samples that
+ * went over another link force a full message the next time MQTT is used.
+ *
  * @param newData The sensor data to be published
  */
 void publishSensorData(sensorData newData) {
-  StaticJsonDocument<256> doc;
   static PlantSaveData currentPlant;
 
   static uint8_t lastLevel = 0;
 
   plantState state = myPlant.getMeasurement(newData, &currentPlant);
 
-  doc["id"] = currentPlant.plantID;
-  doc["light"] = state.curData.lightIntensity;
-  doc["tempc"] = state.curData.temperature;
-  doc["hum"] = state.curData.humidity;
-  doc["soilm"] = state.curData.moisture;
-
-  doc["mood"] = state.curMood;
-  doc["xp"] = state.curXP;
-  doc["level"] = currentPlant.savedLvL;
-  doc["rcmnd"] = state.curEmotion;
+  state.plantID = deviceID;
 
-  char jsonBuffer[256];
-  serializeJson(doc, jsonBuffer);
-  client.publish(sensor_topic, jsonBuffer);
+  links.publish(plantFrame::of<plantStateSchema>(NOW_SENSOR, deviceID, state));
+  if (links.last() != &mqttBackend) delta.forceKeyframe();
 
   if (lastLevel != currentPlant.savedLvL) {
-    char jBuffer[256];
-    StaticJsonDocument<256> lvlupMSG;
-
     lastLevel = currentPlant.savedLvL;
-   
-    lvlupMSG["id"] = currentPlant.plantID;
-    lvlupMSG["level"] = currentPlant.savedLvL;
-    lvlupMSG["xp"] = currentPlant.savedExp;
-    lvlupMSG["items"] = currentPlant.unlockedItems;
-
-    serializeJson(lvlupMSG, jBuffer);
-    client.publish(state_topic, jBuffer);
+    links.publish(plantFrame::of<PlantSaveDataSchema>(NOW_STATE, deviceID, currentPlant));
   }
 }
 
+#ifdef NOW_FLOOD_TEST
+/**
+ * @brief Send one sensor frame straight to the radio, without waiting for an ack
+ */
+void floodFrame() {
+  // Own sender id, the display tracks its sequence numbers apart from the link's
+  static uint16_t floodID = 0;
+  static uint16_t seq = 0;
+  if (!floodID) {
+    uint8_t mac[6];
+    WiFi.macAddress(mac);
+    floodID = nowDeviceID(FLOOD_ID_PREFIX, mac);
+  }
+  plantState state = {};
+  state.plantID = deviceID;
+  state.curXP = seq & 0xFF;
+
+  uint8_t frame[NOW_HEADER_SIZE + plantStateSchema::binarySize];
+  nowHeader header = {NOW_SENSOR, 0, seq++, floodID};
+  header.encode(frame);
+  plantStateSchema::toBinary(frame + NOW_HEADER_SIZE, plantStateSchema::binarySize, state);
+  nowRadio.send(NOW_BROADCAST, frame, sizeof(frame));
+}
+#endif
+
+/**
+ * @brief Derive the 16-bit device id from the MAC's NIC bytes and build the per-device topics
+ */
+void setup_topics() {
+  uint8_t mac[6];
+  WiFi.macAddress(mac);
+  deviceID = nowDeviceID(DEVICE_ID_PREFIX, mac);
+
+  snprintf(sensor_topic, sizeof(sensor_topic), TOPIC_PLANT_FORMAT, deviceID, "sensor");
+  snprintf(state_topic, sizeof(state_topic), TOPIC_PLANT_FORMAT, deviceID, "state");
+}
+
 /**
  * @brief Setup function to initialize sensors and WiFi connection
  */
@@ -246,7 +343,33 @@ void setup() {
   #endif
 
   setup_wifi();
+  setup_topics();
+  #ifdef NOW_RELAY
+  // Relays unicast to the neighbours they learned routes through
+  nowPeers.autoPair((1 << NOW_ACK) | (1 << NOW_SENSOR) | (1 << NOW_BATCH));
+  nowLink.setRelay(true);
+  #else
+  nowPeers.autoPair(1 << NOW_ACK); // Pair the displays that answer
+  #endif
+  nowLink.setFollowChannel(true); // Only takes effect while WiFi is not connected
+  if (!nowLink.begin(deviceID)) {
+    Serial.println("ESP-NOW link failed");
+  }
+  #if defined(CONFIG_BLUEDROID_ENABLED)
+  if (!beacon.begin()) {
+    Serial.println("BLE beacon failed");
+  }
+  #endif
+
+  mqttBackend.route(NOW_SENSOR, sensor_topic, encodeSensorDelta);
+  mqttBackend.routeSchema<PlantSaveDataSchema>(NOW_STATE, state_topic);
+  links.add(nowBackend);
+  #if defined(CONFIG_BLUEDROID_ENABLED)
+  links.add(bleBackend);
+  #endif
+  links.add(mqttBackend);
   client.setKeepAlive(60);
+  client.setBufferSize(MQTT_BUFFER_SIZE);
   client.setServer(mqtt_server, 1883);
 }
 
@@ -254,10 +377,18 @@ void setup() {
  * @brief Main loop function to handle MQTT connection and publish sensor data
  */
 void loop() {
-  if (!client.connected()) {
+  if (!needBroker()) {
+    if (client.connected()) client.disconnect();
+  } else if (!client.connected() && millis() - lastReconnectTime > RECONNECT_INTERVAL) {
     reconnect();
+    lastReconnectTime = millis();
   }
   client.loop();
+  links.loop();
+
+  #ifdef NOW_FLOOD_TEST
+  for (uint8_t i = 0; i < 50; i++) floodFrame(); // Offers more than the air can carry
+  #endif
 
   if (millis() - lastPublishTime > PUBLISH_INTERVAL) {
     sensorData currentData;
@@ -265,5 +396,5 @@ void loop() {
     publishSensorData(currentData);
     lastPublishTime = millis();
   }
-  delay(100);
+  delay(10); // Short enough for the ESP-NOW resend timeout
 }
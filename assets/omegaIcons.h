@@ -0,0 +1,4531 @@
+
+#include <Arduino.h>
+#include <pgmspace.h>
+
+#define COLOR_PURPLE    0x9D1A
+#define COLOR_RED       0xFC51
+#define COLOR_ORANGE    0xFEF6
+#define COLOR_YELLOW    0xF7B6
+#define COLOR_BROWN 	0xA48E
+
+// 'bluetooth', 40x40px
+const uint16_t icon_bluetooth [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x1b33, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1b33, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0042, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0xffff, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x2c17, 0xffff, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x1bb7, 0x5cf9, 0xffff, 
+	0xffff, 0xffff, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xefbf, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x1c39, 0x1bb7, 0x8ddb, 0xffff, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xefbf, 0xffff, 0xffff, 0xe79f, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x1bb7, 
+	0xffdf, 0xffff, 0xffff, 0xf7bf, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1bf8, 0xffff, 0xffff, 0xffff, 
+	0xae9d, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x6d7b, 0xffff, 0xffff, 0xffff, 0x1bf8, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c19, 0x1bb7, 0xffff, 0xffff, 0xffff, 0x7ddc, 0x1c39, 0xffff, 0xffff, 0x1c39, 0x44da, 0xffff, 
+	0xffff, 0xffff, 0x1bb7, 0x1c19, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1bd7, 0x1bb7, 0xffff, 
+	0xffff, 0xffff, 0x551b, 0xffff, 0xffff, 0x245a, 0xffff, 0xffff, 0xffff, 0x1bb7, 0x1bb7, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1bb7, 0x1bb7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0x1bb7, 0x1bb7, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1bb7, 
+	0x1bb7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1bb7, 0x1bb7, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1bb7, 0x1bb7, 0xffff, 0xffff, 0xffff, 0xffff, 0x1bb7, 0x1bb7, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1bb7, 0xffff, 0xffff, 0xffff, 0xffff, 0x1bb7, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0xffff, 0x54b9, 0xffff, 0xffff, 0x23d7, 0xffff, 0xffff, 
+	0xffff, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 
+	0xffff, 0x7d9a, 0x1bb7, 0xffff, 0xffff, 0x1bb7, 0x4478, 0xffff, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0xffff, 0xae7c, 0x1bb7, 0x1c39, 0xffff, 0xffff, 0x1c39, 0x1bb7, 0x6d3a, 
+	0xffff, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xefbf, 0xffff, 0xffff, 0xe77e, 
+	0x1bb7, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x1bb7, 0xffdf, 0xffff, 0xffff, 0xf7bf, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c19, 0xffff, 0xef9f, 0x1bb7, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x1c39, 0x1c39, 0x961c, 
+	0xffff, 0xffff, 0xffff, 0x1bf8, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c19, 0x1bb7, 0x1bb7, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x1c39, 0x5d3b, 0xffff, 0xffff, 0xffff, 0x1bb7, 0x1c19, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x347a, 0xffff, 0xffff, 
+	0xffff, 0x1bb7, 0x1bb7, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1bb7, 0x1bb7, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0xffff, 0xffff, 0x1bb7, 
+	0x1bb7, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0xffff, 0x1bb7, 0x1bb7, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0042, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0xffff, 0xffff, 0x1bb7, 0x1bb7, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1bb7, 0x1bb7, 0x1bb7, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1bb7, 0x1bb7, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1c39, 0x1c39, 
+	0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1b33, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1c39, 0x1b33, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'chart', 40x40px
+const uint16_t icon_chart [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x0000, 0x0000, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xe75d, 0x0000, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 
+	0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 
+	0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xe75d, 0xe75d, 
+	0xe75d, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xe75d, 0xe75d, 0xe75d, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xe75d, 0xe75d, 0xe75d, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xe75d, 
+	0xe75d, 0xe75d, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 
+	0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 
+	0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 
+	0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 
+	0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xe75d, 0x0000, 
+	0x0000, 0x0000, 0xe75d, 0xe75d, 0xe75d, 0xcebb, 0xcebb, 0xcebb, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0x5c87, 0xcebb, 0xcebb, 
+	0xcebb, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 0xcebb, 0xcebb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 0x3cbb, 
+	0xcebb, 0xcebb, 0xcebb, 0xe75d, 0xe75d, 0xe75d, 0x0000, 0x0000, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 0xe75d, 
+	0xe75d, 0xe75d, 0xe75d, 0xe75d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'check', 40x40px
+const uint16_t icon_check [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x0c41, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0c01, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0b20, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0ae0, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x1601, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1621, 0x1621, 0x1621, 0x1621, 0x1621, 
+	0x1621, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x15a1, 0x1621, 0x1621, 0x15a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'compass', 40x40px
+const uint16_t icon_compass [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6a00, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0x6a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xc3a1, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xc3a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf461, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf461, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf4c3, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xf4c3, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xfed0, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xf461, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 
+	0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf461, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 
+	0xf7df, 0xf7df, 0xf7df, 0xd968, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 
+	0x0000, 0xc3a1, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xd968, 0xedd8, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xc3a1, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xed56, 0xd968, 0xd968, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7bf, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 
+	0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xd968, 0xd968, 0xd968, 
+	0xd968, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xf7bf, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x6a00, 0xf481, 0xf481, 0xf481, 0xf4c3, 0xfed0, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xf4c3, 0xf481, 0xf481, 0xf481, 0x69e0, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xd968, 0xd968, 
+	0xd968, 0xd968, 0xd968, 0xd968, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xd968, 0xd968, 0xd968, 0x8cd4, 0x8cd4, 0x8cd4, 0x8cd4, 0xcebb, 0xcebb, 
+	0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 
+	0xd968, 0x8cd4, 0x8cd4, 0xf7df, 0xf7df, 0x8cd4, 0x8cd4, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xd968, 0x8cd4, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0x8cd4, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0x8cd4, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0x8cd4, 0x2966, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0x8cd4, 0x8cd4, 0xf7df, 0xf7df, 0x8cd4, 0x8cd4, 0x2966, 
+	0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 
+	0xcebb, 0xcebb, 0x8cd4, 0x8cd4, 0x8cd4, 0x8cd4, 0x2966, 0x2966, 0x2966, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x2966, 0x2966, 0x2966, 0x2966, 
+	0x2966, 0x2966, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0x6a00, 0xf481, 0xf481, 0xf481, 0xf4c3, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x2966, 0x2966, 0x2966, 0x2966, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xfed0, 0xf4c3, 0xf481, 0xf481, 0xf481, 0x69e0, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7bf, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0x2966, 
+	0x2966, 0x2966, 0x2966, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 
+	0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xf7bf, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0x2966, 0x2966, 0xb5d7, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0xc3a1, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xa535, 0x2966, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xc3a1, 0x0000, 
+	0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xcebb, 0xcebb, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0x2966, 0xf7df, 0xf7df, 0xf7df, 
+	0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0xf461, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 
+	0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf461, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xfed0, 0xfed0, 0xfed0, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 0xf7df, 
+	0xf7df, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf4c3, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xf4c3, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xf461, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf461, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc3a1, 0xf481, 0xf481, 0xf481, 
+	0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xc3a1, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x69e0, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 0xf481, 
+	0x69e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'cross', 40x40px
+const uint16_t icon_cross [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2841, 0xc986, 0xc986, 0x2841, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0xc986, 0xc986, 0x2841, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x2861, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 
+	0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0x2841, 0x0000, 
+	0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0xf206, 0xf206, 0xf34b, 0xf34b, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 
+	0x0000, 0x1840, 0xf206, 0xf34b, 0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0x2841, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf34b, 0xf34b, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf32b, 0xf34b, 0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf34b, 0xf34b, 
+	0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf34b, 0xf34b, 0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 
+	0xf34b, 0xf34b, 0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf34b, 0xf34b, 0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 
+	0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xf206, 0xf206, 0xf34b, 0xf34b, 0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf34b, 0xf34b, 0xf34b, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xc986, 0xc986, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xf206, 0xf206, 0xf34b, 0xf34b, 0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf34b, 0xf34b, 0xf34b, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf34b, 0xf34b, 0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf34b, 
+	0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xd9c6, 0xf206, 0xf206, 0xf206, 0xf206, 0xf34b, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xd9c6, 0xc986, 0xc986, 0xf206, 0xf206, 0xf2ea, 0xf34b, 
+	0xf34b, 0xf227, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xd9c6, 0xc986, 0xc986, 0x0000, 0x0000, 0xf206, 0xf206, 0xf34b, 0xf34b, 0xf34b, 0xf247, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xe1c6, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 
+	0xf34b, 0xf34b, 0xf34b, 0xf268, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xe1e6, 0xc986, 
+	0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf32b, 0xf34b, 0xf34b, 0xf268, 0xf206, 0xf206, 0xf206, 
+	0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xe9e6, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xf206, 0xf206, 0xf32b, 0xf34b, 0xf34b, 0xf268, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xe9e6, 0xc986, 0xc986, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf32b, 0xf34b, 0xf34b, 0xf288, 0xf206, 
+	0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xea06, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xf206, 0xf206, 0xf32b, 0xf34b, 0xf34b, 0xf288, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf30a, 0xf34b, 0xf34b, 
+	0xf288, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x2861, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf30a, 0xf34b, 0xf34b, 0xf288, 0xf206, 0xf206, 0xd1a6, 0xc986, 0x0800, 0x0000, 
+	0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf2ea, 
+	0xf34b, 0xf34b, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 
+	0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf2a9, 0xf34b, 0xf34b, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 
+	0x0000, 0x2861, 0xf206, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf206, 
+	0xf206, 0xf206, 0xf206, 0xf206, 0xd9c6, 0xc986, 0x4082, 0x0000, 0x0000, 0x0000, 0xf206, 0xf206, 0xf206, 0xf206, 0xc986, 0xc986, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe9e6, 0xf206, 0xf206, 0xd1a6, 0xc986, 0xc986, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3881, 0xc986, 0xc986, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x60c3, 0xc986, 0xc986, 0x60c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'eye', 40x40px
+const uint16_t icon_eye [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52aa, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 
+	0x3a29, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 
+	0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x7c10, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 
+	0x3a29, 0x3a29, 0x3a29, 0xf79e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 
+	0x3a29, 0x3a29, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x2104, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a08, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 
+	0x3a29, 0xe73c, 0x3a29, 0x3a29, 0x5b2d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 
+	0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0xf7df, 0xf7df, 0xf7df, 0x4aab, 0x3a29, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x2104, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0xbdd7, 
+	0xf7df, 0xf7df, 0xf7df, 0xf7df, 0x3a29, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x20e4, 
+	0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0xf7df, 0xf7df, 0xf7df, 0xce9a, 0x3a29, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x8c51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 
+	0x2924, 0xf7df, 0xdf1c, 0x3a29, 0x3a29, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x2104, 
+	0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 
+	0x2945, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 
+	0x3a29, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0xad96, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0x8431, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x20e4, 0x20e4, 0x20e4, 0x20e4, 0x3a29, 0x3a29, 
+	0x3a29, 0x3a29, 0x3a29, 0x3a29, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 
+	0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 
+	0x3a29, 0x3a29, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x424a, 
+	0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xb596, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa535, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0x3a29, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x8430, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xf79e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 
+	0xffff, 0xef5d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad75, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'function', 40x40px
+const uint16_t icon_function [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6a85, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 
+	0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 0x82e7, 
+	0x82e7, 0x82e7, 0x49a3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd52c, 0xfecd, 0xfeab, 
+	0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 0xfeab, 
+	0xfeab, 0xfe8a, 0xfe8a, 0xfe8a, 0xfe8a, 0xfe8a, 0xfe8a, 0xfe8a, 0xfe8a, 0xfe8a, 0xfeef, 0x8306, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfe45, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 
+	0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfdc0, 
+	0xfdc0, 0xfdc0, 0xfdc0, 0xed86, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfe01, 0xfe01, 0xfe01, 
+	0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfde1, 
+	0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfde0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xed20, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 
+	0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfde0, 0xfdc0, 0xfdc0, 0xfdc0, 
+	0xfdc0, 0xfdc0, 0xfdc0, 0xed00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfe01, 0xfe01, 0xfe01, 
+	0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfde1, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 
+	0xfde1, 0xfde1, 0xfde1, 0xfde0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xed00, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfde1, 0xfd80, 0xfd80, 0xfdc1, 
+	0xfe01, 0xfe01, 0xfe01, 0xfde1, 0xfdc1, 0xfda0, 0xfdc1, 0xfdc0, 0xfde1, 0xfde1, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 
+	0xfdc0, 0xfdc0, 0xfdc0, 0xed00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfe01, 0xfe01, 0xfe01, 
+	0xfe01, 0xfe01, 0xfe01, 0xfde1, 0xfd80, 0xff9c, 0xffff, 0xf540, 0xfdc1, 0xfde1, 0xfde1, 0xfdc1, 0xf540, 0xff7b, 0xf5c7, 0xfdc1, 
+	0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xed01, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfe01, 0xfde1, 0xfda0, 0xf5ec, 0xffff, 0xffff, 0xf670, 
+	0xfda1, 0xfde1, 0xfdc1, 0xfd60, 0xff38, 0xffff, 0xf6f6, 0xfda0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 
+	0xfdc0, 0xfdc0, 0xfda0, 0xece1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfde1, 0xfde1, 0xfde1, 
+	0xfde1, 0xfde1, 0xfde1, 0xf540, 0xffff, 0xffff, 0xffff, 0xffde, 0xfd60, 0xfdc1, 0xfd80, 0xf62e, 0xffff, 0xffff, 0xff5b, 0xfd60, 
+	0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfda0, 0xfda0, 0xfda0, 0xfd80, 0xecc0, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfde1, 0xfdc1, 0xf5a9, 0xffff, 0xef1b, 0xeed8, 0xffff, 
+	0xf502, 0xfd60, 0xf5a8, 0xffff, 0xffff, 0xef3c, 0xffbe, 0xfd20, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfda0, 0xfd80, 
+	0xfd80, 0xfd80, 0xfd80, 0xecc0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfde1, 0xfde1, 0xfde1, 
+	0xfde1, 0xfde1, 0xfda0, 0xf6b5, 0xffff, 0xbbc2, 0xc447, 0xffff, 0xf75b, 0xed03, 0xffff, 0xffff, 0xaba7, 0xe697, 0xf7be, 0xf501, 
+	0xfda0, 0xfdc0, 0xfdc0, 0xfdc0, 0xfda0, 0xfda0, 0xfd80, 0xfd80, 0xfd80, 0xfd60, 0xfd60, 0xe4c1, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfde1, 0xfdc1, 0xfdc1, 0xfdc1, 0xfdc1, 0xfda0, 0xf719, 0xef5c, 0xdc80, 0xdc81, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xe656, 0xe4a0, 0xe631, 0xf7be, 0xed06, 0xfd80, 0xfda0, 0xfda0, 0xfda0, 0xfd80, 0xfd80, 0xfd80, 0xfd60, 
+	0xfd60, 0xfd40, 0xfd40, 0xeca0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfdc1, 0xfdc1, 0xfdc1, 
+	0xfdc1, 0xfdc1, 0xfdc1, 0xdc80, 0xd460, 0xfda0, 0xfd60, 0xd590, 0xffff, 0xffff, 0xef1b, 0xcc21, 0xfd60, 0xd4ea, 0xf7be, 0xf77c, 
+	0xfd40, 0xfda0, 0xfda0, 0xfd80, 0xfd80, 0xfd60, 0xfd60, 0xfd60, 0xfd40, 0xfd40, 0xfd40, 0xeca0, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfdc1, 0xfdc1, 0xfdc1, 0xfdc1, 0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xfd80, 0xcc22, 
+	0xffff, 0xffff, 0xb3a2, 0xfd60, 0xfd80, 0xd440, 0xf7be, 0xf7be, 0xf4e0, 0xfd60, 0xfd80, 0xfd60, 0xfd60, 0xfd40, 0xfd40, 0xfd40, 
+	0xfd40, 0xfd20, 0xfd20, 0xec60, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda0, 0xfda0, 0xfda0, 
+	0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xf520, 0xc530, 0xab43, 0xf540, 0xfd80, 0xfd80, 0xece0, 0xf79d, 0xf7be, 
+	0xeded, 0xfd20, 0xfd60, 0xfd40, 0xfd40, 0xfd40, 0xfd20, 0xfd20, 0xfd20, 0xfd00, 0xfd00, 0xec40, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xfda0, 0xfd80, 0xfd80, 0xfd60, 
+	0xece0, 0xf520, 0xfd80, 0xfd80, 0xfd80, 0xfd40, 0xbc69, 0xf77d, 0xf79e, 0xf4c0, 0xfd40, 0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfd00, 
+	0xfd00, 0xfd00, 0xfce0, 0xec40, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfda0, 0xfd80, 0xfd80, 
+	0xfd80, 0xfd80, 0xfd80, 0xfd80, 0xfd80, 0xfd80, 0xfd80, 0xfd80, 0xfd80, 0xfd80, 0xfd80, 0xfd80, 0xfd60, 0xfd40, 0xd420, 0xef7d, 
+	0xef5d, 0xee0f, 0xf4e0, 0xfd20, 0xfd00, 0xfd00, 0xfd00, 0xfd00, 0xfce0, 0xfce0, 0xfce0, 0xe420, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd80, 0xfd80, 0xfd80, 0xfd60, 0xfd60, 0xfd80, 0xfd60, 0xfd60, 0xfd60, 0xfd60, 0xfd60, 
+	0xfd60, 0xfd60, 0xfd60, 0xfd60, 0xfd40, 0xfd40, 0xf4e0, 0xb408, 0xef5d, 0xef5d, 0xec81, 0xfcc0, 0xfd00, 0xfce0, 0xfce0, 0xfcc0, 
+	0xfcc0, 0xfcc0, 0xfcc0, 0xe420, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd60, 0xfd60, 0xfd60, 
+	0xfd60, 0xfd60, 0xfd60, 0xfd60, 0xfd60, 0xfd60, 0xfd60, 0xfd60, 0xfd40, 0xfd40, 0xfd40, 0xfd20, 0xfd00, 0xfd00, 0xfd00, 0xdbc0, 
+	0xde98, 0xe71c, 0xef3c, 0xf460, 0xfca0, 0xfcc0, 0xfcc0, 0xfca0, 0xfca0, 0xf4a0, 0xf4a0, 0xe420, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd60, 0xfd60, 0xfd60, 0xfd60, 0xfd60, 0xfd60, 0xfd40, 0xfd60, 0xfd40, 0xfd40, 0xfd40, 
+	0xfd20, 0xfd20, 0xfd00, 0xfd00, 0xfd00, 0xfd00, 0xfce0, 0xfcc0, 0xb322, 0xe71c, 0xdefb, 0xef3c, 0xec61, 0xf460, 0xf4a0, 0xf4a0, 
+	0xf4a0, 0xf4a0, 0xf480, 0xe420, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd40, 0xfd40, 0xfd40, 
+	0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd20, 0xfd20, 0xfd20, 0xfd00, 0xfce0, 0xfce0, 0xfce0, 0xfce0, 0xfce0, 0xfcc0, 0xfcc0, 0xfcc0, 
+	0xf460, 0xaba6, 0xdedb, 0xdedb, 0xe71c, 0xf549, 0xf400, 0xf440, 0xfc60, 0xf480, 0xf440, 0xe3c0, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd40, 0xfd40, 0xfd40, 0xfd20, 0xfd20, 0xfd20, 0xfd20, 0xfd00, 0xfce0, 0xfce0, 0xfce0, 
+	0xfcc0, 0xfcc0, 0xfcc0, 0xfcc0, 0xfcc0, 0xfcc0, 0xfca0, 0xfca0, 0xfc80, 0xe3e0, 0xb46c, 0xdedb, 0xdedb, 0xdedb, 0xef7d, 0xf400, 
+	0xf440, 0xf440, 0xf440, 0xe3a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd20, 0xfd20, 0xfd00, 
+	0xfd00, 0xfd00, 0xfd00, 0xfce0, 0xfce0, 0xfce0, 0xfcc0, 0xfcc0, 0xfcc0, 0xfcc0, 0xfcc0, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 
+	0xfc80, 0xf460, 0xd380, 0xc551, 0xdedb, 0xdedb, 0xd616, 0xebe0, 0xf440, 0xf420, 0xf420, 0xe3a0, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd00, 0xfce0, 0xfce0, 0xfce0, 0xfce0, 0xfcc0, 0xfcc0, 0xfcc0, 0xfcc0, 0xfcc0, 0xfca0, 
+	0xfca0, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc60, 0xfc60, 0xfc60, 0xf440, 0xf440, 0xf440, 0xc320, 0xc551, 0xdedb, 0xb322, 0xf400, 
+	0xf420, 0xf400, 0xf400, 0xe380, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfce0, 0xfcc0, 0xfcc0, 
+	0xfcc0, 0xfcc0, 0xfcc0, 0xfca0, 0xfca0, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc60, 0xfc60, 0xfc60, 0xfc60, 0xf460, 0xf440, 0xf440, 
+	0xf440, 0xf420, 0xf420, 0xf400, 0xc320, 0xb44c, 0xe3c0, 0xf400, 0xf400, 0xf400, 0xf400, 0xdb80, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfca0, 0xfca0, 0xfca0, 0xfca0, 0xfc80, 0xfc80, 0xfc80, 0xfc80, 0xfc60, 0xfc60, 0xfc60, 
+	0xfc60, 0xfc40, 0xf440, 0xf440, 0xf440, 0xfc20, 0xfc20, 0xf420, 0xf420, 0xf420, 0xf400, 0xf400, 0xf400, 0xe3a0, 0xf3e0, 0xf3e0, 
+	0xf3e0, 0xf3e0, 0xf3e0, 0xe360, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfca0, 0xfc80, 0xfc80, 
+	0xfc80, 0xfc60, 0xfc80, 0xfc60, 0xfc60, 0xfc40, 0xfc40, 0xf440, 0xf420, 0xf420, 0xfc20, 0xf420, 0xf400, 0xf400, 0xf400, 0xf400, 
+	0xf400, 0xf3e0, 0xf3e0, 0xf3e0, 0xf3e0, 0xf3e0, 0xf3c0, 0xf3c0, 0xf3c0, 0xf3c0, 0xf3c0, 0xe360, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfc80, 0xfc60, 0xfc60, 0xfc60, 0xfc60, 0xfc40, 0xfc40, 0xfc40, 0xfc20, 0xfc20, 0xfc20, 
+	0xfc20, 0xf400, 0xf400, 0xf400, 0xf400, 0xf3e0, 0xf3e0, 0xf3e0, 0xf3e0, 0xf3e0, 0xf3c0, 0xf3c0, 0xf3c0, 0xf3c0, 0xf3c0, 0xf3a0, 
+	0xf3a0, 0xf3a0, 0xf3a0, 0xe340, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfc80, 0xfc60, 0xfc40, 
+	0xfc40, 0xfc20, 0xfc20, 0xfc20, 0xfc20, 0xf400, 0xf400, 0xf400, 0xf400, 0xf400, 0xf400, 0xf3e0, 0xf3e0, 0xf3e0, 0xf3e0, 0xf3c0, 
+	0xf3c0, 0xf3c0, 0xf3c0, 0xf3c0, 0xf3c0, 0xf3a0, 0xf3a0, 0xf3a0, 0xf3a0, 0xf3a0, 0xf3a0, 0xdb60, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd380, 0xfca0, 0xfc80, 0xfc80, 0xfc80, 0xfc60, 0xfc60, 0xf440, 0xf440, 0xf440, 0xf440, 
+	0xf420, 0xf420, 0xf420, 0xf400, 0xf400, 0xf400, 0xf400, 0xf400, 0xf400, 0xf3e0, 0xf3e0, 0xf3e0, 0xebe0, 0xf3c0, 0xf3c0, 0xf3c0, 
+	0xf3c0, 0xf3c0, 0xf3e0, 0x8a00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2020, 0x81c0, 0x9a21, 
+	0x9a21, 0x9a21, 0x9a21, 0x9a21, 0x9a21, 0x9a21, 0x9201, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 
+	0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91e1, 0x91c1, 0x6941, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'gear', 40x40px
+const uint16_t icon_gear [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x8578, 0x7d57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7d57, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0882, 0x8578, 0x8578, 
+	0x969c, 0x969c, 0x969c, 0x969c, 0x969c, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0882, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7d57, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x969c, 0x969c, 0x969c, 0x969c, 0x969c, 0x969c, 0x969c, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x7d57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8e3a, 0x969c, 0x969c, 0x969c, 
+	0x969c, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x967b, 0x969c, 0x969c, 0x969c, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x85b8, 0x969c, 0x969c, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0882, 0x8578, 0x969c, 0x969c, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0xbf1d, 0xbf3d, 0xbf3d, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x969c, 0x969c, 0x85b8, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0xbf3d, 0xbf3d, 0xbf3d, 0xbf3d, 0xbf3d, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x8578, 0x969c, 0x969c, 0x8578, 0x8578, 0x8578, 0x8578, 0xbf3d, 0xbf3d, 0xbf3d, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x4432, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8e1a, 0x969c, 0x8578, 0x8578, 0x8578, 0x8578, 0x9e5a, 0xbf3d, 
+	0xb6fc, 0x8578, 0x8578, 0x538f, 0x538f, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x33f1, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x969c, 0x969c, 0x8578, 0x8578, 0x8578, 0x8578, 0xbf3d, 0xbf3d, 0x8578, 0x5bb0, 0x0000, 0x0000, 0x0000, 0x0000, 0x5bb0, 0x8578, 
+	0x8578, 0x8578, 0x33d1, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 
+	0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x969c, 0x969c, 0x8578, 0x8578, 0x8578, 0x8578, 0xbf3d, 0x8578, 
+	0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x2bd1, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x969c, 0x8df9, 0x8578, 0x8578, 0x8578, 0x8578, 0xbf3d, 0x8578, 0x538f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x538f, 
+	0x8578, 0x8578, 0x8578, 0x2bd1, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 
+	0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x969c, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0xbf3d, 0x8578, 
+	0x538f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x538f, 0x8578, 0x8578, 0x8578, 0x2bd1, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x2bd1, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 
+	0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x5bb0, 0x0000, 0x0000, 0x0000, 0x0000, 0x5bb0, 0x8578, 0x8578, 0x8578, 0x33d1, 0x2bd1, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x538f, 0x538f, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x2bd1, 0x2bd1, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x2bd1, 0x2bd1, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x2bd1, 0x2bd1, 0x2bd1, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0882, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x33d1, 0x8578, 0x8578, 0x8578, 0x8578, 0x33d1, 0x2bd1, 0x2bd1, 0x33d1, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0882, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x4c73, 0x2bd1, 0x2bd1, 0x2bd1, 0x2bd1, 0x2bd1, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7d57, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x7d57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0882, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x0882, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 
+	0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 
+	0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x7d57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7d57, 0x8578, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x8578, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'graduation-cap_1f393', 40x40px
+const uint16_t icon_graduation_cap_1f393 [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x4208, 0x4208, 0x4208, 0x4208, 0x2965, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31a6, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x31a6, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39c7, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a69, 0x5acb, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x39c7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x5acb, 0x630c, 0x630c, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x7327, 0x4a69, 0x630c, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0xfe45, 0xfe45, 0x4208, 0x4208, 0x4208, 0xfe45, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x9cd3, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0xfe45, 0xfe45, 0x4208, 0xfe45, 0xfe45, 0xfe45, 0x5268, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x0000, 
+	0x0000, 0x0000, 0x9cf3, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x7b67, 0xfe45, 0xfe45, 0xfe45, 
+	0xfe45, 0xfe45, 0x4228, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9cf3, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9cd3, 0x9cf3, 0x4208, 0x4208, 0xf5e5, 0xfe45, 0xfe45, 0xfe45, 0xfe45, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x630c, 0x5aeb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9cf3, 
+	0xfe45, 0xfe45, 0xfe45, 0xfe45, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x5aeb, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8301, 0xfe45, 0xfe45, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 
+	0xe522, 0x2104, 0x4208, 0x9cf3, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x5aeb, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 0xe522, 0x2104, 0x2104, 0x2104, 0x9cf3, 0x9cf3, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x630c, 0x2104, 0x2104, 0x4208, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 
+	0xe522, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x9cf3, 0x738e, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4a69, 0x630c, 0x2104, 0x2104, 0x2945, 0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 0xe522, 0x2104, 0x2104, 0x2104, 0x4208, 0x2104, 0x2104, 0x9492, 
+	0x9cf3, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x5acb, 0x2104, 0x2104, 0x4208, 0x4208, 0x4208, 0x4208, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 
+	0xe522, 0xe522, 0x2104, 0x4208, 0x4208, 0x4208, 0x4208, 0x2104, 0x2104, 0x9cf3, 0x9cf3, 0x4208, 0x4208, 0x630c, 0x630c, 0x2104, 
+	0x2104, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 0xe522, 0xe522, 0x2104, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x2945, 0x2104, 0x2104, 0x9cf3, 0x630c, 0x2104, 0x2104, 0x2104, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9ba1, 
+	0x9ba1, 0x2104, 0x2104, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x2104, 0x2104, 0x2104, 0x2104, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9ba1, 0x9ba1, 0x72c2, 0x2104, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x630c, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 
+	0xe522, 0xe522, 0x2104, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 0xe522, 0xe522, 0x0000, 0x0000, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 0xe522, 
+	0xe522, 0xe522, 0x0000, 0x0000, 0x0000, 0x10a2, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 
+	0x4208, 0x4208, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 0xe522, 0xe522, 0xe522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x39e7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x39c7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 0xe522, 
+	0xe522, 0xe522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9b81, 0xe522, 0xe522, 0xe522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x51c0, 0xe522, 
+	0xe522, 0xe522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe522, 0x7281, 0xe522, 0xe522, 0xe522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbc41, 0x9ba1, 0xe522, 
+	0xe522, 0x9361, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'info', 40x40px
+const uint16_t icon_info [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04fc, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x04fc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x0000, 0x0479, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0417, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0xbf3f, 0xffff, 0xffff, 0xffff, 0xffff, 0x9eff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x5e3e, 0xffff, 0xffff, 0x561e, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x055d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x869e, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0xbf5f, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x767e, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0xffff, 0xffff, 0xffff, 0xffff, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 
+	0x0000, 0x0417, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x03d5, 0x0000, 0x0000, 0x0000, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x051d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x051d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x051d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x04fc, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0394, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 0x053d, 
+	0x053d, 0x053d, 0x0353, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'light', 40x40px
+const uint16_t icon_light [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xee4f, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe90, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xac8b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfeb0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfecf, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfe69, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe8c, 0xfe69, 
+	0xfe69, 0xfecf, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfecf, 0xfe69, 0xfe69, 0xfe8c, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfe69, 0xfecf, 0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 
+	0xfe69, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfe69, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfe69, 0xfe69, 0xfe69, 0xfe69, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2922, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x18c1, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0020, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3983, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x20e2, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 
+	0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfed0, 0xfe69, 0xfe69, 0xeed5, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9d56, 0x9d56, 0xadd8, 
+	0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x6b8e, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x9d56, 
+	0x9d56, 0x9d56, 0x9d56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0x9d76, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 
+	0xc67a, 0xcebb, 0xcebb, 0x6b8e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9d56, 0x9d56, 0x9d56, 
+	0x9d56, 0x9d56, 0xc67a, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xc67a, 0x9d56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 
+	0xcebb, 0xcebb, 0xcebb, 0xce9b, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbe39, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 
+	0x9d56, 0x9d56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9d56, 
+	0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x9d56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbe18, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0xbe39, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xcebb, 0xcebb, 0xcebb, 0xcebb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'numeric', 40x40px
+const uint16_t icon_numeric [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x0000, 0x0000, 0x0000, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x0000, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x6418, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x6418, 0xef9f, 0xef9f, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 
+	0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 
+	0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xaddb, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 
+	0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x7cb9, 0xd6fd, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 
+	0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0xd6dd, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0xd6fd, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 
+	0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0x63f7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 
+	0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe75e, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xaddb, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xffff, 0xffff, 0xe75e, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x4336, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 
+	0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x5bf7, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 
+	0x0000, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x0000, 0x0000, 0x0000, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 
+	0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x4336, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'question', 40x40px
+const uint16_t icon_question [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xe71c, 0xe71c, 0xd69a, 0xbdf7, 0xbdf7, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 
+	0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 
+	0xe71c, 0xc618, 0xbdf7, 0xbdd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8c71, 0xe71c, 0xffff, 0xffff, 0xffff, 
+	0xffff, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xce59, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xe71c, 0xffff, 0xffff, 0xffff, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 
+	0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xffff, 0xffff, 0xffff, 0xe71c, 0xe71c, 
+	0xdedb, 0xbdf7, 0xbdf7, 0x0020, 0x0000, 0x9cf3, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xe71c, 0xffff, 0xffff, 0xe71c, 0xdedb, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 
+	0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xffff, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0xbdf7, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x528a, 0xe71c, 0xe71c, 0xe71c, 0xdefb, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a49, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xe71c, 0xe71c, 0xe71c, 0xdedb, 0xbdf7, 0xbdf7, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 
+	0xe71c, 0xe71c, 0xe71c, 0xd6ba, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 
+	0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xc618, 0xbdf7, 0xa534, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 
+	0xc638, 0xbdf7, 0xbdd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xc638, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xc618, 0xbdf7, 
+	0xad55, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xce59, 0xbdf7, 0xbdd7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xe71c, 0xe71c, 0xe71c, 0xc618, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x4a69, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xce79, 0xbdf7, 0x9cd3, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbdf7, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xef5d, 0xffff, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xe71c, 0xffff, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xe71c, 0xe71c, 0xe71c, 0xe71c, 0xbdf7, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xbdf7, 0xbdf7, 0xbdf7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'satellite-antenna', 40x40px
+const uint16_t icon_satellite_antenna [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x1128, 0x0021, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x194a, 0x33df, 0x231d, 0x1abc, 0x233d, 0x33bf, 0x447f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x112c, 0x3bff, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a53, 0x1a11, 0x0000, 0x0000, 0x0000, 0x0020, 0x3bff, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2b7e, 0x2276, 0x2a98, 0x2b7e, 
+	0x3c1f, 0x0000, 0x0000, 0x112c, 0x54bf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2276, 0x443f, 0x0000, 0x0000, 0x33bf, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x6b4e, 0x0000, 0x0000, 
+	0x0000, 0x235e, 0x0000, 0x0000, 0x1abc, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x9cb2, 0xad55, 0xbdf8, 0xce5a, 0x0000, 0x0000, 0x2a32, 0x22b6, 0x0000, 0x1abb, 0x114a, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9cb2, 0xad35, 0xc619, 0xce7a, 0x0841, 
+	0x0000, 0x196d, 0x2b19, 0x0000, 0x1abc, 0x0063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39e7, 0x5acb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x9472, 0xa4f3, 
+	0x9cd3, 0x8c31, 0x738f, 0x8c32, 0x9cb4, 0xad16, 0xbd97, 0x0000, 0x0000, 0x2ab9, 0x0863, 0x0000, 0x2b9f, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa4f3, 
+	0xa514, 0xb596, 0xa514, 0x9cd3, 0x9492, 0x6b6d, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x7b8f, 0x8c32, 0x9c74, 0x526a, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9cb2, 0xa4f3, 0xa514, 0xbdb7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x83f0, 0x6b2d, 0x0000, 0xa4f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xbdb6, 
+	0xb576, 0xa4d3, 0xad34, 0xb596, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x8c51, 0x0000, 0x0000, 0xad35, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc5d6, 0xc5d7, 0xc5d7, 0xbdb7, 0xa4b4, 0xad15, 0xb596, 0xa534, 0x0000, 0x0000, 
+	0x0000, 0x9cd3, 0x0000, 0x0000, 0x0000, 0xad35, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc5d7, 0xc5f7, 
+	0xc5f8, 0xc5f8, 0xc5d8, 0x9cb4, 0xad15, 0xbdb7, 0xc618, 0x0000, 0x94b3, 0x0000, 0x0000, 0x0000, 0x0000, 0xa515, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5aab, 0xc5f7, 0xc5f8, 0xc5f8, 0xc5f9, 0xc5f8, 0xc5f8, 0xa4d5, 0xa4f5, 0xbd97, 0xce39, 
+	0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0xa4f4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbd95, 0xc5f7, 0xc5f8, 
+	0xc5f8, 0xce19, 0xce19, 0xce19, 0xc5f9, 0xbdd8, 0xa495, 0xb577, 0xd67a, 0x5aab, 0x0000, 0x0000, 0x0000, 0x9cd3, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbdb6, 0xc5f7, 0xc5d8, 0xcdf9, 0xce19, 0xce1a, 0xce1a, 0xce1a, 0xce1a, 0xc5b9, 0xa495, 
+	0xb537, 0xd65a, 0xc619, 0x0000, 0x0000, 0x9cd3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb555, 0xc5d8, 0xc5d8, 
+	0xcdf9, 0xce1a, 0xce1a, 0xce3a, 0xd63b, 0xce3b, 0xce1b, 0xcdda, 0x9c75, 0xad17, 0xc5d9, 0xd67a, 0x0000, 0x94b3, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xc5d8, 0xc5d8, 0xc5d9, 0xcdf9, 0xcdfa, 0xce1b, 0xd63b, 0xd63b, 0xd63b, 0xd63b, 
+	0xcdda, 0xb518, 0xacd7, 0xbd78, 0xce5a, 0x9492, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc5d7, 0xc5d8, 
+	0xc5d9, 0xc5da, 0xcdfa, 0xcdfb, 0xd61b, 0xd61c, 0xd63c, 0xd63c, 0xd61c, 0xcdfa, 0xc5ba, 0xa496, 0xb537, 0xc5d9, 0x8c31, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbd96, 0xc5d8, 0xc5b9, 0xc5da, 0xcdda, 0xcdfb, 0xcdfb, 0xd5fc, 0xd61c, 0xd63c, 
+	0xd63c, 0xd61c, 0xcdfb, 0xc59a, 0xa457, 0xacf7, 0xbd98, 0x8c12, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad34, 0xb576, 
+	0xc5b9, 0xc5d9, 0xc5ba, 0xcddb, 0xcddb, 0xcdfb, 0xd5fc, 0xd61c, 0xd61c, 0xd61c, 0xd61b, 0xcddb, 0xbd99, 0xa438, 0xac98, 0x0861, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xad13, 0xad55, 0xad36, 0xad36, 0xc5b9, 0xc5ba, 0xcdda, 0xcddb, 0xcddb, 0xcdfb, 0xd5fc, 
+	0xd5fc, 0xd5fc, 0xcdfc, 0xcddb, 0xc59a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xc5f8, 0xd67a, 0xd69b, 0xce39, 0xbdb7, 
+	0xbd98, 0xb578, 0xc5d9, 0xc5ba, 0xcdda, 0xcddb, 0xcddb, 0xcddb, 0xcddb, 0xcddb, 0xcdbb, 0xc59b, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xb555, 0xd67a, 0xde9c, 0xdedc, 0xe6dc, 0xde9b, 0xc5f9, 0xbdb9, 0xbd78, 0xc5b9, 0xcdda, 0xcdda, 0xcdda, 0xcdda, 
+	0xcdbb, 0xc59b, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce39, 0xd67b, 0xde9c, 0xde9b, 0xdebc, 0xe6fd, 
+	0xe6dc, 0xc619, 0xbd98, 0x4a29, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xce39, 0xd67b, 0xd67b, 0xbd98, 0xbd77, 0xdebc, 0xe6fd, 0xe71d, 0xde9c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce39, 0xd67b, 0xd65b, 0xce19, 0xb597, 0xdebc, 
+	0xe6dd, 0xe71d, 0xef3e, 0xe71d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xce39, 0xde9b, 0xdebc, 0xdebc, 0xdebc, 0xe6dc, 0xe6dd, 0xe6fd, 0xef1d, 0xef5e, 0xef5e, 0x2966, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xce39, 0xde9b, 0xdebc, 0xe6dc, 0xe6dd, 0xe6dd, 
+	0xe6dd, 0xe6fd, 0xe6fd, 0xef1d, 0xef5e, 0xf77e, 0xdebb, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xce39, 0xd67b, 0xdebc, 0xe6dc, 0xe6dd, 0xe6dd, 0xe6dd, 0xe6dd, 0xe6fd, 0xe6fd, 0xe6fd, 0xef3e, 0xf77e, 0xef5e, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xce39, 0xd67b, 0xde9b, 0xde9c, 0xde9c, 0xde9c, 
+	0xdebc, 0xdebc, 0xdebc, 0xdebc, 0xdebc, 0xe6dd, 0xe6fd, 0xef3d, 0xef1d, 0x2104, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xad15, 0xbd97, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 0xbdb8, 
+	0xbdb8, 0xbdd8, 0xc5d9, 0xd69b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa496, 0xacf7, 0xb4f8, 0xb4d8, 0xb4f8, 0xacf7, 0xb4f8, 0xb4f8, 
+	0xb4f8, 0xb4f8, 0xb4f8, 0xb4f8, 0xb4f8, 0xb4f8, 0xb4f8, 0xb4f8, 0xb4f8, 0xb518, 0xb538, 0xbd99, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 
+	0x3968, 0x3968, 0x3968, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'thermometer', 40x40px
+const uint16_t icon_thermometer [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4aec, 0xae9a, 0xae9a, 0x9596, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8d55, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0xae9a, 0xae9a, 0xffff, 0xffff, 0xf7df, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0x6baf, 0x8431, 0xffff, 0xffff, 0xffff, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0x4a4a, 0x4a4a, 0x4a4a, 0xffff, 0xffff, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xffff, 0xffff, 0xffff, 0xffff, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0xae9a, 0xffff, 0xffff, 0xffff, 0xffff, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xffff, 0xffff, 0xffff, 0xffff, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0x4a4a, 0x4a4a, 0x4a4a, 0xffff, 0xffff, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xffff, 0xffff, 0xffff, 0xffff, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0xae9a, 0xffff, 0xffff, 0xffff, 0xffff, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xfe97, 0xfe97, 0xe287, 0xe287, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0x4a4a, 0x4a4a, 0x4a4a, 0xe287, 0xe287, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xa659, 0xf636, 0xfe77, 0xe287, 0xe287, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0xae9a, 0xfe97, 0xfe77, 0xe287, 0xe287, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xfe97, 0xfe77, 0xe287, 0xe287, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0x4a4a, 0x4a4a, 0x4a4a, 0xe287, 0xe287, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0x4a4a, 0x4a4a, 0x4a4a, 0xe287, 0xe287, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0xae9a, 0xfe97, 0xfe56, 0xe287, 0xe287, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xfe97, 0xfe56, 0xe287, 0xe287, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0xae9a, 0xf656, 0xfe56, 0xe287, 0xe287, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0x4a4a, 0x4a4a, 0x4a4a, 0xe287, 0xe287, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xae9a, 0xae9a, 0xfe97, 0xfe36, 0xe287, 0xe287, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xae9a, 0xfe97, 0xfe36, 0xe287, 0xe287, 0xae9a, 0xae9a, 
+	0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 
+	0xae9a, 0xae9a, 0xfe97, 0xfe36, 0xe287, 0xe287, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xae9a, 0xe287, 0xe287, 0xfe97, 0xfe16, 0xe287, 0xe287, 0xe287, 0xadb8, 
+	0xae9a, 0xae9a, 0x1924, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xae9a, 
+	0xeb4a, 0xfe97, 0xfe97, 0xfe16, 0xe287, 0xe287, 0xe287, 0xd845, 0xae9a, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xe287, 0xfe97, 0xfe97, 0xfe97, 0xf532, 0xe287, 0xe287, 0xe287, 0xe287, 
+	0xd886, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xae9a, 0xe287, 
+	0xfe97, 0xfe97, 0xfe97, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xd845, 0xae9a, 0xae9a, 0x10c3, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xae9a, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 
+	0xd845, 0xae9a, 0xae9a, 0x3a6a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8d76, 0xae9a, 0xae9a, 0xe287, 
+	0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xd845, 0xd845, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xca8c, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xe287, 0xd845, 
+	0xae9a, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xae9a, 
+	0xd845, 0xe287, 0xe287, 0xe287, 0xe287, 0xe186, 0xd845, 0xd845, 0xae9a, 0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xae9a, 0xd845, 0xd845, 0xd845, 0xd845, 0xd845, 0xd845, 0xae9a, 
+	0xae9a, 0xae9a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x95b7, 0xae9a, 
+	0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0x95b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 0xae9a, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xae9a, 0xae9a, 0xae9a, 0xa659, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+// 'wifi-svgrepo-com', 40x40px
+const uint16_t icon_wifi [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x4c38, 0x3c19, 0x3c19, 0x4c38, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21a9, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x29ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1a0c, 0x1a0c, 0x1a0c, 0x1a0c, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x64da, 0x9ddb, 0x9ddb, 0x9ddb, 0x9ddb, 0x9ddb, 0x9ddb, 0x9ddb, 0x73ae, 
+	0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x4c59, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x0000, 0x0000, 
+	0x0000, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x0000, 0x29ea, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x4a69, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3af0, 0x3c19, 0x3c19, 0x3b53, 0x3c19, 0x3c19, 0x3bf8, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x6bb0, 0x324b, 0x324b, 0x324b, 0x324b, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x324b, 0x3b12, 0x3c19, 
+	0x324b, 0x324b, 0x3c19, 0x324b, 0x3a8d, 0x3c19, 0x324b, 0x324b, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0x324b, 0x324b, 0x324b, 0x324b, 0x324b, 0xef7d, 0xef7d, 0x324b, 0x9d15, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x324b, 0x324b, 0x3c19, 0x324b, 0x324b, 0x3c19, 0x324b, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x324b, 0x94f4, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3acf, 0x324b, 0x3b11, 
+	0x324b, 0x324b, 0x3c19, 0x324b, 0x3c19, 0x3c19, 0x324b, 0x324b, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0x324b, 0x94f4, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x324b, 0x94f5, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x324b, 0x324b, 0x324b, 0x324b, 0x324b, 0x324b, 0x3c19, 0x3c19, 0x324b, 0x324b, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x324b, 0x324b, 0x324b, 0x324b, 0x324b, 0xef7d, 0xef7d, 
+	0x324b, 0x94f4, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x324b, 0x324b, 
+	0x3af0, 0x324b, 0x324b, 0x324b, 0x3c19, 0x3c19, 0x324b, 0x324b, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0x324b, 0x94f4, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x324b, 0x94f4, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x324b, 0x324b, 0x3c19, 0x324b, 0x324b, 0x3c19, 0x3c19, 0x3c19, 0x324b, 0x324b, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x324b, 0x94f4, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0x324b, 0x94f4, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x324b, 0x324b, 
+	0x3c19, 0x3b32, 0x324b, 0x3c19, 0x3c19, 0x3c19, 0x324b, 0x324b, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0x324b, 0x94f4, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x324b, 0x94f4, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0x29ea, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3b53, 0x3c19, 0x3c19, 0x3acf, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xa556, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0x324b, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x5acb, 0x0000, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x0000, 
+	0x0000, 0x0000, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 
+	0x3c19, 0x3c19, 0x3c19, 0x3c19, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x1a0c, 0x1a0c, 0x1a0c, 
+	0x1a0c, 0x8d9b, 0x8d9b, 0x8d9b, 0x8d9b, 0x8d9b, 0x8d9b, 0x8d9b, 0x8d9b, 0x9dfb, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4a69, 0xef7d, 
+	0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0xef7d, 0x4a49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdedb, 0xef7d, 0xef7d, 0xdefb, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+// 'sunglasses', 50x10px
+const uint16_t icon_sunglasses [] PROGMEM = {
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xffff, 0xffff, 0x18c3, 0x18c3, 0xffff, 0xc618, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0xffff, 0xffff, 0x18c3, 0x18c3, 0xffff, 0xffff, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xffff, 0xffff, 0x18c3, 0x18c3, 0xffff, 0xc618, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xffff, 0xffff, 0x18c3, 0x18c3, 0xffff, 0xffff, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xffff, 0xffff, 
+	0x18c3, 0x8430, 0xffff, 0x630c, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xffff, 0xffff, 0x18c3, 0x18c3, 0xffff, 0xffff, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0xffff, 0xffff, 0x18c3, 0x8430, 0xffff, 0x630c, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xffff, 0xffff, 0x18c3, 0x18c3, 0xffff, 
+	0xffff, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xffff, 0xc618, 0x18c3, 0xdedb, 0xffff, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xffff, 
+	0xffff, 0x18c3, 0x18c3, 0xffff, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0xffff, 0xc618, 0x18c3, 0xdedb, 0xffff, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0xffff, 0xffff, 0x18c3, 0x18c3, 0xffff, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 
+	0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000
+};
+
+// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 528)
+const int icon_allArray_LEN = 1;
+const uint16_t* icon_allArray[1] = {
+	icon_sunglasses
+};
+
+
+// 'potted-plant', 40x40px
+const uint16_t icon_potted_plant [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0040, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0020, 0x4be2, 0x1140, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3ba1, 0x6461, 0x2a01, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x2b01, 0x5421, 0x6481, 0x32e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08e0, 0x19e0, 
+	0x08e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2281, 0x33a1, 0x5c41, 0x5c61, 0x3361, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x19c0, 0x6463, 0x74e4, 0x2a81, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0020, 0x2341, 0x3be1, 0x74c2, 0x5c41, 0x2b81, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a00, 0x7ce5, 0x9d66, 0xa5a8, 0x3b41, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2240, 0x1b41, 0x4c21, 0x6cc1, 0x4c01, 0x2361, 0x0000, 0x0000, 
+	0x19e0, 0x6ca3, 0x9586, 0xade9, 0xbe6b, 0x5c23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08e0, 0x1140, 0x1140, 0x0040, 0x0000, 
+	0x2341, 0x2b81, 0x6461, 0x6461, 0x3bc1, 0x1b41, 0x08a0, 0x3ba1, 0x7523, 0x95a5, 0xade9, 0xbe6b, 0x7ce5, 0x0880, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x2201, 0x8505, 0x9566, 0x8d46, 0x8525, 0x6ca4, 0x2201, 0x1b41, 0x33c1, 0x6ca1, 0x5c21, 0x2b81, 0x1b41, 0x3b81, 0x6d22, 
+	0x8584, 0xb62b, 0xbe6c, 0x9566, 0x19e0, 0x0000, 0x0020, 0x0040, 0x0880, 0x0880, 0x0880, 0x0860, 0x0060, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x53c2, 0x8d46, 0xbe4b, 0xbe6b, 0xbe6c, 0xbe6c, 0xbe6c, 0xbe4b, 
+	0x43a2, 0x4401, 0x6cc1, 0x4c21, 0x2361, 0x2341, 0x5ce1, 0x7d43, 0xbe6b, 0xbe6c, 0x9da7, 0x6443, 0x2281, 0x2b41, 0x3ba1, 0x5401, 
+	0x5c41, 0x6461, 0x5c21, 0x43c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08a0, 0x5422, 
+	0xa5c8, 0xade9, 0xade9, 0xade8, 0xa5c8, 0x9da8, 0xa5c8, 0xbe6b, 0xbe6c, 0x5c43, 0x74c2, 0x4be1, 0x1b41, 0x4401, 0x7523, 0xbe6c, 
+	0xbe6c, 0xade9, 0x9d87, 0x2b61, 0x2ba1, 0x5441, 0x74e2, 0x7d22, 0x6c81, 0x5c41, 0x43c1, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1100, 0x5461, 0x6502, 0x7523, 0x8d85, 0x9da6, 0xade7, 0xade7, 0xa5e6, 0x95a5, 0x7d83, 
+	0x7d44, 0xbe4b, 0x6482, 0x4c21, 0x1341, 0x5ca1, 0xbe4b, 0xbe6c, 0xbe4b, 0xade7, 0x8505, 0x4401, 0x8543, 0x8543, 0x6ca1, 0x6c81, 
+	0x5441, 0x43a1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1160, 0x3b61, 0x2ae1, 0x2220, 
+	0x1980, 0x1160, 0x2221, 0x43a2, 0x74c4, 0x8d46, 0x8d65, 0x7d63, 0x7562, 0x6502, 0x8d66, 0x4401, 0x1b41, 0x6ca3, 0xadea, 0xb64b, 
+	0xa5c7, 0xa5c7, 0x3ba1, 0x8543, 0x7d02, 0x6ca1, 0x6481, 0x5421, 0x3ba1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1100, 0x2a80, 0x3b41, 
+	0x4c22, 0x5ca1, 0x5481, 0x3341, 0x2ac0, 0x53c3, 0x53e3, 0x6c85, 0x8505, 0x9546, 0x7d23, 0x6cc2, 0x6ca1, 0x6461, 0x4c01, 0x3ba1, 
+	0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x08e0, 0x2ac1, 0x3bc1, 0x5401, 0x5c41, 0x5c21, 0x3b41, 0x2a40, 0x2a40, 0x2a20, 0x2a80, 0x2aa0, 0x5c04, 0xc68c, 0xa5c8, 0x9566, 
+	0x9d87, 0x8d26, 0x5422, 0x5421, 0x5c61, 0x4401, 0x33a1, 0x1120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2341, 0x2b61, 0x3be1, 0x5441, 0x6461, 0x6ca1, 0x6481, 0x4c21, 0x3381, 
+	0x32c1, 0x2aa0, 0x2a60, 0x2a20, 0xa5c9, 0xc68c, 0xc6ac, 0xc6ac, 0xbe6b, 0xadc7, 0xa5e6, 0x8545, 0x5442, 0x3361, 0x1160, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08a0, 0x2341, 0x2361, 
+	0x3bc1, 0x5c61, 0x6cc2, 0x6cc1, 0x6481, 0x4c21, 0x3bc1, 0x2b81, 0x3b81, 0x74a4, 0x74e4, 0x8d26, 0x64e2, 0x7d63, 0x8d85, 0x9da7, 
+	0xbe4b, 0xc6ac, 0xb62a, 0x9dc6, 0x8584, 0x5422, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2341, 0x1b61, 0x3bc1, 0x4c01, 0x6461, 0x6c81, 0x5c61, 0x4c01, 0x2ba1, 0x5403, 0x9566, 
+	0xa5a7, 0xa5e8, 0xbe6b, 0xa5e9, 0x5cc1, 0x7563, 0x85a4, 0x95c5, 0xade7, 0xadc7, 0xbe6c, 0xb64a, 0x95a5, 0x7523, 0x2240, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1a41, 0x2341, 0x33a1, 0x43a1, 
+	0x4ba1, 0x4ba1, 0x53c1, 0x43c1, 0x3ba1, 0x8d46, 0xadc7, 0xade7, 0xbe6b, 0xbe6b, 0xa5c8, 0x6d22, 0x43a1, 0x6d22, 0x7d83, 0x8da5, 
+	0xa5c6, 0xae07, 0xb608, 0xbe4b, 0xb62a, 0x8584, 0x6ce3, 0x08e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x2341, 0x2aa1, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b61, 0x8d65, 0xade7, 0xade8, 0xc68b, 
+	0xbe6b, 0x8d85, 0x7d63, 0x6522, 0x19c0, 0x4c41, 0x7542, 0x85a4, 0x9dc6, 0xade7, 0xb608, 0xb608, 0xb62a, 0xb64a, 0x7d63, 0x5441, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x19c0, 0x0020, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x19c0, 0x7d24, 0x9dc6, 0xb629, 0xc68b, 0xae09, 0x9dc6, 0x8584, 0x7542, 0x5ce1, 0x19c0, 0x19a0, 0x4be1, 0x7543, 
+	0x95a5, 0xa5e6, 0xae07, 0xb608, 0xade7, 0xb62a, 0x8565, 0x6d22, 0x2ac1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1140, 0x7523, 0x95a5, 0xbe6b, 0xc68b, 0xade8, 0xa5e6, 
+	0x8da5, 0x7d83, 0x6502, 0x3b81, 0x21e0, 0x21c0, 0x21c0, 0x3b61, 0x7504, 0x95a5, 0xade7, 0xb608, 0xae07, 0xa5c6, 0xbe6b, 0x7563, 
+	0x5ca1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0060, 0x64e2, 0x8584, 0xbe6b, 0xae09, 0xae08, 0xade7, 0x95a5, 0x8564, 0x6ce2, 0x3b81, 0x3221, 0x3221, 0x2a20, 0x2a20, 0x39a1, 
+	0x39c1, 0x4381, 0x8505, 0x9566, 0xa5c7, 0xade7, 0x95a5, 0x8d85, 0x6d22, 0x19e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3b61, 0x7d43, 0xb62a, 0xa5c7, 0xb608, 0xa5c7, 0x8d25, 0x5402, 
+	0x5b61, 0x82c1, 0x9a81, 0x9a81, 0x9261, 0x9241, 0x8a02, 0x79a2, 0x6161, 0x5921, 0x5961, 0x6a01, 0x5b82, 0x8d26, 0x9da6, 0x95a5, 
+	0x7563, 0x3b61, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08a0, 
+	0x6ce2, 0x9dc7, 0x9da6, 0xa5c7, 0x9566, 0x63e2, 0xa301, 0xa2c0, 0x9a81, 0x9a81, 0x9a81, 0x9aa1, 0x9a81, 0x9241, 0x81e1, 0x79a2, 
+	0x6981, 0x5941, 0x5941, 0x71e2, 0x8ac5, 0x0880, 0x5c03, 0x8d85, 0x8583, 0x5462, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3301, 0x7d64, 0x8d85, 0x8d65, 0x5c03, 0x8301, 0xb320, 0xb320, 0xaae0, 
+	0x9aa1, 0x9a81, 0xa2c1, 0xa2c1, 0x9a81, 0x9241, 0x81e1, 0x79a2, 0x7182, 0x6161, 0x6161, 0x8264, 0x7224, 0x0000, 0x0000, 0x3301, 
+	0x7d44, 0x6ce2, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5c62, 
+	0x7d44, 0x53e2, 0x0880, 0x0000, 0x0000, 0x8a84, 0x8242, 0x92a3, 0x9ac3, 0xa302, 0xab23, 0xab23, 0xa302, 0x9aa3, 0x9283, 0x8a85, 
+	0x8285, 0x61c2, 0x5961, 0x6982, 0x0020, 0x0000, 0x0000, 0x0000, 0x2200, 0x6ca3, 0x08e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x64a2, 0x4ba2, 0x0000, 0x0000, 0x0000, 0x0000, 0x92c4, 0x9a81, 0x9241, 
+	0x8a21, 0x8a01, 0x81e2, 0x81e2, 0x79e2, 0x79a2, 0x79a2, 0x79a2, 0x79a2, 0x71a2, 0x69a1, 0x71a2, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x1160, 0x1100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4bc2, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8a62, 0xab00, 0xab00, 0xab00, 0xa2e0, 0x9a81, 0x8a01, 0x81c1, 0x79a2, 0x79a2, 0x79a2, 
+	0x79a2, 0x79c2, 0x7a02, 0x6181, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x08a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x71e1, 0xb340, 0xb360, 
+	0xbb60, 0xbb60, 0xab00, 0x9a81, 0x8a01, 0x81c1, 0x79a2, 0x79a2, 0x79a2, 0x8202, 0x8a62, 0x5941, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5141, 0xb360, 0xbb60, 0xbb60, 0xbb60, 0xb340, 0xa2a0, 0x8a40, 0x81e1, 0x79a2, 0x79a2, 
+	0x79c2, 0x8a02, 0x9ac3, 0x4101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30c0, 0xb361, 0xbb60, 
+	0xbb60, 0xbb60, 0xb320, 0xa2a0, 0x9240, 0x81e1, 0x79a2, 0x79a2, 0x81c2, 0x8a42, 0xa2e3, 0x28c0, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xb362, 0xb360, 0xbb60, 0xbb60, 0xab20, 0x9aa0, 0x9240, 0x81e1, 0x79a2, 0x79a2, 
+	0x81e2, 0x9262, 0xa2e3, 0x1840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb362, 0xb340, 
+	0xbb60, 0xbb40, 0xab00, 0x9a80, 0x8a40, 0x81e1, 0x79a2, 0x79a2, 0x8202, 0x9262, 0xa303, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xb363, 0xb320, 0xbb40, 0xb320, 0xa2e0, 0x9280, 0x8a20, 0x81e1, 0x79a2, 0x79a2, 
+	0x8a02, 0x92a2, 0xa303, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8242, 0xb320, 
+	0xbb40, 0xb300, 0xa2c0, 0x9260, 0x8a20, 0x81c1, 0x79a2, 0x81c2, 0x8a22, 0x9aa3, 0x7a02, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30a0, 0x8201, 0xb320, 0xa2c0, 0x9260, 0x8a20, 0x81c1, 0x79a1, 0x81e2, 
+	0x71c2, 0x30c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x1840, 0x2880, 0x30a0, 0x28a0, 0x1860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+// 'Plant2', 120x120px
+const uint16_t icon_vase_plant [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 
+	0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 
+	0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 
+	0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 
+	0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 
+	0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 
+	0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 
+	0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 
+	0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 
+	0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 
+	0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 
+	0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 
+	0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 
+	0xb105, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 
+	0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 
+	0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 
+	0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 
+	0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 
+	0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 
+	0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 
+	0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 
+	0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 
+	0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 
+	0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 
+	0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0xb105, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 
+	0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 0x70a5, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xcfbc, 0xcfbc, 
+	0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 
+	0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xcfbc, 0xcfbc, 
+	0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 
+	0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xcfbc, 0xcfbc, 
+	0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 
+	0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xcfbc, 0xcfbc, 
+	0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 
+	0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xcfbc, 0xcfbc, 
+	0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0xcfbc, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 
+	0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x96f7, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5d71, 0x5d71, 
+	0x5d71, 0x5d71, 0x5d71, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x342c, 0x342c, 
+	0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2205, 0x2205, 0x2205, 
+	0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x342c, 0x342c, 0x342c, 0x342c, 0x342c, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2205, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 0x2329, 
+	0x2329, 0x2329, 0x2329, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+
+
+// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 25856)
+// 'Plant1', 120x120px
+const uint16_t icon_Plant1 [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0xadc6, 0xadc6, 
+	0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 
+	0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 
+	0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 
+	0xadc6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 
+	0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xadc6, 0xadc6, 0xadc6, 0xadc6, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 
+	0x5b06, 0x5b06, 0x5b06, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 
+	0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x3145, 0x3145, 0x3145, 0x3145, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 0x5b06, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x7c68, 0x7c68, 0x7c68, 0x7c68, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+// 'Plant3', 120x120px
+const uint16_t icon_cactus1 [] PROGMEM = {
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xffb7, 0xffb7, 
+	0xffb7, 0xffb7, 0xffb7, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xffb7, 0xffb7, 
+	0xffb7, 0xffb7, 0xffb7, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xeef2, 0xeef2, 
+	0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xeef2, 0xeef2, 
+	0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xeef2, 0xeef2, 
+	0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xffb7, 0xffb7, 0xffb7, 0xffb7, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xeef2, 0xeef2, 0xeef2, 
+	0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xeef2, 0xeef2, 0xeef2, 
+	0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xeef2, 
+	0xeef2, 0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xeef2, 
+	0xeef2, 0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0xeef2, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x94a8, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 
+	0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0xc5cb, 0xc5cb, 0xc5cb, 0xc5cb, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 0x94a8, 
+	0x94a8, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 0x6347, 0x6347, 
+	0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x6347, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xec46, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0xec46, 0xec46, 0xec46, 0xec46, 0xec46, 0xb2c5, 0xb2c5, 0xb2c5, 
+	0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0xb2c5, 0x61c6, 0x61c6, 
+	0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x61c6, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 
+	0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x3145, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+
+
+const byte plantArrLen=3;
+const uint16_t * plantArray[]
+{
+	icon_Plant1,
+	icon_cactus1,
+	icon_vase_plant
+};
+
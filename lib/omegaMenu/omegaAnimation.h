@@ -0,0 +1,310 @@
+/**
+ * @file omegaAnimation.h
+ * @brief Keyframe timelines for sprite layers with dirty rectangles
+ *
+ * A scene stacks a few layers, e.g. avatar, accessory, thought bubble and
+ * icons. Each layer shows one frame of its sprite sheet, or calls a draw
+ * function for shapes, at a position taken from its track. A track is a
+ * list of keyframes in milliseconds: the position is interpolated towards
+ * the next key, the frame switches at the key.
+ *
+ * update() evaluates all tracks for the current time. A layer whose frame,
+ * image or position changed is dirty, its dirty rect covers where it was
+ * drawn last and where it is now. The caller only redraws and pushes those
+ * rects, layers that did not change are not drawn again.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGAANIMATION_H
+#define OMEGAANIMATION_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <omegaImage.h>
+
+/** Settings */
+#define ANIM_MAX_LAYERS 6
+/** End Settings */
+
+#define ANIM_HIDDEN 0xFF // Key frame that hides the layer
+
+enum animEase : uint8_t {
+    ANIM_STEP,       // Hold the key until the next one
+    ANIM_LINEAR,     // Move towards the next key at constant speed
+    ANIM_EASE_IN_OUT // Smoothstep towards the next key
+};
+
+/**
+ * @struct animKey
+ * @brief Keyframe, ease describes the way to the next key
+ */
+struct animKey {
+    uint16_t at;   // Milliseconds from the start of the track
+    int16_t x;
+    int16_t y;
+    uint8_t frame; // Sprite sheet index or draw function frame, ANIM_HIDDEN
+    uint8_t ease;  // animEase
+};
+
+/**
+ * @struct animTrack
+ * @brief Keys sorted by time
+ */
+struct animTrack {
+    const animKey* keys;
+    uint8_t count;
+    uint16_t duration; // Loop length, 0 plays once and holds the last key
+};
+
+/**
+ * @struct animRect
+ * @brief Screen rectangle, empty if w or h is not positive
+ */
+struct animRect {
+    int16_t x = 0;
+    int16_t y = 0;
+    int16_t w = 0;
+    int16_t h = 0;
+
+    bool empty() const { return w <= 0 || h <= 0; }
+
+    void add(const animRect& r) {
+        if (r.empty()) return;
+        if (empty()) {
+            *this = r;
+            return;
+        }
+        int16_t right = max(x + w, r.x + r.w);
+        int16_t bottom = max(y + h, r.y + r.h);
+        x = min(x, r.x);
+        y = min(y, r.y);
+        w = right - x;
+        h = bottom - y;
+    }
+
+    bool intersects(int16_t rx, int16_t ry, int16_t rw, int16_t rh) const {
+        return !empty() && rw > 0 && rh > 0 && rx < x + w && x < rx + rw && ry < y + h && y < ry + rh;
+    }
+
+    void clip(int16_t width, int16_t height) {
+        if (x < 0) { w += x; x = 0; }
+        if (y < 0) { h += y; y = 0; }
+        if (x + w > width) w = width - x;
+        if (y + h > height) h = height - y;
+    }
+};
+
+/** Draws frame of a shape layer with its top left corner at x, y */
+typedef void (*animDrawFunction)(TFT_eSprite* sprite, int32_t x, int32_t y, uint8_t frame, void* ctx);
+
+/**
+ * @class animLayer
+ * @brief One layer of a scene, setters take effect on the next update()
+ */
+class animLayer {
+    friend class omegaAnimator;
+
+private:
+    const animTrack* track = nullptr;
+    const omegaPackedImage* const* sheet = nullptr;
+    uint8_t sheetLen = 0;
+    animDrawFunction drawFunction = nullptr;
+    void* ctx = nullptr;
+    int16_t width = 0;  // Bounds of draw function frames
+    int16_t height = 0;
+    int16_t offsetX = 0;
+    int16_t offsetY = 0;
+    bool visible = true;
+    bool changed = true;
+
+    // Evaluated by update()
+    int16_t x = 0;
+    int16_t y = 0;
+    uint8_t frame = ANIM_HIDDEN;
+    animRect bounds; // Now
+    animRect drawn;  // On screen since the last clean()
+    bool dirty = true;
+
+    const omegaPackedImage* image() const {
+        return sheet && frame < sheetLen ? sheet[frame] : nullptr;
+    }
+
+public:
+    void setTrack(const animTrack* t) {
+        if (track == t) return;
+        track = t;
+        changed = true;
+    }
+
+    /** @brief Frames of the sprite sheet, the array must stay valid */
+    void setSheet(const omegaPackedImage* const* frames, uint8_t count) {
+        if (sheet == frames && sheetLen == count) return;
+        sheet = frames;
+        sheetLen = count;
+        changed = true;
+    }
+
+    /** @brief Draw shapes instead of images, w x h bounds every frame */
+    void setDraw(animDrawFunction fn, int16_t w, int16_t h, void* context = nullptr) {
+        drawFunction = fn;
+        width = w;
+        height = h;
+        ctx = context;
+        changed = true;
+    }
+
+    /** @brief Moves the whole track, e.g. an accessory along with its avatar */
+    void setOffset(int16_t dx, int16_t dy) {
+        if (offsetX == dx && offsetY == dy) return;
+        offsetX = dx;
+        offsetY = dy;
+        changed = true;
+    }
+
+    void setVisible(bool show) {
+        if (visible == show) return;
+        visible = show;
+        changed = true;
+    }
+
+    /** @brief Draw again on the next update(), e.g. a draw function shows something new */
+    void invalidate() { changed = true; }
+
+    bool isDirty() const { return dirty; }
+};
+
+/**
+ * @class omegaAnimator
+ * @brief Plays the tracks of a scene on a shared clock
+ */
+class omegaAnimator {
+private:
+    animLayer layers[ANIM_MAX_LAYERS];
+    uint8_t layerCount = 0;
+    uint32_t startedAt = 0;
+
+    static int16_t lerp(int16_t a, int16_t b, int32_t u) { return a + ((b - a) * u) / 256; }
+
+    static void sample(const animTrack& track, uint32_t t, int16_t& x, int16_t& y, uint8_t& frame) {
+        if (track.duration) t %= track.duration;
+
+        uint8_t i = 0;
+        while (i + 1 < track.count && track.keys[i + 1].at <= t) i++;
+        const animKey& a = track.keys[i];
+        x = a.x;
+        y = a.y;
+        frame = a.frame;
+        if (a.ease == ANIM_STEP || i + 1 >= track.count || t < a.at) return;
+
+        const animKey& b = track.keys[i + 1];
+        int32_t u = ((t - a.at) << 8) / (b.at - a.at); // 0..255
+        if (a.ease == ANIM_EASE_IN_OUT) u = (u * u * (3 * 256 - 2 * u)) >> 16;
+        x = lerp(a.x, b.x, u);
+        y = lerp(a.y, b.y, u);
+    }
+
+public:
+    /** @brief Next free layer, drawn above the ones added before, nullptr if full */
+    animLayer* add() { return layerCount < ANIM_MAX_LAYERS ? &layers[layerCount++] : nullptr; }
+
+    uint8_t count() const { return layerCount; }
+
+    /** @brief Restart all tracks from their first key */
+    void start(uint32_t now) { startedAt = now; }
+
+    /**
+     * @brief Evaluate the tracks
+     * @return Number of dirty layers
+     */
+    uint8_t update(uint32_t now) {
+        uint32_t t = now - startedAt;
+        uint8_t dirtyCount = 0;
+
+        for (uint8_t i = 0; i < layerCount; i++) {
+            animLayer& l = layers[i];
+            int16_t x = 0;
+            int16_t y = 0;
+            uint8_t frame = 0;
+            if (l.track && l.track->count) sample(*l.track, t, x, y, frame);
+            if (!l.visible) frame = ANIM_HIDDEN;
+
+            if (l.changed || x != l.x || y != l.y || frame != l.frame) {
+                l.x = x;
+                l.y = y;
+                l.frame = frame;
+                l.changed = false;
+
+                animRect r;
+                const omegaPackedImage* img = l.image();
+                if (img) {
+                    r.w = img->width;
+                    r.h = img->height;
+                } else if (l.drawFunction && frame != ANIM_HIDDEN) {
+                    r.w = l.width;
+                    r.h = l.height;
+                }
+                r.x = x + l.offsetX;
+                r.y = y + l.offsetY;
+                if (r.empty()) r = animRect();
+
+                // Also a new frame at the same place, its pixels changed
+                l.dirty = true;
+                l.bounds = r;
+            }
+            if (l.dirty) dirtyCount++;
+        }
+        return dirtyCount;
+    }
+
+    /**
+     * @brief Area to redraw for a layer, old and new bounds together
+     * @return False if the layer is not dirty or its area is off screen
+     */
+    bool dirtyRect(uint8_t index, animRect& r, int16_t width, int16_t height) const {
+        if (index >= layerCount || !layers[index].dirty) return false;
+        r = layers[index].drawn;
+        r.add(layers[index].bounds);
+        r.clip(width, height);
+        return !r.empty();
+    }
+
+    /**
+     * @brief One area covering the dirty rects of all layers
+     * The background behind it is drawn once per frame instead of once per layer.
+     * @return False if nothing on screen changed
+     */
+    bool dirtyBounds(animRect& r, int16_t width, int16_t height) const {
+        r = animRect();
+        animRect layer;
+        for (uint8_t i = 0; i < layerCount; i++) {
+            if (dirtyRect(i, layer, width, height)) r.add(layer);
+        }
+        return !r.empty();
+    }
+
+    /** @brief Draw all layers, clipped by the sprite's viewport */
+    void draw(TFT_eSprite* sprite) const {
+        for (uint8_t i = 0; i < layerCount; i++) {
+            const animLayer& l = layers[i];
+            if (l.frame == ANIM_HIDDEN || l.bounds.empty()) continue;
+            const omegaPackedImage* img = l.image();
+            if (img) pushPackedImage(sprite, l.bounds.x, l.bounds.y, *img);
+            else if (l.drawFunction) l.drawFunction(sprite, l.bounds.x, l.bounds.y, l.frame, l.ctx);
+        }
+    }
+
+    /** @brief The dirty rects are on screen now */
+    void clean() {
+        for (uint8_t i = 0; i < layerCount; i++) {
+            layers[i].drawn = layers[i].bounds;
+            layers[i].dirty = false;
+        }
+    }
+};
+
+#endif // OMEGAANIMATION_H
@@ -0,0 +1,182 @@
+/**
+ * @file omegaAssets.h
+ * @brief Icons and fonts read in place from an asset partition
+ *
+ * tools/omegaAssetPack.py packs icons, avatars, accessories and VLW fonts
+ * into one image that is flashed into its own data partition. begin() maps
+ * the partition into the data address space with esp_partition_mmap, so
+ * image() and font() hand out pointers into flash without copying.
+ *
+ * Layout, little endian, offsets from the start of the partition:
+ *  - assetHeader
+ *  - assetEntry[count], sorted by name
+ *  - Data, every entry 4-byte aligned. Images are their palette, byte
+ *    swapped if the entry's flags say so, followed by the omegaImage.h
+ *    packet stream, fonts are the VLW file.
+ *
+ * The artwork can be reflashed without the app, e.g.
+ *  parttool.py write_partition --partition-name assets --input assets.bin
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGAASSETS_H
+#define OMEGAASSETS_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <omegaImage.h>
+
+/** Settings */
+#define ASSET_PARTITION_LABEL "assets"
+#define ASSET_PARTITION_SUBTYPE 0x40  // Custom data subtype, see partitions.csv
+/** End Settings */
+
+#define ASSET_MAGIC 0x3150414F // "OAP1"
+#define ASSET_VERSION 1
+#define ASSET_NAME_LEN 32
+
+enum assetType : uint8_t {
+    ASSET_IMAGE = 1,
+    ASSET_FONT = 2
+};
+
+/**
+ * @struct assetHeader
+ * @brief Start of the partition
+ */
+struct assetHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count; // Entries
+    uint32_t size;  // Bytes used, header included
+};
+
+/**
+ * @struct assetEntry
+ * @brief Lookup table entry
+ */
+struct assetEntry {
+    char name[ASSET_NAME_LEN]; // Null terminated
+    uint8_t type;              // assetType
+    uint8_t bits;              // Images: omegaPackedImage fields
+    uint8_t transparent;
+    uint8_t flags;             // Images: PACKED_SWAPPED, 0 in packs made before the flag
+    uint16_t width;
+    uint16_t height;
+    uint16_t colors;
+    uint16_t reserved2;
+    uint32_t offset;           // From the start of the partition
+    uint32_t size;             // Bytes, palette included
+};
+
+static_assert(sizeof(assetHeader) == 12, "assetHeader layout is shared with tools/omegaAssetPack.py");
+static_assert(sizeof(assetEntry) == 52, "assetEntry layout is shared with tools/omegaAssetPack.py");
+
+/**
+ * @class omegaAssets
+ * @brief Zero-copy lookups in the mapped asset partition
+ */
+class omegaAssets {
+private:
+    const uint8_t* base = nullptr;
+    const assetEntry* entries = nullptr;
+    uint16_t entryCount = 0;
+    spi_flash_mmap_handle_t handle = 0;
+
+    // Checks the table so lookups can trust offsets and sizes
+    bool validate(const uint8_t* data, uint32_t size) {
+        const assetHeader* header = (const assetHeader*)data;
+        if (size < sizeof(assetHeader) || header->magic != ASSET_MAGIC || header->version != ASSET_VERSION) return false;
+        if (header->size > size || sizeof(assetHeader) + header->count * sizeof(assetEntry) > header->size) return false;
+
+        const assetEntry* table = (const assetEntry*)(data + sizeof(assetHeader));
+        for (uint16_t i = 0; i < header->count; i++) {
+            const assetEntry& e = table[i];
+            if (e.name[ASSET_NAME_LEN - 1] != '\0' || (e.offset & 3)) return false;
+            if (e.offset > header->size || e.size > header->size - e.offset) return false;
+            if (e.type == ASSET_IMAGE && e.size < e.colors * 2u) return false;
+        }
+        return true;
+    }
+
+public:
+    /**
+     * @brief Map the partition
+     * @return False if it is missing or does not hold an asset pack
+     */
+    bool begin(const char* label = ASSET_PARTITION_LABEL) {
+        if (base) return true;
+
+        const esp_partition_t* part =
+            esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE, label);
+        if (!part) return false;
+
+        const void* ptr;
+        if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &ptr, &handle) != ESP_OK) return false;
+
+        if (!validate((const uint8_t*)ptr, part->size)) {
+            spi_flash_munmap(handle);
+            return false;
+        }
+        base = (const uint8_t*)ptr;
+        entryCount = ((const assetHeader*)base)->count;
+        entries = (const assetEntry*)(base + sizeof(assetHeader));
+        return true;
+    }
+
+    /** @brief Unmap, pointers handed out before become invalid */
+    void end() {
+        if (base) spi_flash_munmap(handle);
+        base = nullptr;
+        entries = nullptr;
+        entryCount = 0;
+    }
+
+    bool ready() const { return base != nullptr; }
+    uint16_t count() const { return entryCount; }
+
+    /** @brief Binary search in the table, nullptr if missing */
+    const assetEntry* find(const char* name) const {
+        int32_t lo = 0;
+        int32_t hi = (int32_t)entryCount - 1;
+        while (lo <= hi) {
+            int32_t mid = (lo + hi) / 2;
+            int cmp = strncmp(name, entries[mid].name, ASSET_NAME_LEN);
+            if (cmp == 0) return &entries[mid];
+            if (cmp < 0) hi = mid - 1;
+            else lo = mid + 1;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Look up an image
+     * @param img Points into the partition on success
+     */
+    bool image(const char* name, omegaPackedImage& img) const {
+        const assetEntry* e = find(name);
+        if (!e || e->type != ASSET_IMAGE) return false;
+        img.width = e->width;
+        img.height = e->height;
+        img.colors = e->colors;
+        img.bits = e->bits;
+        img.transparent = e->transparent;
+        img.flags = e->flags;
+        img.palette = (const uint16_t*)(base + e->offset);
+        img.data = base + e->offset + e->colors * 2;
+        return true;
+    }
+
+    /** @brief VLW font for loadFont(), nullptr if missing */
+    const uint8_t* font(const char* name) const {
+        const assetEntry* e = find(name);
+        return e && e->type == ASSET_FONT ? base + e->offset : nullptr;
+    }
+};
+
+#endif // OMEGAASSETS_H
@@ -0,0 +1,216 @@
+/**
+ * @file omegaAvatar.h
+ * @brief Composes the plant avatar from its unlocked items
+ *
+ * A catalog lists the avatars (bodies), backgrounds and accessories with
+ * the Unlockables bit that makes them available. Every body has an anchor
+ * point per slot, e.g. where its face is, and every accessory an anchor in
+ * its own image, e.g. the bridge of the glasses. An accessory is drawn with
+ * its anchor on the body's anchor of its slot.
+ *
+ * update() draws background, body and accessories into a cached sprite, but
+ * only when the unlocked items or the equipped outfit changed. Frames push
+ * the cached sprite instead of decoding every layer again.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGAAVATAR_H
+#define OMEGAAVATAR_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <omegaImage.h>
+#include <omegaPlant.h>
+
+#define AVATAR_NONE 0xFF // Slot left empty
+#define AVATAR_AUTO 0xFE // Last unlocked catalog entry with artwork that fits
+
+enum avatarSlot : uint8_t {
+    SLOT_HEAD,  // Crown, hat
+    SLOT_FACE,  // Glasses
+    SLOT_CHIN,  // Beard
+    SLOT_NECK,  // Ties
+    SLOT_HAND,  // Balloon
+    AVATAR_SLOTS
+};
+
+/**
+ * @struct avatarPoint
+ * @brief Offset in an image
+ */
+struct avatarPoint {
+    int16_t x;
+    int16_t y;
+};
+
+/**
+ * @struct avatarBody
+ * @brief Avatar with the anchor points of its slots
+ */
+struct avatarBody {
+    uint16_t unlock; // Unlockables bit, 0 = always available
+    const omegaPackedImage* image;
+    avatarPoint anchors[AVATAR_SLOTS];
+};
+
+/**
+ * @struct avatarItem
+ * @brief Accessory, anchor is the point placed on the body's slot anchor
+ */
+struct avatarItem {
+    uint16_t unlock;
+    uint8_t slot;                  // avatarSlot
+    const omegaPackedImage* image; // nullptr while there is no artwork
+    avatarPoint anchor;
+};
+
+/**
+ * @struct avatarBackground
+ * @brief Image, or a plain colour without one
+ */
+struct avatarBackground {
+    uint16_t unlock;
+    const omegaPackedImage* image;
+    uint16_t color;
+};
+
+/**
+ * @struct avatarCatalog
+ * @brief Everything an avatar can be composed of
+ */
+struct avatarCatalog {
+    const avatarBody* bodies;
+    uint8_t bodyCount;
+    const avatarBackground* backgrounds;
+    uint8_t backgroundCount;
+    const avatarItem* items;
+    uint8_t itemCount;
+};
+
+/**
+ * @struct avatarOutfit
+ * @brief Catalog indices, AVATAR_NONE or AVATAR_AUTO
+ */
+struct avatarOutfit {
+    uint8_t body = AVATAR_AUTO;
+    uint8_t background = AVATAR_AUTO;
+    uint8_t items[AVATAR_SLOTS] = {AVATAR_AUTO, AVATAR_AUTO, AVATAR_AUTO, AVATAR_AUTO, AVATAR_AUTO};
+
+    bool operator==(const avatarOutfit& o) const {
+        return body == o.body && background == o.background && !memcmp(items, o.items, sizeof(items));
+    }
+    bool operator!=(const avatarOutfit& o) const { return !(*this == o); }
+};
+
+/**
+ * @class omegaAvatarCompositor
+ * @brief Caches the composed avatar in a sprite
+ */
+class omegaAvatarCompositor {
+private:
+    TFT_eSprite sprite;
+    const avatarCatalog& catalog;
+    avatarOutfit composed;
+    bool valid = false;
+
+    static bool available(uint16_t unlock, uint16_t unlocked) { return unlock == 0 || (unlocked & unlock); }
+
+    // Last unlocked entry for AVATAR_AUTO, the wanted one if it is unlocked
+    template <typename T>
+    static uint8_t pick(const T* entries, uint8_t count, uint8_t wanted, uint16_t unlocked, int8_t slot = -1) {
+        if (wanted == AVATAR_NONE) return AVATAR_NONE;
+        if (wanted != AVATAR_AUTO) {
+            return wanted < count && available(entries[wanted].unlock, unlocked) ? wanted : AVATAR_NONE;
+        }
+        uint8_t found = AVATAR_NONE;
+        for (uint8_t i = 0; i < count; i++) {
+            if (available(entries[i].unlock, unlocked) && matches(entries[i], slot)) found = i;
+        }
+        return found;
+    }
+
+    static bool matches(const avatarItem& item, int8_t slot) { return item.slot == slot && item.image; }
+    static bool matches(const avatarBody& body, int8_t) { return body.image; }
+    static bool matches(const avatarBackground&, int8_t) { return true; }
+
+    void compose() {
+        sprite.fillSprite(TFT_BLACK);
+
+        if (composed.background != AVATAR_NONE) {
+            const avatarBackground& bg = catalog.backgrounds[composed.background];
+            if (bg.image) pushPackedImage(&sprite, 0, 0, *bg.image);
+            else sprite.fillSprite(bg.color);
+        }
+        if (composed.body == AVATAR_NONE) return;
+
+        const avatarBody& body = catalog.bodies[composed.body];
+        if (body.image) pushPackedImage(&sprite, 0, 0, *body.image);
+
+        for (uint8_t slot = 0; slot < AVATAR_SLOTS; slot++) {
+            if (composed.items[slot] == AVATAR_NONE) continue;
+            const avatarItem& item = catalog.items[composed.items[slot]];
+            if (!item.image) continue;
+            pushPackedImage(&sprite, body.anchors[slot].x - item.anchor.x, body.anchors[slot].y - item.anchor.y,
+                            *item.image);
+        }
+    }
+
+public:
+    omegaAvatarCompositor(TFT_eSPI* tft, const avatarCatalog& avatarCatalog) : sprite(tft), catalog(avatarCatalog) {}
+
+    /** @brief Allocate the cache, 2 bytes per pixel */
+    bool begin(int16_t width, int16_t height) {
+        valid = false;
+        return sprite.createSprite(width, height) != nullptr;
+    }
+
+    /**
+     * @brief Resolve the outfit against the unlocked items
+     * Equipped entries that are not unlocked are left out, AVATAR_AUTO
+     * takes the last unlocked entry of the catalog that fits and has
+     * artwork.
+     */
+    avatarOutfit dress(uint16_t unlocked, const avatarOutfit& equipped) const {
+        avatarOutfit o;
+        o.body = pick(catalog.bodies, catalog.bodyCount, equipped.body, unlocked);
+        o.background = pick(catalog.backgrounds, catalog.backgroundCount, equipped.background, unlocked);
+        for (uint8_t slot = 0; slot < AVATAR_SLOTS; slot++) {
+            uint8_t i = pick(catalog.items, catalog.itemCount, equipped.items[slot], unlocked, slot);
+            o.items[slot] = i != AVATAR_NONE && catalog.items[i].slot == slot ? i : AVATAR_NONE;
+        }
+        return o;
+    }
+
+    /**
+     * @brief Compose again if the outfit changed
+     * @return True if the cached sprite changed
+     */
+    bool update(uint16_t unlocked, const avatarOutfit& equipped) {
+        avatarOutfit o = dress(unlocked, equipped);
+        if (valid && o == composed) return false;
+        composed = o;
+        valid = true;
+        compose();
+        sprite.createOpaqueMask(TFT_BLACK); // push() copies the opaque runs only
+        return true;
+    }
+
+    /** @brief Force the next update() to compose, e.g. after the artwork was reloaded */
+    void invalidate() { valid = false; }
+
+    /** @brief Blit the cached avatar, black is transparent */
+    void push(TFT_eSprite* target, int32_t x, int32_t y) {
+        if (valid) sprite.pushToSprite(target, x, y, TFT_BLACK);
+    }
+
+    const avatarOutfit& outfit() const { return composed; }
+    int16_t width() { return sprite.width(); }
+    int16_t height() { return sprite.height(); }
+};
+
+#endif // OMEGAAVATAR_H
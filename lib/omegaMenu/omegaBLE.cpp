@@ -0,0 +1,128 @@
+#include "omegaBLE.h"
+
+/*######################### bleBeaconData ################################*/
+
+uint8_t bleBeaconData::encode(uint8_t* adv, uint8_t size) const {
+    const uint8_t len = 3 + 2 + BLE_BEACON_DATA_SIZE;
+    if (size < len) return 0;
+
+    adv[0] = 2;
+    adv[1] = BLE_AD_FLAGS;
+    adv[2] = 0x06; // General discoverable, no BR/EDR
+
+    uint8_t* p = adv + 3;
+    p[0] = 1 + BLE_BEACON_DATA_SIZE;
+    p[1] = BLE_AD_MANUFACTURER;
+    p[2] = BLE_COMPANY_ID & 0xFF;
+    p[3] = BLE_COMPANY_ID >> 8;
+    p[4] = BLE_BEACON_VERSION;
+    p[5] = seq;
+    plantStateSchema::toBinary(p + 6, plantStateSchema::binarySize, state);
+    return len;
+}
+
+bool bleBeaconData::decode(const uint8_t* adv, uint8_t len) {
+    // Walk the AD structures, the beacon need not be the first one
+    uint8_t i = 0;
+    while (i + 1 < len) {
+        uint8_t adLen = adv[i];
+        if (adLen == 0 || i + 1 + adLen > len) return false;
+
+        const uint8_t* d = adv + i + 2;
+        if (adv[i + 1] == BLE_AD_MANUFACTURER && adLen > BLE_BEACON_DATA_SIZE &&
+            (d[0] | (d[1] << 8)) == BLE_COMPANY_ID && d[2] == BLE_BEACON_VERSION) {
+            seq = d[3];
+            return plantStateSchema::fromBinary(d + 4, adLen - 5, state);
+        }
+        i += 1 + adLen;
+    }
+    return false;
+}
+
+#if defined(CONFIG_BLUEDROID_ENABLED)
+
+/*######################### Stack ########################################*/
+
+static bleGapHandler gapHandlers[BLE_MAX_GAP_HANDLERS];
+static void* gapContexts[BLE_MAX_GAP_HANDLERS];
+static uint8_t gapHandlerCount = 0;
+
+static void gapCallback(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+    for (uint8_t i = 0; i < gapHandlerCount; i++) gapHandlers[i](event, param, gapContexts[i]);
+}
+
+static bool startStack() {
+    if (!btStarted() && !btStart()) return false;
+    if (esp_bluedroid_get_status() == ESP_BLUEDROID_STATUS_UNINITIALIZED && esp_bluedroid_init() != ESP_OK) {
+        return false;
+    }
+    if (esp_bluedroid_get_status() != ESP_BLUEDROID_STATUS_ENABLED && esp_bluedroid_enable() != ESP_OK) {
+        return false;
+    }
+    return esp_ble_gap_register_callback(gapCallback) == ESP_OK;
+}
+
+bool omegaBLEStart(bleGapHandler handler, void* ctx) {
+    static bool started = false;
+    if (!started && !startStack()) return false;
+    started = true;
+
+    for (uint8_t i = 0; i < gapHandlerCount; i++) {
+        if (gapHandlers[i] == handler && gapContexts[i] == ctx) return true;
+    }
+    if (gapHandlerCount >= BLE_MAX_GAP_HANDLERS) return false;
+    gapHandlers[gapHandlerCount] = handler;
+    gapContexts[gapHandlerCount] = ctx;
+    gapHandlerCount++;
+    return true;
+}
+
+/*######################### omegaBLEBeacon ###############################*/
+
+bool omegaBLEBeacon::begin() {
+    enabled = omegaBLEStart(gapEvent, this);
+    return enabled;
+}
+
+bool omegaBLEBeacon::update(const plantState& state) {
+    if (!enabled) return false;
+
+    bleBeaconData beacon;
+    beacon.seq = ++seq;
+    beacon.state = state;
+    advLen = beacon.encode(adv, sizeof(adv));
+
+    // The stack copies the data, advertising starts once it is set
+    return esp_ble_gap_config_adv_data_raw(adv, advLen) == ESP_OK;
+}
+
+void omegaBLEBeacon::stop() {
+    if (!enabled) return;
+    esp_ble_gap_stop_advertising();
+    advertising = false;
+}
+
+void omegaBLEBeacon::gapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param, void* ctx) {
+    omegaBLEBeacon* beacon = static_cast<omegaBLEBeacon*>(ctx);
+    switch (event) {
+    case ESP_GAP_BLE_ADV_DATA_RAW_SET_COMPLETE_EVT:
+        if (!beacon->advertising && param->adv_data_raw_cmpl.status == ESP_BT_STATUS_SUCCESS) {
+            esp_ble_adv_params_t params = {};
+            params.adv_int_min = BLE_ADV_INTERVAL * 8 / 5; // 0.625 ms units
+            params.adv_int_max = params.adv_int_min;
+            params.adv_type = ADV_TYPE_NONCONN_IND;
+            params.own_addr_type = BLE_ADDR_TYPE_PUBLIC;
+            params.channel_map = ADV_CHNL_ALL;
+            params.adv_filter_policy = ADV_FILTER_ALLOW_SCAN_ANY_CON_ANY;
+            esp_ble_gap_start_advertising(&params);
+        }
+        break;
+    case ESP_GAP_BLE_ADV_START_COMPLETE_EVT:
+        beacon->advertising = param->adv_start_cmpl.status == ESP_BT_STATUS_SUCCESS;
+        break;
+    default:
+        break;
+    }
+}
+
+#endif // CONFIG_BLUEDROID_ENABLED
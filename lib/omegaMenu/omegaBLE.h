@@ -1,66 +1,112 @@
-/*
-   Simple BLE5 multi advertising example on esp32 C3/S3
-   only ESP_BLE_GAP_SET_EXT_ADV_PROP_NONCONN_NONSCANNABLE_UNDIRECTED can be used for periodic advertising
-
-   author: chegewara
-*/
-
-#include <BLEDevice.h>
-#include <BLEAdvertising.h>
-
-esp_ble_gap_ext_adv_params_t ext_adv_params_2M = {
-  .type = ESP_BLE_GAP_SET_EXT_ADV_PROP_NONCONN_NONSCANNABLE_UNDIRECTED,
-  .interval_min = 0x40,
-  .interval_max = 0x40,
-  .channel_map = ADV_CHNL_ALL,
-  .own_addr_type = BLE_ADDR_TYPE_RANDOM,
-  .peer_addr_type = BLE_ADDR_TYPE_RANDOM,
-  .peer_addr = {0, 0, 0, 0, 0, 0},
-  .filter_policy = ADV_FILTER_ALLOW_SCAN_ANY_CON_ANY,
-  .tx_power = EXT_ADV_TX_PWR_NO_PREFERENCE,
-  .primary_phy = ESP_BLE_GAP_PHY_1M,
-  .max_skip = 0,
-  .secondary_phy = ESP_BLE_GAP_PHY_2M,
-  .sid = 1,
-  .scan_req_notif = false,
-};
+/**
+ * @file omegaBLE.h
+ * @brief Connection-less BLE beacon transport for plant samples
+ *
+ * A pot puts its latest plantState into the manufacturer specific data of a
+ * non-connectable advertisement and refreshes it on every sample. Displays
+ * pick the beacons up with a passive scan, so no connection, pairing or
+ * WiFi association is needed to report a sample.
+ *
+ * Advertisement layout (little-endian):
+ *  - Flags AD
+ *  - Manufacturer AD: company id, version, sequence, plantStateSchema binary
+ *
+ * bleBeaconData encodes and decodes on any target. The beacon and the scanner
+ * (omegaBLEScanner.h) need the Bluedroid stack and only exist on chips with
+ * BLE, not on the S2.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGABLE_H
+#define OMEGABLE_H
+
+#include <Arduino.h>
+#include <omegaPlant.h>
+#include <omegaSchema.h>
+
+#if defined(CONFIG_BLUEDROID_ENABLED)
+#include <esp_bt.h>
+#include <esp_bt_main.h>
+#include <esp_gap_ble_api.h>
+#endif
+
+/** Settings */
+#define BLE_COMPANY_ID 0xFFFF    // Bluetooth SIG id reserved for testing, no registered id needed
+#define BLE_ADV_INTERVAL 1000    // Milliseconds between advertisements
+/** End Settings */
+
+#define BLE_BEACON_VERSION 1
+#define BLE_ADV_MAX 31           // Legacy advertising payload
+#define BLE_AD_FLAGS 0x01
+#define BLE_AD_MANUFACTURER 0xFF
+#define BLE_BEACON_DATA_SIZE (2 + 1 + 1 + plantStateSchema::binarySize)
+#define BLE_MAX_GAP_HANDLERS 2   // Beacon and scanner
 
-static uint8_t raw_scan_rsp_data_2m[] = {0x02, 0x01, 0x06, 0x02, 0x0a, 0xeb, 0x12, 0x09, 'E', 'S', 'P', '_', 'M',
-                                         'U',  'L',  'T',  'I',  '_',  'A',  'D',  'V',  '_', '2', 'M', 0X0};
+/**
+ * @struct bleBeaconData
+ * @brief Contents of one beacon advertisement
+ */
+struct bleBeaconData {
+    uint8_t seq;      // Incremented with every new sample
+    plantState state; // state.plantID is the device id of the pot
 
-static esp_ble_gap_periodic_adv_params_t periodic_adv_params = {
-  .interval_min = 0x320,  // 1000 ms interval
-  .interval_max = 0x640,
-  .properties = 0,  // Do not include TX power
+    /**
+     * @brief Build the raw advertising data
+     * @param adv Output buffer
+     * @param size Buffer size, BLE_ADV_MAX is enough
+     * @return Advertising data length, 0 if the buffer is too small
+     */
+    uint8_t encode(uint8_t* adv, uint8_t size) const;
+
+    /**
+     * @brief Find and decode the beacon in raw advertising data
+     * @return False if the advertisement is not a beacon of this version
+     */
+    bool decode(const uint8_t* adv, uint8_t len);
 };
 
-static uint8_t periodic_adv_raw_data[] = {0x02, 0x01, 0x06, 0x02, 0x0a, 0xeb, 0x03, 0x03, 0xab, 0xcd, 0x11, 0x09, 'E', 'S',
-                                          'P',  '_',  'P',  'E',  'R',  'I',  'O',  'D',  'I',  'C',  '_',  'A',  'D', 'V'};
+#if defined(CONFIG_BLUEDROID_ENABLED)
+
+typedef void (*bleGapHandler)(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param, void* ctx);
+
+/**
+ * @brief Start the controller and Bluedroid once and add a GAP event handler
+ * Bluedroid takes a single GAP callback, it is shared by the beacon and the scanner.
+ */
+bool omegaBLEStart(bleGapHandler handler, void* ctx);
 
-uint8_t addr_2m[6] = {0xc0, 0xde, 0x52, 0x00, 0x00, 0x02};
+/**
+ * @class omegaBLEBeacon
+ * @brief Advertises the latest sample of a pot
+ */
+class omegaBLEBeacon {
+private:
+    uint8_t adv[BLE_ADV_MAX];
+    uint8_t advLen = 0;
+    uint8_t seq = 0;
+    volatile bool advertising = false;
+    bool enabled = false;
 
-BLEMultiAdvertising advert(1);  // max number of advertisement data
+    static void gapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param, void* ctx);
 
-void setup() {
-  Serial.begin(115200);
-  Serial.println("Multi-Advertising...");
+public:
+    /** @brief Start the BLE stack, advertising starts with the first update() */
+    bool begin();
 
-  BLEDevice::init("");
+    /** @brief Advertise a new sample instead of the previous one */
+    bool update(const plantState& state);
 
-  advert.setAdvertisingParams(0, &ext_adv_params_2M);
-  advert.setAdvertisingData(0, sizeof(raw_scan_rsp_data_2m), &raw_scan_rsp_data_2m[0]);
-  advert.setInstanceAddress(0, addr_2m);
-  advert.setDuration(0, 0, 0);
+    /** @brief Stop advertising until the next update() */
+    void stop();
+
+    bool isAdvertising() const { return advertising; }
+};
 
-  delay(100);
-  advert.start();
-  advert.setPeriodicAdvertisingParams(0, &periodic_adv_params);
-  advert.setPeriodicAdvertisingData(0, sizeof(periodic_adv_raw_data), &periodic_adv_raw_data[0]);
-  advert.startPeriodicAdvertising(0);
-  
-}
+#endif // CONFIG_BLUEDROID_ENABLED
 
-void loop() {
-  delay(2000);
-}
-#endif
\ No newline at end of file
+#endif // OMEGABLE_H
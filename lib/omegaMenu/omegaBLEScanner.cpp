@@ -0,0 +1,153 @@
+#include "omegaBLEScanner.h"
+
+#if defined(CONFIG_BLUEDROID_ENABLED)
+
+omegaBLEScanner::omegaBLEScanner() {
+    memset(sources, 0, sizeof(sources));
+}
+
+void omegaBLEScanner::onBeacon(bleBeaconHandler h, void* ctx) {
+    handler = h;
+    handlerCtx = ctx;
+}
+
+bool omegaBLEScanner::begin() {
+    if (!omegaBLEStart(gapEvent, this)) return false;
+    started = true;
+    return applyParams();
+}
+
+void omegaBLEScanner::stop() {
+    started = false; // Keeps later parameter changes from restarting the scan
+    restart = false;
+    esp_ble_gap_stop_scanning();
+    scanning = false;
+}
+
+bool omegaBLEScanner::setDutyCycle(uint16_t intervalMs, uint16_t windowMs) {
+    if (intervalMs < 3 || intervalMs > 10240 || windowMs < 3 || windowMs > intervalMs) return false;
+    interval = intervalMs;
+    window = windowMs;
+    return applyParams();
+}
+
+bool omegaBLEScanner::setMode(bleScanMode mode) {
+    switch (mode) {
+    case BLE_SCAN_LOW_LATENCY: return setDutyCycle(BLE_SCAN_INTERVAL, BLE_SCAN_INTERVAL);
+    case BLE_SCAN_BALANCED: return setDutyCycle(BLE_SCAN_INTERVAL, BLE_SCAN_WINDOW);
+    case BLE_SCAN_LOW_POWER: return setDutyCycle(BLE_SCAN_INTERVAL * 10, BLE_SCAN_INTERVAL);
+    }
+    return false;
+}
+
+bool omegaBLEScanner::setWhitelistOnly(bool on) {
+    whitelistOnly = on;
+    return applyParams();
+}
+
+bool omegaBLEScanner::applyParams() {
+    if (!started) return true; // Applied by begin()
+
+    // The controller only takes new parameters while it is not scanning
+    if (scanning) {
+        restart = true;
+        return esp_ble_gap_stop_scanning() == ESP_OK;
+    }
+
+    esp_ble_scan_params_t params = {};
+    params.scan_type = BLE_SCAN_TYPE_PASSIVE; // Beacons have no scan response
+    params.own_addr_type = BLE_ADDR_TYPE_PUBLIC;
+    params.scan_filter_policy = whitelistOnly && whitelistCount ? BLE_SCAN_FILTER_ALLOW_ONLY_WLST : BLE_SCAN_FILTER_ALLOW_ALL;
+    params.scan_interval = interval * 8 / 5; // 0.625 ms units
+    params.scan_window = window * 8 / 5;
+    // The controller's duplicate filter is keyed on the address only in the
+    // Arduino sdkconfig and would hide new samples, duplicates are dropped here
+    params.scan_duplicate = BLE_SCAN_DUPLICATE_DISABLE;
+    return esp_ble_gap_set_scan_params(&params) == ESP_OK;
+}
+
+void omegaBLEScanner::gapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param, void* ctx) {
+    omegaBLEScanner* scanner = static_cast<omegaBLEScanner*>(ctx);
+    switch (event) {
+    case ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT:
+        if (param->scan_param_cmpl.status == ESP_BT_STATUS_SUCCESS) esp_ble_gap_start_scanning(0);
+        break;
+    case ESP_GAP_BLE_SCAN_START_COMPLETE_EVT:
+        scanner->scanning = param->scan_start_cmpl.status == ESP_BT_STATUS_SUCCESS;
+        break;
+    case ESP_GAP_BLE_SCAN_STOP_COMPLETE_EVT:
+        scanner->scanning = false;
+        if (scanner->restart) {
+            scanner->restart = false;
+            scanner->applyParams();
+        }
+        break;
+    case ESP_GAP_BLE_SCAN_RESULT_EVT:
+        if (param->scan_rst.search_evt == ESP_GAP_SEARCH_INQ_RES_EVT) scanner->result(param);
+        break;
+    default:
+        break;
+    }
+}
+
+void omegaBLEScanner::result(const esp_ble_gap_cb_param_t* param) {
+    stats.adverts++;
+
+    bleBeaconData beacon;
+    uint8_t len = param->scan_rst.adv_data_len + param->scan_rst.scan_rsp_len;
+    if (!beacon.decode(param->scan_rst.ble_adv, len)) {
+        stats.foreign++;
+        return;
+    }
+
+    const uint8_t* mac = param->scan_rst.bda;
+    if (isDuplicate(mac, beacon.seq)) {
+        stats.duplicates++;
+        return;
+    }
+
+    stats.beacons++;
+    if (handler) handler(mac, param->scan_rst.rssi, beacon, handlerCtx);
+}
+
+bool omegaBLEScanner::isDuplicate(const uint8_t* mac, uint8_t seq) {
+    uint32_t now = millis();
+    beaconSource* source = nullptr;
+    beaconSource* oldest = &sources[0];
+    for (uint8_t i = 0; i < BLE_MAX_BEACONS; i++) {
+        beaconSource& s = sources[i];
+        if (s.used && memcmp(s.mac, mac, 6) == 0) { source = &s; break; }
+        if (!s.used) oldest = &s;
+        else if (oldest->used && now - s.lastSeen > now - oldest->lastSeen) oldest = &s;
+    }
+
+    if (source) {
+        source->lastSeen = now;
+        if (source->seq == seq) return true;
+        source->seq = seq;
+        return false;
+    }
+
+    // New pot, replace a free slot or the one silent the longest
+    source = oldest;
+    if (source->used && source->whitelisted &&
+        esp_ble_gap_update_whitelist(false, source->mac, BLE_WL_ADDR_TYPE_PUBLIC) == ESP_OK) {
+        whitelistCount--;
+    }
+    memcpy(source->mac, mac, 6);
+    source->seq = seq;
+    source->lastSeen = now;
+    source->used = true;
+    source->whitelisted = false;
+
+    if (whitelistCount < BLE_WHITELIST_SIZE &&
+        esp_ble_gap_update_whitelist(true, source->mac, BLE_WL_ADDR_TYPE_PUBLIC) == ESP_OK) {
+        source->whitelisted = true;
+        whitelistCount++;
+        // The first entry makes the whitelist filter usable
+        if (whitelistOnly && whitelistCount == 1) applyParams();
+    }
+    return false;
+}
+
+#endif // CONFIG_BLUEDROID_ENABLED
@@ -0,0 +1,125 @@
+/**
+ * @file omegaBLEScanner.h
+ * @brief Passive, connection-less scanner for pot beacons
+ *
+ * Counterpart to omegaBLEBeacon for displays that listen to many pots.
+ * The ESP32 controller cannot match on manufacturer data, so adverts are
+ * filtered on the host: anything without the beacon's company id and
+ * version is dropped before the state is decoded, and a beacon repeated
+ * with the same (MAC, seq) is dropped before it reaches the handler.
+ * Once the pots are known, the controller's whitelist can drop all other
+ * advertisers before they wake the host at all.
+ *
+ * The scan duty cycle trades latency against power: a pot advertising every
+ * BLE_ADV_INTERVAL is heard within about BLE_ADV_INTERVAL * interval / window.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGABLESCANNER_H
+#define OMEGABLESCANNER_H
+
+#include <Arduino.h>
+#include <omegaBLE.h>
+
+#if defined(CONFIG_BLUEDROID_ENABLED)
+
+/** Settings */
+#define BLE_SCAN_INTERVAL 100  // Milliseconds between scan windows
+#define BLE_SCAN_WINDOW 50     // Milliseconds listening per interval
+#define BLE_MAX_BEACONS 32     // Pots tracked for duplicate detection
+#define BLE_WHITELIST_SIZE 12  // Pots put into the controller whitelist
+/** End Settings */
+
+/**
+ * @enum bleScanMode
+ * @brief Duty cycle presets
+ */
+enum bleScanMode : uint8_t {
+    BLE_SCAN_LOW_LATENCY, // Listen all the time
+    BLE_SCAN_BALANCED,    // BLE_SCAN_WINDOW of every BLE_SCAN_INTERVAL
+    BLE_SCAN_LOW_POWER,   // 10 %, a sample may take several adverts to arrive
+};
+
+/**
+ * @struct bleScanStats
+ * @brief Scanner counters
+ */
+struct bleScanStats {
+    uint32_t adverts = 0;    // Scan results from the controller
+    uint32_t foreign = 0;    // Adverts that are no pot beacon
+    uint32_t duplicates = 0; // Beacons already delivered
+    uint32_t beacons = 0;    // Beacons delivered to the handler
+};
+
+typedef void (*bleBeaconHandler)(const uint8_t* mac, int8_t rssi, const bleBeaconData& beacon, void* ctx);
+
+/**
+ * @class omegaBLEScanner
+ * @brief Scans for pot beacons and hands each new sample to a handler once
+ *
+ * The handler and the duplicate table run in the Bluetooth task.
+ */
+class omegaBLEScanner {
+private:
+    struct beaconSource {
+        uint8_t mac[6];
+        uint8_t seq;
+        bool used;
+        bool whitelisted;
+        uint32_t lastSeen;
+    };
+
+    beaconSource sources[BLE_MAX_BEACONS];
+    bleBeaconHandler handler = nullptr;
+    void* handlerCtx = nullptr;
+    uint16_t interval = BLE_SCAN_INTERVAL;
+    uint16_t window = BLE_SCAN_WINDOW;
+    uint8_t whitelistCount = 0;
+    bool whitelistOnly = false;
+    bool started = false;
+    volatile bool scanning = false;
+    volatile bool restart = false; // New parameters wait for the scan to stop
+
+    static void gapEvent(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param, void* ctx);
+    void result(const esp_ble_gap_cb_param_t* param);
+    bool isDuplicate(const uint8_t* mac, uint8_t seq);
+    bool applyParams();
+
+public:
+    bleScanStats stats;
+
+    omegaBLEScanner();
+
+    /** @brief Handler for every new beacon sample */
+    void onBeacon(bleBeaconHandler h, void* ctx = nullptr);
+
+    /** @brief Start the BLE stack and scan until stop() */
+    bool begin();
+
+    void stop();
+    bool isScanning() const { return scanning; }
+
+    /**
+     * @brief Change the duty cycle, a running scan restarts with it
+     * @param intervalMs Time between the starts of two scan windows, 3 to 10240
+     * @param windowMs Listening time per interval, at most intervalMs
+     */
+    bool setDutyCycle(uint16_t intervalMs, uint16_t windowMs);
+    bool setMode(bleScanMode mode);
+
+    /**
+     * @brief Let the controller drop adverts of unknown devices
+     * Pots are whitelisted when their first beacon arrives. New pots are only
+     * found while this is off.
+     */
+    bool setWhitelistOnly(bool on);
+};
+
+#endif // CONFIG_BLUEDROID_ENABLED
+
+#endif // OMEGABLESCANNER_H
@@ -0,0 +1,72 @@
+#include "omegaDelta.h"
+
+using namespace omegaSchema;
+
+omegaDelta::omegaDelta(const PlantProfile& profile, uint8_t interval)
+    : keyframeInterval(interval), sinceKeyframe(0) {
+    setProfile(profile);
+}
+
+void omegaDelta::setProfile(const PlantProfile& profile) {
+    deadband[0] = deadbandFromRange(profile.range_light);
+    deadband[1] = deadbandFromRange(profile.range_temp);
+    deadband[2] = deadbandFromRange(profile.range_hum);
+    deadband[3] = deadbandFromRange(profile.range_soil_moisture);
+}
+
+uint8_t omegaDelta::deadbandFromRange(uint8_t range) {
+    uint8_t band = range / DELTA_DEADBAND_DIVIDER;
+    return band > 0 ? band : 1;
+}
+
+bool omegaDelta::exceeds(uint8_t newValue, uint8_t oldValue, uint8_t band) {
+    uint8_t diff = newValue > oldValue ? newValue - oldValue : oldValue - newValue;
+    return diff >= band;
+}
+
+uint32_t omegaDelta::update(const plantState& state) {
+    uint32_t mask = 0;
+
+    // Keyframe: first message, id change or interval elapsed
+    if (!hasKeyframe || state.plantID != lastSent.plantID || ++sinceKeyframe >= keyframeInterval) {
+        lastSent = state;
+        hasKeyframe = true;
+        sinceKeyframe = 0;
+        return plantStateSchema::allFields;
+    }
+
+    // Sensor channels only count once they leave the deadband around the last sent value
+    if (exceeds(state.curData.lightIntensity, lastSent.curData.lightIntensity, deadband[0])) {
+        mask |= plantStateSchema::bit<psLight>::value;
+        lastSent.curData.lightIntensity = state.curData.lightIntensity;
+    }
+    if (exceeds(state.curData.temperature, lastSent.curData.temperature, deadband[1])) {
+        mask |= plantStateSchema::bit<psTemp>::value;
+        lastSent.curData.temperature = state.curData.temperature;
+    }
+    if (exceeds(state.curData.humidity, lastSent.curData.humidity, deadband[2])) {
+        mask |= plantStateSchema::bit<psHum>::value;
+        lastSent.curData.humidity = state.curData.humidity;
+    }
+    if (exceeds(state.curData.moisture, lastSent.curData.moisture, deadband[3])) {
+        mask |= plantStateSchema::bit<psSoil>::value;
+        lastSent.curData.moisture = state.curData.moisture;
+    }
+
+    // Derived values are sent on every change
+    if (state.curMood != lastSent.curMood) {
+        mask |= plantStateSchema::bit<psMood>::value;
+        lastSent.curMood = state.curMood;
+    }
+    if (state.curXP != lastSent.curXP) {
+        mask |= plantStateSchema::bit<psXP>::value;
+        lastSent.curXP = state.curXP;
+    }
+    if (state.curEmotion != lastSent.curEmotion) {
+        mask |= plantStateSchema::bit<psRcmnd>::value;
+        lastSent.curEmotion = state.curEmotion;
+    }
+
+    if (mask) mask |= plantStateSchema::bit<psID>::value;
+    return mask;
+}
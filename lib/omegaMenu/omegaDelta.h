@@ -0,0 +1,73 @@
+/**
+ * @file omegaDelta.h
+ * @brief Change detection for plant telemetry
+ *
+ * Sits between reading the sensors and publishing. Only channels that moved
+ * further than their deadband since the last published value are reported,
+ * with a full keyframe forced every few intervals so late subscribers and
+ * lost messages recover.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGADELTA_H
+#define OMEGADELTA_H
+
+#include <Arduino.h>
+#include <omegaPlant.h>
+#include <omegaSchema.h>
+
+/** Settings */
+#define DELTA_KEYFRAME_INTERVAL 12 // Publish intervals between full messages
+#define DELTA_DEADBAND_DIVIDER 10  // Deadband = profile range / divider
+/** End Settings */
+
+/**
+ * @class omegaDelta
+ * @brief Tracks the last published plantState and reports changed fields
+ */
+class omegaDelta {
+private:
+    plantState lastSent;
+    uint8_t deadband[4]; // Light, temperature, humidity, soil moisture
+    uint8_t keyframeInterval;
+    uint8_t sinceKeyframe;
+    bool hasKeyframe = false;
+
+    static uint8_t deadbandFromRange(uint8_t range);
+    static bool exceeds(uint8_t newValue, uint8_t oldValue, uint8_t band);
+
+public:
+    /**
+     * @brief Constructor
+     * @param profile Profile the channel deadbands are derived from
+     * @param interval Publish intervals between forced keyframes
+     */
+    omegaDelta(const PlantProfile& profile, uint8_t interval = DELTA_KEYFRAME_INTERVAL);
+
+    /**
+     * @brief Recalculate the deadbands after a profile change
+     * @param profile New plant profile
+     */
+    void setProfile(const PlantProfile& profile);
+
+    /**
+     * @brief Compare a new state against the last published one
+     *
+     * The returned mask selects the plantStateSchema fields to publish and
+     * always contains the id. The state is remembered as published.
+     *
+     * @param state New plant state
+     * @return Field mask, 0 if nothing needs to be sent
+     */
+    uint32_t update(const plantState& state);
+
+    /** Force the next update to be a keyframe */
+    void forceKeyframe() { hasKeyframe = false; }
+};
+
+#endif // OMEGADELTA_H
@@ -0,0 +1,85 @@
+/**
+ * @file omegaFrameQueue.h
+ * @brief Lock-free single producer, single consumer frame pool
+ *
+ * Hands received frames from a driver callback to a worker task. All slots
+ * are allocated up front, the producer fills a slot in place and publishes
+ * it with one atomic store, so the callback never blocks, allocates or
+ * waits for the consumer. When the consumer falls behind, new frames are
+ * dropped and counted.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGAFRAMEQUEUE_H
+#define OMEGAFRAMEQUEUE_H
+
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * @class omegaFrameQueue
+ * @brief Ring of N preallocated T, N must be a power of two
+ */
+template <typename T, uint8_t N>
+class omegaFrameQueue {
+    static_assert(N && (N & (N - 1)) == 0, "Queue length must be a power of two");
+
+private:
+    T slots[N];
+    std::atomic<uint32_t> head; // Next slot to fill, only the producer writes
+    std::atomic<uint32_t> tail; // Next slot to read, only the consumer writes
+
+public:
+    uint32_t pushed = 0;    // Frames published by the producer
+    uint32_t dropped = 0;   // Frames lost because the queue was full
+    uint8_t highWater = 0;  // Most frames waiting at once
+
+    omegaFrameQueue() : head(0), tail(0) {}
+
+    /**
+     * @brief Producer: slot to fill, nullptr if the queue is full
+     * The slot is only visible to the consumer after commit().
+     */
+    T* reserve() {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= N) {
+            dropped++;
+            return nullptr;
+        }
+        return &slots[h % N];
+    }
+
+    /** @brief Producer: publish the slot returned by reserve() */
+    void commit() {
+        uint32_t h = head.load(std::memory_order_relaxed) + 1;
+        head.store(h, std::memory_order_release);
+        pushed++;
+
+        uint32_t waiting = h - tail.load(std::memory_order_relaxed);
+        if (waiting > highWater) highWater = waiting;
+    }
+
+    /** @brief Consumer: oldest frame, nullptr if the queue is empty */
+    T* front() { return peek(0); }
+
+    /** @brief Consumer: frame behind the oldest one by index, nullptr if there is none */
+    T* peek(uint8_t index) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) - t <= index) return nullptr;
+        return &slots[(t + index) % N];
+    }
+
+    /** @brief Consumer: release the frame returned by front(), or the count oldest frames */
+    void pop(uint8_t count = 1) { tail.store(tail.load(std::memory_order_relaxed) + count, std::memory_order_release); }
+
+    uint8_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+};
+
+#endif // OMEGAFRAMEQUEUE_H
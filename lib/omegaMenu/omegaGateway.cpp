@@ -0,0 +1,141 @@
+#include "omegaGateway.h"
+
+bool omegaMqttGateway::begin(const char* batchTopic) {
+    topic = batchTopic;
+    if (!producers) producers = xSemaphoreCreateMutex();
+    return producers != nullptr;
+}
+
+bool omegaMqttGateway::push(const plantState& state, uint16_t ageSec) {
+    if (!producers || xSemaphoreTake(producers, portMAX_DELAY) != pdTRUE) return false;
+    gatewaySample* sample = queue.reserve();
+    if (sample) {
+        sample->state = state;
+        sample->ageSec = ageSec;
+        sample->receivedAt = millis();
+        queue.commit();
+        stats.received++;
+    } else {
+        stats.dropped++;
+    }
+    xSemaphoreGive(producers);
+    return sample != nullptr;
+}
+
+bool omegaMqttGateway::pushRecord(uint16_t id, bool profile, const uint8_t* data, size_t len) {
+    if (!producers || xSemaphoreTake(producers, portMAX_DELAY) != pdTRUE) return false;
+    gatewayRecord* record = records.reserve();
+    if (record) {
+        record->id = id;
+        record->profile = profile;
+        memcpy(record->data, data, len);
+        records.commit();
+        stats.received++;
+    } else {
+        stats.dropped++;
+    }
+    xSemaphoreGive(producers);
+    return record != nullptr;
+}
+
+bool omegaMqttGateway::pushState(uint16_t id, const PlantSaveData& save) {
+    uint8_t data[PlantSaveDataSchema::binarySize];
+    PlantSaveDataSchema::toBinary(data, sizeof(data), save);
+    return pushRecord(id, false, data, sizeof(data));
+}
+
+bool omegaMqttGateway::pushProfile(uint16_t id, const PlantProfile& profile) {
+    uint8_t data[PlantProfileSchema::binarySize];
+    PlantProfileSchema::toBinary(data, sizeof(data), profile);
+    return pushRecord(id, true, data, sizeof(data));
+}
+
+uint8_t omegaMqttGateway::encode(size_t& len) {
+    uint32_t now = millis();
+    doc.clear();
+    JsonArray samples = doc.createNestedArray("samples");
+
+    uint8_t count = 0;
+    while (count < GATEWAY_BATCH_MAX) {
+        const gatewaySample* sample = queue.peek(count);
+        if (!sample) break;
+
+        JsonObject obj = samples.createNestedObject();
+        plantStateSchema::toJson(obj, sample->state);
+        uint32_t age = sample->ageSec + (now - sample->receivedAt) / 1000;
+        obj["age"] = age > 0xFFFF ? 0xFFFF : age;
+
+        // Keep the batch within the payload buffer, the rest goes next time
+        if (doc.overflowed() || measureJson(doc) >= sizeof(payload)) {
+            samples.remove(count);
+            break;
+        }
+        count++;
+    }
+
+    len = count ? serializeJson(doc, payload, sizeof(payload)) : 0;
+    return count;
+}
+
+bool omegaMqttGateway::flush() {
+    if (!flushRecords()) return false;
+    while (queue.size()) {
+        if (!topic || !client.connected()) return false;
+
+        size_t len;
+        uint8_t count = encode(len);
+        if (count == 0) return false;
+
+        if (!publish(topic, len)) return false;
+        queue.pop(count);
+        stats.messages++;
+        stats.published += count;
+    }
+    return true;
+}
+
+bool omegaMqttGateway::publish(const char* to, size_t len) {
+    // Streamed past the client's buffer in one write
+    if (!client.beginPublish(to, len, false) || client.write((const uint8_t*)payload, len) != len ||
+        !client.endPublish()) {
+        stats.failed++;
+        return false;
+    }
+    return true;
+}
+
+bool omegaMqttGateway::flushRecords() {
+    char recordTopic[TOPIC_PLANT_LEN];
+    while (const gatewayRecord* record = records.front()) {
+        if (!client.connected()) return false;
+
+        doc.clear();
+        JsonObject obj = doc.to<JsonObject>();
+        if (record->profile) {
+            PlantProfile profile;
+            PlantProfileSchema::fromBinary(record->data, sizeof(record->data), profile);
+            PlantProfileSchema::toJson(obj, profile);
+        } else {
+            PlantSaveData save;
+            PlantSaveDataSchema::fromBinary(record->data, sizeof(record->data), save);
+            PlantSaveDataSchema::toJson(obj, save);
+        }
+        size_t len = serializeJson(doc, payload, sizeof(payload));
+        snprintf(recordTopic, sizeof(recordTopic), TOPIC_PLANT_FORMAT, record->id,
+                 record->profile ? "profile" : "state");
+
+        if (!publish(recordTopic, len)) return false;
+        records.pop();
+        stats.records++;
+    }
+    return true;
+}
+
+void omegaMqttGateway::loop() {
+    // Level ups and profile changes are rare, they go out right away
+    if (records.size()) flushRecords();
+
+    const gatewaySample* oldest = queue.front();
+    if (!oldest) return;
+    if (queue.size() >= GATEWAY_BATCH_MAX || millis() - oldest->receivedAt >= GATEWAY_FLUSH_INTERVAL) flush();
+}
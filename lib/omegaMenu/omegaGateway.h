@@ -0,0 +1,148 @@
+/**
+ * @file omegaGateway.h
+ * @brief Republishes samples received from pots over one MQTT connection
+ *
+ * A display that hears pots over ESP-NOW or BLE already has their samples,
+ * so the pots do not need their own broker connection. The gateway queues
+ * the samples and publishes them in batches on a single topic: one TCP
+ * connection and keepalive for all pots, and one PUBLISH for up to
+ * GATEWAY_BATCH_MAX samples instead of one per sample.
+ *
+ * Batch payload:
+ *  {"samples":[{"id":20618,"tempc":23,...,"age":4}, ...]}
+ * Each sample is the plantStateSchema JSON plus its age in seconds.
+ * Every display subscribes to plantpal/+/batch, so the pots one display
+ * hears show up on the others too.
+ *
+ * States and profiles are rare, they are queued separately and published
+ * one by one on their pot's own topic, plantpal/<id>/state or
+ * plantpal/<id>/profile, as the full JSON of their schema. That is the same
+ * message a pot with its own broker connection publishes.
+ *
+ * Samples are pushed from the radio tasks and published from the task that
+ * owns the PubSubClient.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGAGATEWAY_H
+#define OMEGAGATEWAY_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <PubSubClient.h>
+#include <ArduinoJson.h>
+#include <omegaPlant.h>
+#include <omegaSchema.h>
+#include <omegaFrameQueue.h>
+#include <omegaTopicRouter.h>
+
+/** Settings */
+#define GATEWAY_QUEUE_LEN 32          // Samples waiting for the broker, power of two
+#define GATEWAY_BATCH_MAX 12          // Samples per MQTT message
+#define GATEWAY_FLUSH_INTERVAL 2000   // Milliseconds a sample waits for others to join it
+#define GATEWAY_PAYLOAD_SIZE 1536     // JSON of a full batch
+#define GATEWAY_JSON_SIZE 2560
+#define GATEWAY_RECORD_QUEUE_LEN 8    // States and profiles waiting for the broker, power of two
+/** End Settings */
+
+#define GATEWAY_RECORD_SIZE (PlantSaveDataSchema::binarySize > PlantProfileSchema::binarySize \
+                             ? PlantSaveDataSchema::binarySize : PlantProfileSchema::binarySize)
+
+/**
+ * @struct gatewaySample
+ * @brief Queued sample
+ */
+struct gatewaySample {
+    plantState state;
+    uint16_t ageSec;     // Age when it was received
+    uint32_t receivedAt;
+};
+
+/**
+ * @struct gatewayRecord
+ * @brief Queued state or profile in its schema's binary form
+ */
+struct gatewayRecord {
+    uint16_t id;
+    bool profile; // PlantProfileSchema, otherwise PlantSaveDataSchema
+    uint8_t data[GATEWAY_RECORD_SIZE];
+};
+
+/**
+ * @struct gatewayStats
+ * @brief Gateway counters
+ */
+struct gatewayStats {
+    uint32_t received = 0;  // Samples, states and profiles pushed
+    uint32_t dropped = 0;   // Pushes lost because their queue was full
+    uint32_t messages = 0;  // Batches published
+    uint32_t published = 0; // Samples in those batches
+    uint32_t failed = 0;    // Batches the client refused, their samples stay queued
+    uint32_t records = 0;   // States and profiles published on their pot's topic
+};
+
+/**
+ * @class omegaMqttGateway
+ * @brief Batches samples into MQTT messages
+ */
+class omegaMqttGateway {
+private:
+    PubSubClient& client;
+    const char* topic = nullptr;
+    omegaFrameQueue<gatewaySample, GATEWAY_QUEUE_LEN> queue;
+    omegaFrameQueue<gatewayRecord, GATEWAY_RECORD_QUEUE_LEN> records;
+    SemaphoreHandle_t producers = nullptr; // The queues take one producer at a time
+    StaticJsonDocument<GATEWAY_JSON_SIZE> doc;
+    char payload[GATEWAY_PAYLOAD_SIZE];
+
+    uint8_t encode(size_t& len);
+    bool pushRecord(uint16_t id, bool profile, const uint8_t* data, size_t len);
+    bool publish(const char* to, size_t len);
+    bool flushRecords();
+
+public:
+    gatewayStats stats;
+
+    explicit omegaMqttGateway(PubSubClient& mqttClient) : client(mqttClient) {}
+
+    /**
+     * @brief Start queueing samples
+     * @param batchTopic Must stay valid, e.g. a global buffer
+     */
+    bool begin(const char* batchTopic);
+
+    /**
+     * @brief Queue a sample, from any task
+     * @param ageSec How old the sample already is, e.g. from a batch frame
+     * @return False if the queue is full
+     */
+    bool push(const plantState& state, uint16_t ageSec = 0);
+
+    /**
+     * @brief Queue a pot's state for plantpal/<id>/state, from any task
+     * @return False if the queue is full
+     */
+    bool pushState(uint16_t id, const PlantSaveData& save);
+
+    /**
+     * @brief Queue a pot's profile for plantpal/<id>/profile, from any task
+     * @return False if the queue is full
+     */
+    bool pushProfile(uint16_t id, const PlantProfile& profile);
+
+    /** @brief Publish queued states and profiles, and a full or old enough batch, call from the client's task */
+    void loop();
+
+    /** @brief Publish everything queued while the client is connected */
+    bool flush();
+
+    uint8_t pending() const { return queue.size() + records.size(); }
+};
+
+#endif // OMEGAGATEWAY_H
@@ -0,0 +1,195 @@
+/**
+ * @file omegaGauge.h
+ * @brief Arc gauge cached in a sprite, updated by the changed sector only
+ *
+ * The gauge draws its track once into a sprite just large enough for the
+ * arc. A new value only redraws the sector between the old and the new
+ * angle, in the value colour when the value grew and in the track colour
+ * when it shrank. Frames push the cached sprite.
+ *
+ * Angles follow TFT_eSPI: 0 is 6 o'clock, clockwise. The value fills from
+ * the start angle, or from the end angle for gauges that grow backwards.
+ * The arc is anti-aliased against the gauge's background colour, so
+ * redrawing a sector gives the same pixels as drawing the gauge anew.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGAGAUGE_H
+#define OMEGAGAUGE_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define GAUGE_AA_MARGIN 2 // Anti-aliased pixels outside the radius
+
+/**
+ * @class omegaArcGauge
+ * @brief One arc, cached with its track
+ */
+class omegaArcGauge {
+private:
+    TFT_eSprite sprite;
+    int16_t originX = 0; // Top left of the sprite on the target
+    int16_t originY = 0;
+    int16_t cx = 0;      // Centre in sprite coordinates
+    int16_t cy = 0;
+    int16_t r = 0;
+    int16_t ir = 0;
+    uint16_t start = 0;
+    uint16_t end = 0;
+    uint16_t track = 0;
+    uint16_t color = 0;
+    uint16_t bg = TFT_BLACK;
+    bool fromEnd = false;
+    int16_t shown = -1; // Value angle in the sprite, -1 before the first render
+    int16_t drawnY0 = 0; // Rows drawn since the opaque mask was recorded
+    int16_t drawnY1 = -1;
+
+    // 0 and 360 share the pixels at 6 o'clock, a track sector can reach the value's fixed end
+    bool closed() const { return start == 0 && end == 360; }
+
+    void sector(uint16_t from, uint16_t to, uint16_t c) {
+        if (from >= to) return;
+        sprite.drawArc(cx, cy, r, ir, from, to, c, bg, true);
+        int16_t x0, y0, x1, y1;
+        extent(from, to, cx, cy, x0, y0, x1, y1);
+        if (drawnY0 > drawnY1) {
+            drawnY0 = y0;
+            drawnY1 = y1;
+        } else {
+            drawnY0 = min(drawnY0, y0);
+            drawnY1 = max(drawnY1, y1);
+        }
+    }
+
+    // Bounding box of the ring between two angles and the extremes in between
+    void extent(uint16_t from, uint16_t to, int16_t x, int16_t y, int16_t& x0, int16_t& y0, int16_t& x1, int16_t& y1) const {
+        x0 = y0 = INT16_MAX;
+        x1 = y1 = INT16_MIN;
+        uint16_t angles[6] = {from, to};
+        uint8_t count = 2;
+        for (uint16_t a = 0; a <= 360; a += 90) {
+            if (a > from && a < to) angles[count++] = a;
+        }
+        for (uint8_t i = 0; i < count; i++) {
+            float s = sinf(angles[i] * DEG_TO_RAD);
+            float c = cosf(angles[i] * DEG_TO_RAD);
+            int16_t radii[2] = {ir, r};
+            for (uint8_t j = 0; j < 2; j++) {
+                int16_t px = x - lroundf(radii[j] * s);
+                int16_t py = y + lroundf(radii[j] * c);
+                x0 = min(x0, px);
+                y0 = min(y0, py);
+                x1 = max(x1, px);
+                y1 = max(y1, py);
+            }
+        }
+        x0 -= GAUGE_AA_MARGIN;
+        y0 -= GAUGE_AA_MARGIN;
+        x1 += GAUGE_AA_MARGIN;
+        y1 += GAUGE_AA_MARGIN;
+    }
+
+public:
+    omegaArcGauge(TFT_eSPI* tft) : sprite(tft) {}
+
+    /**
+     * @brief Size the cache for an arc
+     * @param x, y Centre on the target
+     * @param radius, innerRadius Like drawArc
+     * @param startAngle, endAngle Track, start < end
+     * @param grows Fill from the end angle instead of the start angle
+     */
+    bool begin(int16_t x, int16_t y, int16_t radius, int16_t innerRadius, uint16_t startAngle, uint16_t endAngle,
+               uint16_t trackColor, uint16_t valueColor, bool grows = false, uint16_t bgColor = TFT_BLACK) {
+        r = radius;
+        ir = innerRadius;
+        start = startAngle;
+        end = endAngle;
+        track = trackColor;
+        color = valueColor;
+        fromEnd = grows;
+        bg = bgColor;
+        shown = -1;
+
+        int16_t x0, y0, x1, y1;
+        extent(start, end, x, y, x0, y0, x1, y1);
+        originX = x0;
+        originY = y0;
+        cx = x - x0;
+        cy = y - y0;
+        sprite.deleteSprite();
+        return sprite.createSprite(x1 - x0 + 1, y1 - y0 + 1) != nullptr;
+    }
+
+    /**
+     * @brief Move the value to an angle between start and end
+     * @return True if the cached sprite changed
+     */
+    bool setAngle(uint16_t angle) {
+        angle = constrain(angle, start, end);
+        if (angle == shown) return false;
+
+        if (shown < 0) {
+            sprite.fillSprite(bg);
+            sector(start, end, track);
+            if (fromEnd) sector(angle, end, color);
+            else sector(start, angle, color);
+        } else if (!fromEnd) {
+            if (angle > shown) {
+                sector(shown, angle, color);
+            } else {
+                sector(angle, shown, track);
+                sector(angle > start ? angle - 1 : start, angle, color); // Edge pixels shared with the track
+                if (closed() && angle > start) sector(start, start + 1, color);
+            }
+        } else {
+            if (angle < shown) {
+                sector(angle, shown, color);
+            } else {
+                sector(shown, angle, track);
+                sector(angle, angle < end ? angle + 1 : end, color);
+                if (closed() && angle < end) sector(end - 1, end, color);
+            }
+        }
+        // push() copies the ring's runs only, a new value records the rows of its sectors again
+        if (shown < 0) sprite.createOpaqueMask(bg);
+        else sprite.createOpaqueMask(bg, drawnY0, drawnY1 - drawnY0 + 1);
+        drawnY0 = 0;
+        drawnY1 = -1;
+        shown = angle;
+        return true;
+    }
+
+    /** @brief Value as a fraction of the track, 0 to 255 */
+    bool setValue(uint8_t fraction) {
+        uint16_t span = (end - start) * fraction / 255;
+        return setAngle(fromEnd ? end - span : start + span);
+    }
+
+    void setColor(uint16_t valueColor) {
+        if (color == valueColor) return;
+        color = valueColor;
+        if (shown < 0) return;
+        uint16_t angle = shown;
+        shown = -1; // Draw everything again
+        setAngle(angle);
+    }
+
+    /** @brief Push onto a target whose background is the gauge's background */
+    void push(TFT_eSprite* target) {
+        if (shown >= 0) sprite.pushToSprite(target, originX, originY, bg);
+    }
+
+    int16_t x() const { return originX; }
+    int16_t y() const { return originY; }
+    int16_t width() { return sprite.width(); }
+    int16_t height() { return sprite.height(); }
+};
+
+#endif // OMEGAGAUGE_H
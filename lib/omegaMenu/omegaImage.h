@@ -0,0 +1,126 @@
+/**
+ * @file omegaImage.h
+ * @brief Palette and run-length compressed images for sprites
+ *
+ * Icons and avatars use a handful of colours and are mostly transparent
+ * black, so they are stored as palette indices in runs instead of raw
+ * RGB565. tools/omegaPackIcons.py converts image2cpp arrays into this
+ * format.
+ *
+ * Stream layout, rows back to back, packets never cross a row:
+ *  - Run:     1nnnnnnn index          n + 1 pixels of one palette index
+ *  - Literal: 0nnnnnnn indices...     n + 1 indices packed at bits per pixel,
+ *                                     high nibble first, padded to a byte
+ *
+ * pushPackedImage() decodes straight into a sprite and skips runs of the
+ * transparent index without touching the sprite.
+ *
+ * The converters store palettes byte swapped (PACKED_SWAPPED), the order
+ * 16-bit sprites keep their pixels in, so the direct path copies palette
+ * entries as they are and nothing is swapped per pixel or per blit.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGAIMAGE_H
+#define OMEGAIMAGE_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#define PACKED_RUN 0x80
+#define PACKED_COUNT 0x7F
+#define PACKED_OPAQUE 0xFF // transparent value of images without a transparent colour
+#define PACKED_SWAPPED 0x01 // flags: palette is byte swapped like 16-bit sprite pixels
+
+/**
+ * @struct omegaPackedImage
+ * @brief Compressed image in flash
+ */
+struct omegaPackedImage {
+    uint16_t width;
+    uint16_t height;
+    uint16_t colors;         // Palette entries
+    uint8_t bits;            // Bits per palette index, 4 or 8
+    uint8_t transparent;     // Palette index that is not drawn, PACKED_OPAQUE for none
+    const uint16_t* palette; // RGB565, byte swapped with PACKED_SWAPPED
+    const uint8_t* data;     // Packet stream
+    uint8_t flags;           // PACKED_SWAPPED
+};
+
+/** @brief Palette entry as RGB565 for drawPixel and drawFastHLine */
+inline uint16_t packedColor(const omegaPackedImage& img, uint8_t index) {
+    uint16_t c = img.palette[index];
+    return img.flags & PACKED_SWAPPED ? (c >> 8) | (c << 8) : c;
+}
+
+/**
+ * @brief Draw a packed image into a sprite
+ *
+ * 16-bit sprites without a viewport are written directly, other sprites go
+ * through drawFastHLine and drawPixel.
+ */
+inline void pushPackedImage(TFT_eSprite* sprite, int32_t x, int32_t y, const omegaPackedImage& img) {
+    if (!sprite || !img.data) return;
+
+    int32_t sw = sprite->width();
+    int32_t sh = sprite->height();
+    uint16_t* buffer = nullptr;
+    // A viewport without its own datum reports full size, opposite corners
+    // inside the viewport show that it does not clip
+    if (sprite->getColorDepth() == 16 && sprite->getViewportX() == 0 && sprite->getViewportY() == 0 &&
+        sprite->checkViewport(0, 0, 1, 1) && sprite->checkViewport(sw - 1, sh - 1, 1, 1)) {
+        buffer = (uint16_t*)sprite->getPointer();
+    }
+
+    // 16-bit sprites keep their pixels byte swapped, only palettes in RGB565 order need a copy
+    const uint16_t* colors = img.palette;
+    uint16_t swapped[256];
+    if (buffer && !(img.flags & PACKED_SWAPPED)) {
+        for (uint16_t i = 0; i < img.colors && i < 256; i++) swapped[i] = (img.palette[i] >> 8) | (img.palette[i] << 8);
+        colors = swapped;
+    }
+
+    const uint8_t* p = img.data;
+    for (int32_t row = 0; row < img.height; row++) {
+        int32_t py = y + row;
+        if (py >= sh) break; // Remaining rows are below the sprite
+        bool visible = py >= 0;
+        uint16_t* line = buffer && visible ? buffer + py * sw : nullptr;
+
+        int32_t col = 0;
+        while (col < img.width) {
+            uint8_t header = *p++;
+            int32_t count = (header & PACKED_COUNT) + 1;
+            int32_t px = x + col;
+
+            if (header & PACKED_RUN) {
+                uint8_t index = *p++;
+                if (visible && index != img.transparent) {
+                    if (line) {
+                        int32_t from = px < 0 ? 0 : px;
+                        int32_t to = px + count > sw ? sw : px + count;
+                        for (int32_t i = from; i < to; i++) line[i] = colors[index];
+                    } else {
+                        sprite->drawFastHLine(px, py, count, packedColor(img, index));
+                    }
+                }
+            } else {
+                for (int32_t i = 0; i < count; i++) {
+                    uint8_t index = img.bits == 4 ? (p[i >> 1] >> ((i & 1) ? 0 : 4)) & 0x0F : p[i];
+                    if (!visible || index == img.transparent) continue;
+                    if (!line) sprite->drawPixel(px + i, py, packedColor(img, index));
+                    else if (px + i >= 0 && px + i < sw) line[px + i] = colors[index];
+                }
+                p += img.bits == 4 ? (count + 1) >> 1 : count;
+            }
+            col += count;
+        }
+    }
+}
+
+#endif // OMEGAIMAGE_H
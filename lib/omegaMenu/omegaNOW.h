@@ -15,26 +15,25 @@ public:
         }
         esp_now_register_recv_cb(receiveCallback);
         esp_now_register_send_cb(sentCallback);
-    }
 
-    void sendMessage(const String &message) {
-        uint8_t broadcastAddress[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+        // Registered once, not before every send
         esp_now_peer_info_t peerInfo = {};
         memcpy(&peerInfo.peer_addr, broadcastAddress, 6);
-        if (!esp_now_is_peer_exist(broadcastAddress)) {
-            esp_now_add_peer(&peerInfo);
-        }
+        esp_now_add_peer(&peerInfo);
+    }
+
+    void sendMessage(const String &message) {
         esp_now_send(broadcastAddress, (const uint8_t *)message.c_str(), message.length());
     }
 
 private:
-    static void receiveCallback(const uint8_t *macAddr, const uint8_t *data, int dataLen) {
-                
+    const uint8_t broadcastAddress[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
-        
+    // Runs in the WiFi task, must not block
+    static void receiveCallback(const uint8_t *macAddr, const uint8_t *data, int dataLen) {
         char buffer[ESP_NOW_MAX_DATA_LEN + 1];
         int msgLen = min(ESP_NOW_MAX_DATA_LEN, dataLen);
-        strncpy(buffer, (const char *)data, msgLen);
+        memcpy(buffer, data, msgLen);
         buffer[msgLen] = 0;
         onMessageReceived(buffer);
     }
@@ -44,10 +43,8 @@ private:
     }
 
     static void onMessageReceived(const char *message) {
-        // Handle the received message
-        digitalWrite(15,1);
-        delay(50);
-        digitalWrite(15,0);
+        // Handle the received message, toggle instead of blinking with a delay
+        digitalWrite(15, !digitalRead(15));
     }
 
     static void onMessageSent(bool success) {
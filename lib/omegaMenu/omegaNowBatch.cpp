@@ -0,0 +1,49 @@
+#include "omegaNowBatch.h"
+
+bool nowBatchWriter::add(const plantState& state, uint32_t timestamp) {
+    if (full()) return false;
+
+    uint8_t* record = payload + NOW_BATCH_HEADER_SIZE + count * NOW_BATCH_RECORD_SIZE;
+    plantStateSchema::toBinary(record + NOW_BATCH_AGE_SIZE, plantStateSchema::binarySize, state);
+    sampledAt[count] = timestamp;
+    count++;
+    return true;
+}
+
+uint8_t nowBatchWriter::finish(uint32_t now) {
+    if (count == 0) return 0;
+
+    payload[0] = count;
+    payload[1] = NOW_BATCH_RECORD_SIZE;
+    for (uint8_t i = 0; i < count; i++) {
+        uint32_t age = (now - sampledAt[i]) / 1000;
+        if (age > 0xFFFF) age = 0xFFFF;
+        uint8_t* p = payload + NOW_BATCH_HEADER_SIZE + i * NOW_BATCH_RECORD_SIZE;
+        p[0] = age & 0xFF;
+        p[1] = age >> 8;
+    }
+    return NOW_BATCH_HEADER_SIZE + count * NOW_BATCH_RECORD_SIZE;
+}
+
+nowBatchReader::nowBatchReader(const uint8_t* data, uint8_t len)
+    : payload(data), length(len), count(0), recordSize(0), index(0) {
+    if (len >= NOW_BATCH_HEADER_SIZE) {
+        count = data[0];
+        recordSize = data[1];
+    }
+}
+
+bool nowBatchReader::valid() const {
+    if (length < NOW_BATCH_HEADER_SIZE || recordSize < NOW_BATCH_RECORD_SIZE) return false;
+    return NOW_BATCH_HEADER_SIZE + count * recordSize <= length;
+}
+
+bool nowBatchReader::next(plantState& state, uint16_t& ageSec) {
+    if (!valid() || index >= count) return false;
+
+    const uint8_t* record = payload + NOW_BATCH_HEADER_SIZE + index * recordSize;
+    ageSec = record[0] | (record[1] << 8);
+    plantStateSchema::fromBinary(record + NOW_BATCH_AGE_SIZE, recordSize - NOW_BATCH_AGE_SIZE, state);
+    index++;
+    return true;
+}
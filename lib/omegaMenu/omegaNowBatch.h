@@ -0,0 +1,95 @@
+/**
+ * @file omegaNowBatch.h
+ * @brief Several plant samples packed into one ESP-NOW frame
+ *
+ * A NOW_BATCH payload starts with a two byte header (record count, record
+ * size) followed by the records. Each record is the sample's age in seconds
+ * followed by a plantStateSchema binary sample, so one frame can carry a
+ * node's last few measurements or the samples of several plants on one node.
+ * The age comes first so it stays in place when later versions append fields
+ * to the sample, the record size lets older receivers skip them.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGANOWBATCH_H
+#define OMEGANOWBATCH_H
+
+#include <Arduino.h>
+#include <omegaPlant.h>
+#include <omegaSchema.h>
+#include <omegaNowLink.h>
+
+#define NOW_BATCH_HEADER_SIZE 2
+#define NOW_BATCH_AGE_SIZE 2
+#define NOW_BATCH_RECORD_SIZE (NOW_BATCH_AGE_SIZE + plantStateSchema::binarySize)
+#define NOW_BATCH_MAX_RECORDS ((NOW_MAX_PAYLOAD - NOW_BATCH_HEADER_SIZE) / NOW_BATCH_RECORD_SIZE)
+
+/**
+ * @class nowBatchWriter
+ * @brief Collects samples until the frame is sent
+ */
+class nowBatchWriter {
+private:
+    uint8_t payload[NOW_BATCH_HEADER_SIZE + NOW_BATCH_MAX_RECORDS * NOW_BATCH_RECORD_SIZE];
+    uint32_t sampledAt[NOW_BATCH_MAX_RECORDS];
+    uint8_t count = 0;
+
+public:
+    /** @brief Drop all collected samples */
+    void clear() { count = 0; }
+
+    /**
+     * @brief Append a sample
+     * @param state Sample, its plantID selects the plant on the receiver
+     * @param timestamp millis() when the sample was taken
+     * @return False if the frame is full
+     */
+    bool add(const plantState& state, uint32_t timestamp);
+
+    uint8_t size() const { return count; }
+    bool full() const { return count >= NOW_BATCH_MAX_RECORDS; }
+
+    /**
+     * @brief Fill in the header and the sample ages
+     * @param now millis() at sending
+     * @return Payload length, 0 if the batch is empty
+     */
+    uint8_t finish(uint32_t now);
+
+    const uint8_t* data() const { return payload; }
+};
+
+/**
+ * @class nowBatchReader
+ * @brief Iterates over the samples of a received batch payload
+ */
+class nowBatchReader {
+private:
+    const uint8_t* payload;
+    uint8_t length;
+    uint8_t count;
+    uint8_t recordSize;
+    uint8_t index;
+
+public:
+    nowBatchReader(const uint8_t* data, uint8_t len);
+
+    /** @brief False if the header does not match the payload length */
+    bool valid() const;
+    uint8_t size() const { return count; }
+
+    /**
+     * @brief Next sample, oldest first as added by the writer
+     * @param state Decoded sample
+     * @param ageSec Seconds between sampling and sending
+     * @return False after the last sample
+     */
+    bool next(plantState& state, uint16_t& ageSec);
+};
+
+#endif // OMEGANOWBATCH_H
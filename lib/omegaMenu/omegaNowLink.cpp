@@ -0,0 +1,531 @@
+#include "omegaNowLink.h"
+#include <WiFi.h>
+
+const uint8_t NOW_BROADCAST[NOW_MAC_LEN] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+/*######################### nowHeader ####################################*/
+
+void nowHeader::encode(uint8_t* p) const {
+    p[0] = type;
+    p[1] = flags;
+    p[2] = seq & 0xFF;
+    p[3] = seq >> 8;
+    p[4] = src & 0xFF;
+    p[5] = src >> 8;
+    p[6] = dst & 0xFF;
+    p[7] = dst >> 8;
+}
+
+void nowHeader::decode(const uint8_t* p) {
+    type = p[0];
+    flags = p[1];
+    seq = p[2] | (p[3] << 8);
+    src = p[4] | (p[5] << 8);
+    dst = p[6] | (p[7] << 8);
+}
+
+/*######################### omegaEspNowRadio #############################*/
+
+omegaEspNowRadio* omegaEspNowRadio::instance = nullptr;
+
+void omegaEspNowRadio::receiveCallback(const uint8_t* mac, const uint8_t* data, int len) {
+    // WiFi task context: copy and wake the rx task, nothing else
+    if (!instance || len <= 0 || len > NOW_MAX_FRAME) return;
+
+    nowRxFrame* frame = instance->rxQueue.reserve();
+    if (!frame) return; // Counted as dropped
+
+    memcpy(frame->mac, mac, NOW_MAC_LEN);
+#if NOW_TRACK_RSSI
+    // The sniffer sees the frame just before this callback
+    frame->rssi = memcmp(instance->snifferMac, mac, NOW_MAC_LEN) == 0 ? instance->snifferRssi : 0;
+#else
+    frame->rssi = 0;
+#endif
+    memcpy(frame->data, data, len);
+    frame->len = len;
+    instance->rxQueue.commit();
+    xTaskNotifyGive(instance->rxTask);
+}
+
+void omegaEspNowRadio::rxTaskLoop(void* params) {
+    omegaEspNowRadio* radio = static_cast<omegaEspNowRadio*>(params);
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (nowRxFrame* frame = radio->rxQueue.front()) {
+            radio->rxRssi = frame->rssi;
+            radio->deliver(frame->mac, frame->data, frame->len);
+            radio->rxQueue.pop();
+        }
+    }
+}
+
+void omegaEspNowRadio::sentCallback(const uint8_t* mac, esp_now_send_status_t status) {
+    if (instance && instance->peers) instance->peers->sendResult(mac, status == ESP_NOW_SEND_SUCCESS);
+}
+
+#if NOW_TRACK_RSSI
+void omegaEspNowRadio::snifferCallback(void* buf, wifi_promiscuous_pkt_type_t type) {
+    if (type != WIFI_PKT_MGMT || !instance) return;
+
+    // ESP-NOW frames are vendor specific action frames with the Espressif OUI
+    const wifi_promiscuous_pkt_t* pkt = (const wifi_promiscuous_pkt_t*)buf;
+    const uint8_t* frame = pkt->payload;
+    if (pkt->rx_ctrl.sig_len < 28 || frame[0] != 0xD0) return;
+    if (frame[24] != 127 || frame[25] != 0x18 || frame[26] != 0xFE || frame[27] != 0x34) return;
+
+    const uint8_t* transmitter = frame + 10;
+    memcpy(instance->snifferMac, transmitter, NOW_MAC_LEN);
+    instance->snifferRssi = pkt->rx_ctrl.rssi;
+    if (instance->peers) instance->peers->rssi(transmitter, pkt->rx_ctrl.rssi);
+}
+#endif
+
+bool omegaEspNowRadio::begin() {
+    if (esp_now_init() != ESP_OK) {
+        Serial.println("Error initializing ESP-NOW");
+        return false;
+    }
+    if (!rxTask && xTaskCreate(rxTaskLoop, "NowRx_Task", NOW_RX_STACK, this, NOW_RX_PRIORITY, &rxTask) != pdPASS) {
+        return false;
+    }
+    instance = this;
+    esp_now_register_recv_cb(receiveCallback);
+    esp_now_register_send_cb(sentCallback);
+
+    esp_now_peer_info_t peerInfo = {};
+    memcpy(peerInfo.peer_addr, NOW_BROADCAST, NOW_MAC_LEN);
+    peerInfo.channel = 0; // Current channel
+    peerInfo.encrypt = false;
+    if (!esp_now_is_peer_exist(NOW_BROADCAST) && esp_now_add_peer(&peerInfo) != ESP_OK) return false;
+
+    if (peers) peers->begin();
+#if NOW_TRACK_RSSI
+    // Feeds the peer stats and the route table
+    wifi_promiscuous_filter_t filter = {WIFI_PROMIS_FILTER_MASK_MGMT};
+    esp_wifi_set_promiscuous_filter(&filter);
+    esp_wifi_set_promiscuous_rx_cb(snifferCallback);
+    esp_wifi_set_promiscuous(true);
+#endif
+    return true;
+}
+
+bool omegaEspNowRadio::send(const uint8_t* mac, const uint8_t* data, size_t len) {
+    return esp_now_send(mac, data, len) == ESP_OK;
+}
+
+void omegaEspNowRadio::heard(const uint8_t* mac, uint16_t id, uint8_t type) {
+    if (peers) peers->heard(mac, id, type);
+}
+
+void omegaEspNowRadio::acked(const uint8_t* mac, uint32_t ms) {
+    if (peers) peers->ackLatency(mac, ms);
+}
+
+bool omegaEspNowRadio::reachable(const uint8_t* mac) {
+    return memcmp(mac, NOW_BROADCAST, NOW_MAC_LEN) == 0 || esp_now_is_peer_exist(mac);
+}
+
+uint8_t omegaEspNowRadio::channel() {
+    uint8_t primary = 0;
+    wifi_second_chan_t second;
+    if (esp_wifi_get_channel(&primary, &second) != ESP_OK) return 0;
+    return primary;
+}
+
+uint8_t omegaEspNowRadio::apChannel() {
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK) return 0;
+    return ap.primary;
+}
+
+bool omegaEspNowRadio::setChannel(uint8_t ch) {
+    // Changing the channel under an association would drop it
+    if (apChannel()) return false;
+    return esp_wifi_set_channel(ch, WIFI_SECOND_CHAN_NONE) == ESP_OK;
+}
+
+/*######################### omegaLoopbackRadio ###########################*/
+
+omegaLoopbackRadio::omegaLoopbackRadio(uint8_t id) {
+    memset(mac, 0, sizeof(mac));
+    mac[0] = 0x02; // Locally administered
+    mac[5] = id;
+}
+
+void omegaLoopbackRadio::pair(omegaLoopbackRadio& a, omegaLoopbackRadio& b) {
+    a.peer = &b;
+    b.peer = &a;
+}
+
+void omegaLoopbackRadio::associate(uint8_t ch) {
+    ap = ch;
+    if (ch) chan = ch;
+}
+
+bool omegaLoopbackRadio::setChannel(uint8_t ch) {
+    if (ap) return false;
+    chan = ch;
+    return true;
+}
+
+bool omegaLoopbackRadio::send(const uint8_t* dest, const uint8_t* data, size_t len) {
+    if (!peer) return false;
+    sent++;
+    if ((lossPercent && random(100) < lossPercent) || peer->chan != chan) {
+        lost++;
+        return true; // Lost on the air, the sender does not notice
+    }
+    if (memcmp(dest, NOW_BROADCAST, NOW_MAC_LEN) == 0 || memcmp(dest, peer->mac, NOW_MAC_LEN) == 0) {
+        peer->deliver(mac, data, len);
+    }
+    return true;
+}
+
+/*######################### omegaNowLink #################################*/
+
+omegaNowLink::omegaNowLink(omegaRadio& r, uint16_t id) : radio(r), deviceID(id), nextSeq(0) {
+    memset(pending, 0, sizeof(pending));
+    memset(sources, 0, sizeof(sources));
+}
+
+bool omegaNowLink::begin(uint16_t id) {
+    if (id) deviceID = id;
+    nextSeq = (uint16_t)random(1, 0xFFFF); // Receivers see a restart as a jump, not as old frames
+
+    if (!mutex) mutex = xSemaphoreCreateMutex();
+    if (!mutex) return false;
+
+    radio.onReceive(receiveThunk, this);
+    return radio.begin();
+}
+
+void omegaNowLink::onFrame(nowFrameHandler h, void* ctx) {
+    handler = h;
+    handlerCtx = ctx;
+}
+
+bool omegaNowLink::send(const uint8_t* mac, uint8_t type, const uint8_t* payload, uint8_t len) {
+    nowHeader header = {type, (uint8_t)(NOW_MESH_TTL | (sink ? NOW_FLAG_SINK : 0)), 0, deviceID, NOW_ANY};
+    return queue(mac, header, payload, len);
+}
+
+bool omegaNowLink::sendTo(uint16_t dst, uint8_t type, const uint8_t* payload, uint8_t len) {
+    uint8_t mac[NOW_MAC_LEN];
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return false;
+    bool routed = dst == NOW_ANY ? routes.nearestSink(mac) : routes.lookup(dst, mac);
+    xSemaphoreGive(mutex);
+    if (!routed || !radio.reachable(mac)) memcpy(mac, NOW_BROADCAST, NOW_MAC_LEN);
+
+    nowHeader header = {type, (uint8_t)(NOW_MESH_TTL | (sink ? NOW_FLAG_SINK : 0)), 0, deviceID, dst};
+    return queue(mac, header, payload, len);
+}
+
+bool omegaNowLink::queue(const uint8_t* mac, const nowHeader& header, const uint8_t* payload, uint8_t len) {
+    if (len > NOW_MAX_PAYLOAD || header.type == NOW_ACK) return false;
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return false;
+
+    pendingFrame* slot = nullptr;
+    for (uint8_t i = 0; i < NOW_MAX_PENDING; i++) {
+        if (!pending[i].used) { slot = &pending[i]; break; }
+    }
+    if (!slot) {
+        xSemaphoreGive(mutex);
+        return false;
+    }
+
+    // Own frames get the next sequence number, relayed ones keep the source's
+    nowHeader h = header;
+    bool own = h.src == deviceID;
+    if (own) h.seq = nextSeq++;
+    h.encode(slot->frame);
+    memcpy(slot->frame + NOW_HEADER_SIZE, payload, len);
+    memcpy(slot->mac, mac, NOW_MAC_LEN);
+    slot->len = NOW_HEADER_SIZE + len;
+    slot->retries = 0;
+    slot->seq = h.seq;
+    slot->src = h.src;
+    slot->dst = h.dst;
+    slot->sentAt = millis();
+    slot->firstSentAt = slot->sentAt;
+    slot->used = true;
+
+    // Copy out, the ack may arrive and free the slot before send returns
+    uint8_t frame[NOW_MAX_FRAME];
+    uint8_t frameLen = slot->len;
+    memcpy(frame, slot->frame, frameLen);
+    if (own) stats.sent++;
+    xSemaphoreGive(mutex);
+
+    if (radio.send(mac, frame, frameLen)) return true;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    if (slot->used && slot->seq == h.seq && slot->src == h.src) slot->used = false;
+    stats.dropped++;
+    xSemaphoreGive(mutex);
+    return false;
+}
+
+bool omegaNowLink::broadcast(const nowHeader& header, const uint8_t* payload, uint8_t len) {
+    // Sent once and never acked, stays out of the pending frames and their stats
+    if (len > NOW_MAX_PAYLOAD) return false;
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return false;
+    nowHeader h = header;
+    if (h.src == deviceID) h.seq = nextSeq++;
+    xSemaphoreGive(mutex);
+
+    uint8_t frame[NOW_MAX_FRAME];
+    h.encode(frame);
+    memcpy(frame + NOW_HEADER_SIZE, payload, len);
+    return radio.send(NOW_BROADCAST, frame, NOW_HEADER_SIZE + len);
+}
+
+bool omegaNowLink::forward(const uint8_t* from, nowHeader header, const uint8_t* payload, uint8_t len) {
+    uint8_t hops = header.hops() < 7 ? header.hops() + 1 : 7;
+    header.flags = (header.flags & NOW_FLAG_SINK) | (hops << 4) | (header.ttl() - 1);
+
+    uint8_t mac[NOW_MAC_LEN];
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return false;
+    bool routed = header.dst == NOW_ANY ? routes.nearestSink(mac) : routes.lookup(header.dst, mac);
+    xSemaphoreGive(mutex);
+
+    // Announcements are for every node and nobody acks them
+    if (header.type == NOW_CHANNEL) {
+        if (!broadcast(header, payload, len)) return false;
+        stats.relayed++;
+        return true;
+    }
+
+    // Never send a frame back where it came from, flood if there is no usable route
+    if (!routed || memcmp(mac, from, NOW_MAC_LEN) == 0 || !radio.reachable(mac)) {
+        memcpy(mac, NOW_BROADCAST, NOW_MAC_LEN);
+    }
+    if (!queue(mac, header, payload, len)) return false;
+    stats.relayed++;
+    return true;
+}
+
+void omegaNowLink::moveTo(uint8_t ch) {
+    if (ch < 1 || ch > NOW_MAX_CHANNEL || ch == radio.channel()) return;
+    if (radio.setChannel(ch)) stats.channels++;
+}
+
+void omegaNowLink::loop() {
+    // Peers on the old channel cannot hear this, they find the new one by hunting
+    uint8_t ch = announce ? radio.apChannel() : 0;
+    nowHeader header = {NOW_CHANNEL, (uint8_t)(NOW_MESH_TTL | (sink ? NOW_FLAG_SINK : 0)), 0, deviceID, NOW_ANY};
+    if (ch && ch != announcedChannel && broadcast(header, &ch, 1)) {
+        announcedChannel = ch;
+        stats.channels++;
+    }
+
+    for (uint8_t i = 0; i < NOW_MAX_PENDING; i++) {
+        uint8_t frame[NOW_MAX_FRAME];
+        uint8_t mac[NOW_MAC_LEN];
+        uint8_t frameLen = 0;
+
+        if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return;
+        // Read under the mutex, a slot queued meanwhile must not look sent in the future
+        uint32_t now = millis();
+        pendingFrame& p = pending[i];
+        if (p.used && now - p.sentAt >= NOW_ACK_TIMEOUT) {
+            if (p.retries >= NOW_MAX_RETRIES) {
+                p.used = false;
+                stats.dropped++;
+                if (dropsInRow < 0xFF) dropsInRow++;
+                // The neighbour is gone, later frames take another route or flood
+                if (memcmp(p.mac, NOW_BROADCAST, NOW_MAC_LEN) != 0) routes.drop(p.mac);
+            } else {
+                p.retries++;
+                p.sentAt = now;
+                stats.retries++;
+                frameLen = p.len;
+                memcpy(frame, p.frame, frameLen);
+                memcpy(mac, p.mac, NOW_MAC_LEN);
+            }
+        }
+        xSemaphoreGive(mutex);
+
+        if (frameLen) radio.send(mac, frame, frameLen);
+    }
+
+    // Nobody answers on this channel, retries of pending frames go out on the next
+    if (follow && dropsInRow >= NOW_HUNT_DROPS) {
+        dropsInRow = 0;
+        moveTo(radio.channel() % NOW_MAX_CHANNEL + 1);
+    }
+}
+
+uint8_t omegaNowLink::pendingCount() const {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < NOW_MAX_PENDING; i++) {
+        if (pending[i].used) count++;
+    }
+    return count;
+}
+
+bool omegaNowLink::route(uint8_t index, nowRoute& r) {
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return false;
+    bool used = routes.get(index, r);
+    xSemaphoreGive(mutex);
+    return used;
+}
+
+void omegaNowLink::receiveThunk(const uint8_t* mac, const uint8_t* data, int len, void* ctx) {
+    static_cast<omegaNowLink*>(ctx)->receive(mac, data, len);
+}
+
+void omegaNowLink::receive(const uint8_t* mac, const uint8_t* data, int len) {
+    if (len < NOW_HEADER_SIZE || len > NOW_MAX_FRAME) return;
+
+    nowHeader header;
+    header.decode(data);
+
+    // Own frame repeated by a relay
+    if (header.src == deviceID) return;
+
+    // Lets the radio pair the sender before the ack goes out
+    radio.heard(mac, header.src, header.type);
+
+    // Every frame, duplicates included, tells which neighbour leads to its source
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return;
+    routes.learn(header.src, mac, radio.rssi(), header.hops(), header.sink());
+    xSemaphoreGive(mutex);
+
+    if (header.type == NOW_ACK) {
+        uint32_t latency = 0;
+        bool matched = false;
+        if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return;
+        for (uint8_t i = 0; i < NOW_MAX_PENDING; i++) {
+            pendingFrame& p = pending[i];
+            // A broadcast frame is only taken over by a sink, a relay or the addressed device
+            bool fromTarget = memcmp(p.mac, NOW_BROADCAST, NOW_MAC_LEN) == 0
+                ? header.sink() || (header.flags & NOW_FLAG_RELAY) || (p.dst != NOW_ANY && header.src == p.dst)
+                : memcmp(p.mac, mac, NOW_MAC_LEN) == 0;
+            if (p.used && p.seq == header.seq && p.src == header.dst && fromTarget) {
+                p.used = false;
+                stats.acked++;
+                latency = millis() - p.firstSentAt;
+                uint32_t avg = stats.latency ? (stats.latency * 7 + latency) / 8 : latency;
+                stats.latency = avg > 0xFFFF ? 0xFFFF : avg;
+                dropsInRow = 0;
+                matched = true;
+                break;
+            }
+        }
+        xSemaphoreGive(mutex);
+        if (matched) radio.acked(mac, latency);
+        return;
+    }
+
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return;
+    bool duplicate = isDuplicate(header.src, header.seq);
+    if (duplicate) stats.duplicates++;
+    else stats.received++;
+    xSemaphoreGive(mutex);
+
+    const uint8_t* payload = data + NOW_HEADER_SIZE;
+    uint8_t payloadLen = len - NOW_HEADER_SIZE;
+
+    // A sink consumes NOW_ANY frames, other relays pass them on towards one.
+    // Channel announcements are for every node, pass sinks too and are never acked,
+    // otherwise any node in range would take them over from the announcer.
+    bool forMe = header.dst == deviceID || header.dst == NOW_ANY;
+    bool consumed = header.dst == deviceID || (sink && header.dst == NOW_ANY && header.type != NOW_CHANNEL);
+    bool passOn = relay && header.ttl() && !consumed;
+    bool ackable = header.type != NOW_CHANNEL;
+
+    if (duplicate) {
+        // The previous ack of a retransmitted frame may have been lost.
+        // A copy that was not forwarded was forgotten below and is not a duplicate.
+        if (ackable && (consumed || passOn)) acknowledge(mac, header, passOn);
+        return;
+    }
+
+    if (consumed) {
+        if (ackable) acknowledge(mac, header, false);
+    } else if (passOn) {
+        if (forward(mac, header, payload, payloadLen)) {
+            if (ackable) acknowledge(mac, header, true);
+        } else {
+            // Not taken over, the sender's retry is handled as a new frame
+            if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return;
+            forget(header.src, header.seq);
+            xSemaphoreGive(mutex);
+            return;
+        }
+    }
+
+    if (header.type == NOW_CHANNEL) {
+        // Forwarded first, the copy still leaves on the old channel
+        if (forMe && follow && payloadLen >= 1) moveTo(payload[0]);
+        return;
+    }
+
+    if (forMe && handler) handler(mac, header, payload, payloadLen, handlerCtx);
+}
+
+void omegaNowLink::acknowledge(const uint8_t* mac, const nowHeader& header, bool relayed) {
+    uint8_t frame[NOW_HEADER_SIZE];
+    uint8_t flags = (sink ? NOW_FLAG_SINK : 0) | (relayed ? NOW_FLAG_RELAY : 0);
+    nowHeader ack = {NOW_ACK, flags, header.seq, deviceID, header.src};
+    ack.encode(frame);
+    // Unpaired senders get a broadcast ack, dst keeps others from taking it as theirs
+    radio.send(radio.reachable(mac) ? mac : NOW_BROADCAST, frame, sizeof(frame));
+}
+
+bool omegaNowLink::isDuplicate(uint16_t src, uint16_t seq) {
+    uint32_t now = millis();
+    sourceWindow* w = nullptr;
+    sourceWindow* freeSlot = nullptr;
+    for (uint8_t i = 0; i < NOW_MAX_SOURCES; i++) {
+        sourceWindow& s = sources[i];
+        if (s.used && s.src == src) { w = &s; break; }
+        // Prefer an unused slot, otherwise the sender heard from longest ago
+        if (!freeSlot || (freeSlot->used && (!s.used || now - s.updatedAt > now - freeSlot->updatedAt))) {
+            freeSlot = &s;
+        }
+    }
+
+    if (!w) {
+        // New sender, reuse a free slot or the least recently updated one
+        w = freeSlot;
+        w->used = true;
+        w->src = src;
+        w->latest = seq;
+        w->seen = 1;
+        w->updatedAt = now;
+        return false;
+    }
+    w->updatedAt = now;
+
+    int16_t ahead = (int16_t)(seq - w->latest);
+    if (ahead > 0) {
+        w->seen = ahead >= NOW_DEDUP_WINDOW ? 1 : (w->seen << ahead) | 1;
+        w->latest = seq;
+        return false;
+    }
+
+    uint16_t behind = -ahead;
+    if (behind >= NOW_DEDUP_WINDOW) {
+        // Far behind the window, the sender restarted
+        w->latest = seq;
+        w->seen = 1;
+        return false;
+    }
+
+    uint32_t bit = 1UL << behind;
+    if (w->seen & bit) return true;
+    w->seen |= bit;
+    return false;
+}
+
+void omegaNowLink::forget(uint16_t src, uint16_t seq) {
+    for (uint8_t i = 0; i < NOW_MAX_SOURCES; i++) {
+        sourceWindow& w = sources[i];
+        if (!w.used || w.src != src) continue;
+        uint16_t behind = w.latest - seq;
+        if (behind < NOW_DEDUP_WINDOW) w.seen &= ~(1UL << behind);
+        return;
+    }
+}
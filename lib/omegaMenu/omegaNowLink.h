@@ -0,0 +1,425 @@
+/**
+ * @file omegaNowLink.h
+ * @brief Reliable binary ESP-NOW link between PotPal and PlantPal
+ *
+ * Sensor and state frames travel straight from pot to display without WiFi
+ * association or the MQTT broker. Every data frame carries a sequence number
+ * and is acknowledged by the receiver, unacknowledged frames are resent a few
+ * times. Receivers drop retransmissions they already delivered.
+ *
+ * The link talks to an omegaRadio, either the real ESP-NOW driver or a
+ * loopback pair that runs the whole protocol on the host.
+ *
+ * Powered nodes can relay frames for devices out of range of a display.
+ * Every hop acknowledges to the previous one, a node only acks frames it
+ * consumes or passes on. Relays forward each
+ * (source, seq) once and only while the frame's TTL lasts. The next hop is
+ * taken from an omegaNowRoutes table learned from the frames a node hears,
+ * without a route the frame is rebroadcast.
+ *
+ * ESP-NOW only reaches nodes on the same WiFi channel. A display that stays
+ * associated with the access point for MQTT cannot leave the AP's channel,
+ * so it broadcasts that channel in a NOW_CHANNEL frame whenever it changes,
+ * once and without an ack.
+ * Pots without an association follow announcements, and step through the
+ * channels when their frames keep going unacknowledged, which is how they
+ * find a display that moved while they could not hear it.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGANOWLINK_H
+#define OMEGANOWLINK_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <esp_wifi.h>
+#include <esp_now.h>
+#include <omegaNowPeers.h>
+#include <omegaFrameQueue.h>
+#include <omegaNowRoutes.h>
+
+/** Settings */
+#define NOW_MAX_PENDING 4   // Unacknowledged frames per link
+#define NOW_ACK_TIMEOUT 25  // Milliseconds before a frame is resent
+#define NOW_MAX_RETRIES 3   // Resends before a frame is dropped
+#define NOW_MAX_SOURCES 8   // Senders tracked for duplicate detection
+#define NOW_DEDUP_WINDOW 32 // Sequence numbers remembered per sender
+#define NOW_RX_QUEUE_LEN 16 // Received frames buffered for the rx task, power of two
+#define NOW_RX_PRIORITY 4   // Rx task, above Display_Task and below Wifi_Task
+#define NOW_RX_STACK 4096
+#define NOW_MESH_TTL 3      // Relays a frame may pass, at most 15
+#define NOW_HUNT_DROPS 3    // Frames given up in a row before a follower tries the next channel
+#define NOW_MAX_CHANNEL 13  // Highest channel a follower steps to
+/** End Settings */
+
+#define NOW_MAC_LEN 6
+#define NOW_HEADER_SIZE 8
+#define NOW_MAX_FRAME ESP_NOW_MAX_DATA_LEN
+#define NOW_MAX_PAYLOAD (NOW_MAX_FRAME - NOW_HEADER_SIZE)
+
+#define NOW_ANY 0 // Destination id: every receiver, relays head for the nearest sink
+
+/** Header flags */
+#define NOW_FLAG_TTL 0x0F  // Relays the frame may still pass
+#define NOW_FLAG_HOPS 0x70 // Relays the frame passed
+#define NOW_FLAG_SINK 0x80 // Source consumes sensor data
+#define NOW_FLAG_RELAY 0x01 // Acks only, where TTL is unused: the acking relay took the frame over
+
+/**
+ * @enum nowFrameType
+ * @brief Payload carried by a frame
+ */
+enum nowFrameType : uint8_t {
+    NOW_ACK = 0,     // Acknowledges header.seq, no payload
+    NOW_SENSOR = 1,  // plantStateSchema binary
+    NOW_STATE = 2,   // PlantSaveDataSchema binary
+    NOW_PROFILE = 3, // PlantProfileSchema binary
+    NOW_BATCH = 4,   // Several samples, see omegaNowBatch.h
+    NOW_CHANNEL = 5, // WiFi channel of the sender, one byte, handled by the link
+};
+
+/**
+ * @struct nowHeader
+ * @brief Frame header, packed little-endian on the air
+ */
+struct nowHeader {
+    uint8_t type;
+    uint8_t flags;
+    uint16_t seq;
+    uint16_t src; // Device id of the original sender
+    uint16_t dst; // Device id of the final receiver, NOW_ANY for all; acks carry the acked src
+
+    void encode(uint8_t* p) const;
+    void decode(const uint8_t* p);
+
+    uint8_t ttl() const { return flags & NOW_FLAG_TTL; }
+    uint8_t hops() const { return (flags & NOW_FLAG_HOPS) >> 4; }
+    bool sink() const { return flags & NOW_FLAG_SINK; }
+};
+
+extern const uint8_t NOW_BROADCAST[NOW_MAC_LEN];
+
+/**
+ * @brief Device id from the type prefix and the device specific half of the MAC
+ *
+ * All three NIC bytes go into the id, hashed with FNV-1a and folded to 16
+ * bits, so devices only collide by chance instead of whenever their last MAC
+ * byte matches. Never returns NOW_ANY.
+ */
+inline uint16_t nowDeviceID(uint8_t prefix, const uint8_t mac[NOW_MAC_LEN]) {
+    const uint8_t bytes[4] = {prefix, mac[3], mac[4], mac[5]};
+    uint32_t hash = 2166136261UL;
+    for (uint8_t i = 0; i < sizeof(bytes); i++) {
+        hash ^= bytes[i];
+        hash *= 16777619UL;
+    }
+    uint16_t id = (hash >> 16) ^ (hash & 0xFFFF);
+    return id == NOW_ANY ? 1 : id;
+}
+
+/**
+ * @class omegaRadio
+ * @brief Raw frame transport underneath omegaNowLink
+ */
+class omegaRadio {
+public:
+    typedef void (*receiveHandler)(const uint8_t* mac, const uint8_t* data, int len, void* ctx);
+
+    virtual ~omegaRadio() {}
+    virtual bool begin() = 0;
+
+    /**
+     * @brief Transmit one frame
+     * @param mac Destination, NOW_BROADCAST for all
+     * @return False if the driver refused the frame
+     */
+    virtual bool send(const uint8_t* mac, const uint8_t* data, size_t len) = 0;
+
+    void onReceive(receiveHandler h, void* c) {
+        handler = h;
+        ctx = c;
+    }
+
+    /** @brief A valid frame arrived, called before it is acknowledged */
+    virtual void heard(const uint8_t* /*mac*/, uint16_t /*id*/, uint8_t /*type*/) {}
+
+    /** @brief A data frame sent to mac was acknowledged after ms */
+    virtual void acked(const uint8_t* /*mac*/, uint32_t /*ms*/) {}
+
+    /** @brief dBm of the frame being delivered, 0 if unknown */
+    virtual int8_t rssi() const { return 0; }
+
+    /** @brief Whether unicast frames to mac can be sent */
+    virtual bool reachable(const uint8_t* /*mac*/) { return true; }
+
+    /** @brief WiFi channel frames go out on, 0 if unknown */
+    virtual uint8_t channel() { return 0; }
+
+    /** @brief Channel of the access point the radio is associated with, 0 if none */
+    virtual uint8_t apChannel() { return 0; }
+
+    /** @brief Move to another channel, false while an access point holds the radio */
+    virtual bool setChannel(uint8_t /*ch*/) { return false; }
+
+protected:
+    receiveHandler handler = nullptr;
+    void* ctx = nullptr;
+
+    void deliver(const uint8_t* mac, const uint8_t* data, int len) {
+        if (handler) handler(mac, data, len, ctx);
+    }
+};
+
+/**
+ * @struct nowRxFrame
+ * @brief Raw received frame waiting for the rx task
+ */
+struct nowRxFrame {
+    uint8_t mac[NOW_MAC_LEN];
+    int8_t rssi;
+    uint8_t len;
+    uint8_t data[NOW_MAX_FRAME];
+};
+
+typedef omegaFrameQueue<nowRxFrame, NOW_RX_QUEUE_LEN> nowRxQueue;
+
+/**
+ * @class omegaEspNowRadio
+ * @brief omegaRadio on top of the ESP-NOW driver, WiFi must be started first
+ *
+ * Unicast only reaches peers registered in the omegaNowPeers table, the
+ * broadcast peer is registered once in begin().
+ *
+ * The driver's receive callback runs in the WiFi task and only copies the
+ * frame into a preallocated queue. Decoding, acks and the frame handler run
+ * in a separate rx task.
+ */
+class omegaEspNowRadio : public omegaRadio {
+private:
+    static omegaEspNowRadio* instance;
+    omegaNowPeers* peers;
+    nowRxQueue rxQueue;
+    TaskHandle_t rxTask = nullptr;
+    int8_t rxRssi = 0;
+#if NOW_TRACK_RSSI
+    uint8_t snifferMac[NOW_MAC_LEN]; // Transmitter of the last sniffed frame
+    int8_t snifferRssi = 0;
+#endif
+
+    static void rxTaskLoop(void* params);
+
+    static void receiveCallback(const uint8_t* mac, const uint8_t* data, int len);
+    static void sentCallback(const uint8_t* mac, esp_now_send_status_t status);
+#if NOW_TRACK_RSSI
+    static void snifferCallback(void* buf, wifi_promiscuous_pkt_type_t type);
+#endif
+
+public:
+    explicit omegaEspNowRadio(omegaNowPeers* peerTable = nullptr) : peers(peerTable) {}
+
+    bool begin() override;
+    bool send(const uint8_t* mac, const uint8_t* data, size_t len) override;
+    void heard(const uint8_t* mac, uint16_t id, uint8_t type) override;
+    void acked(const uint8_t* mac, uint32_t ms) override;
+    int8_t rssi() const override { return rxRssi; }
+    bool reachable(const uint8_t* mac) override;
+    uint8_t channel() override;
+    uint8_t apChannel() override;
+    bool setChannel(uint8_t ch) override;
+
+    /** @brief Receive queue counters: pushed, dropped, highWater */
+    const nowRxQueue& queue() const { return rxQueue; }
+};
+
+/**
+ * @class omegaLoopbackRadio
+ * @brief In-memory radio pair for running the link on the host
+ *
+ * Frames sent on one radio are delivered synchronously to its peer.
+ * A loss rate drops frames to exercise the retry path. Frames only arrive
+ * while both radios are on the same channel.
+ */
+class omegaLoopbackRadio : public omegaRadio {
+private:
+    omegaLoopbackRadio* peer = nullptr;
+    uint8_t mac[NOW_MAC_LEN];
+    uint8_t lossPercent = 0;
+    uint8_t chan = 1;
+    uint8_t ap = 0;
+
+public:
+    uint32_t sent = 0;
+    uint32_t lost = 0;
+
+    explicit omegaLoopbackRadio(uint8_t id);
+
+    /** @brief Connect two radios to each other */
+    static void pair(omegaLoopbackRadio& a, omegaLoopbackRadio& b);
+    void setLoss(uint8_t percent) { lossPercent = percent; }
+    const uint8_t* address() const { return mac; }
+
+    /** @brief Simulate an association with an access point on ch, 0 leaves it */
+    void associate(uint8_t ch);
+
+    bool begin() override { return true; }
+    bool send(const uint8_t* dest, const uint8_t* data, size_t len) override;
+    uint8_t channel() override { return chan; }
+    uint8_t apChannel() override { return ap; }
+    bool setChannel(uint8_t ch) override;
+};
+
+/**
+ * @struct nowStats
+ * @brief Link counters
+ */
+struct nowStats {
+    uint32_t sent = 0;       // New data frames
+    uint32_t retries = 0;    // Resent data frames
+    uint32_t acked = 0;      // Data frames confirmed by the receiver
+    uint32_t dropped = 0;    // Data frames given up after NOW_MAX_RETRIES
+    uint32_t received = 0;   // Data frames delivered to the handler
+    uint32_t duplicates = 0; // Retransmissions filtered out
+    uint32_t relayed = 0;    // Frames forwarded for other devices
+    uint32_t channels = 0;   // Channel changes announced, followed or hunted
+    uint16_t latency = 0;    // Smoothed milliseconds from first send to ack
+};
+
+typedef void (*nowFrameHandler)(const uint8_t* mac, const nowHeader& header,
+                                const uint8_t* payload, uint8_t len, void* ctx);
+
+/**
+ * @class omegaNowLink
+ * @brief Sequence numbers, acks and retries over an omegaRadio
+ */
+class omegaNowLink {
+private:
+    struct pendingFrame {
+        bool used;
+        uint8_t mac[NOW_MAC_LEN];
+        uint8_t frame[NOW_MAX_FRAME];
+        uint8_t len;
+        uint8_t retries;
+        uint16_t seq;
+        uint16_t src;
+        uint16_t dst;
+        uint32_t sentAt;
+        uint32_t firstSentAt;
+    };
+
+    struct sourceWindow {
+        uint16_t src;
+        uint16_t latest;
+        uint32_t seen;      // Bit n set: latest - n was delivered
+        uint32_t updatedAt; // millis() of the last frame, the stalest window is reused
+        bool used;
+    };
+
+    omegaRadio& radio;
+    uint16_t deviceID;
+    uint16_t nextSeq;
+    SemaphoreHandle_t mutex = nullptr;
+    pendingFrame pending[NOW_MAX_PENDING];
+    sourceWindow sources[NOW_MAX_SOURCES];
+    nowFrameHandler handler = nullptr;
+    void* handlerCtx = nullptr;
+    omegaNowRoutes routes;
+    bool relay = false;
+    bool sink = false;
+    bool announce = false;
+    bool follow = false;
+    uint8_t announcedChannel = 0;
+    uint8_t dropsInRow = 0; // Given up frames since the last ack
+
+    static void receiveThunk(const uint8_t* mac, const uint8_t* data, int len, void* ctx);
+    void receive(const uint8_t* mac, const uint8_t* data, int len);
+    void acknowledge(const uint8_t* mac, const nowHeader& header, bool relayed);
+    bool isDuplicate(uint16_t src, uint16_t seq);
+    void forget(uint16_t src, uint16_t seq);
+    bool queue(const uint8_t* mac, const nowHeader& header, const uint8_t* payload, uint8_t len);
+    bool broadcast(const nowHeader& header, const uint8_t* payload, uint8_t len);
+    bool forward(const uint8_t* from, nowHeader header, const uint8_t* payload, uint8_t len);
+    void moveTo(uint8_t ch);
+
+public:
+    nowStats stats;
+
+    /**
+     * @brief Constructor
+     * @param radio Transport the frames are sent on
+     * @param id Device id put into every frame
+     */
+    omegaNowLink(omegaRadio& radio, uint16_t id = 0);
+
+    /**
+     * @brief Start the radio and register for received frames
+     * @param id Device id, 0 keeps the one given to the constructor
+     */
+    bool begin(uint16_t id = 0);
+
+    /** @brief Handler for every new data frame */
+    void onFrame(nowFrameHandler h, void* ctx = nullptr);
+
+    /** @brief Forward frames for other devices, only for nodes that never sleep */
+    void setRelay(bool on) { relay = on; }
+
+    /** @brief Announce this node as a consumer of sensor data, relays route NOW_ANY frames to it */
+    void setSink(bool on) { sink = on; }
+
+    /**
+     * @brief Broadcast the access point's channel from loop() whenever it changes
+     * For nodes that stay associated, e.g. a display bridging to MQTT.
+     */
+    void setAnnounceChannel(bool on) { announce = on; }
+
+    /**
+     * @brief Move to announced channels and hunt for one when frames go unacknowledged
+     * Has no effect while the radio is associated with an access point.
+     */
+    void setFollowChannel(bool on) { follow = on; }
+
+    /**
+     * @brief Send a data frame, it is resent until acknowledged
+     * @param mac Destination, NOW_BROADCAST is acknowledged by the first sink or relay
+     * @param type Frame type
+     * @param payload Frame payload
+     * @param len Payload length, at most NOW_MAX_PAYLOAD
+     * @return False if all pending slots are busy or the radio failed
+     */
+    bool send(const uint8_t* mac, uint8_t type, const uint8_t* payload, uint8_t len);
+
+    /**
+     * @brief Send a data frame to a device, possibly through relays
+     * @param dst Device id, NOW_ANY for the nearest sink
+     * @return False if all pending slots are busy or the radio failed
+     */
+    bool sendTo(uint16_t dst, uint8_t type, const uint8_t* payload, uint8_t len);
+
+    /**
+     * @brief Encode an object with its schema and send it
+     * @tparam S omegaSchema::Schema of the object
+     */
+    template <typename S>
+    bool sendSchema(const uint8_t* mac, uint8_t type, const typename S::type& o) {
+        static_assert(S::binarySize <= NOW_MAX_PAYLOAD, "Schema does not fit into one frame");
+        uint8_t payload[S::binarySize];
+        S::toBinary(payload, sizeof(payload), o);
+        return send(mac, type, payload, sizeof(payload));
+    }
+
+    /** @brief Resend timed out frames and announce channel changes, call regularly */
+    void loop();
+
+    /** @brief Number of frames still waiting for an ack */
+    uint8_t pendingCount() const;
+
+    /** @brief Copy of a route by table index, false if the slot is free */
+    bool route(uint8_t index, nowRoute& r);
+};
+
+#endif // OMEGANOWLINK_H
@@ -0,0 +1,219 @@
+#include "omegaNowPeers.h"
+
+omegaNowPeers::omegaNowPeers() {
+    for (uint8_t i = 0; i < NOW_MAX_PEERS; i++) peers[i].used = false;
+}
+
+bool omegaNowPeers::begin() {
+    if (!mutex) mutex = xSemaphoreCreateMutex();
+    if (!saveMutex) saveMutex = xSemaphoreCreateMutex();
+    if (!mutex || !saveMutex) return false;
+
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    load();
+    for (uint8_t i = 0; i < NOW_MAX_PEERS; i++) {
+        if (peers[i].used && !registerPeer(peers[i].mac)) peers[i].used = false;
+    }
+    xSemaphoreGive(mutex);
+    return true;
+}
+
+nowPeer* omegaNowPeers::findLocked(const uint8_t* mac) {
+    for (uint8_t i = 0; i < NOW_MAX_PEERS; i++) {
+        if (peers[i].used && memcmp(peers[i].mac, mac, 6) == 0) return &peers[i];
+    }
+    return nullptr;
+}
+
+nowPeer* omegaNowPeers::freeLocked() {
+    uint32_t now = millis();
+    nowPeer* stalest = nullptr;
+    for (uint8_t i = 0; i < NOW_MAX_PEERS; i++) {
+        if (!peers[i].used) return &peers[i];
+        // Peers not heard since boot have lastSeen 0 and go first
+        if (!stalest || now - peers[i].stats.lastSeen > now - stalest->stats.lastSeen) stalest = &peers[i];
+    }
+    esp_now_del_peer(stalest->mac);
+    stalest->used = false;
+    return stalest;
+}
+
+bool omegaNowPeers::registerPeer(const uint8_t* mac) {
+    if (esp_now_is_peer_exist(mac)) return true;
+
+    esp_now_peer_info_t peerInfo = {};
+    memcpy(peerInfo.peer_addr, mac, 6);
+    peerInfo.channel = 0; // Current channel
+    peerInfo.encrypt = false;
+    return esp_now_add_peer(&peerInfo) == ESP_OK;
+}
+
+bool omegaNowPeers::add(const uint8_t* mac, uint16_t id) {
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return false;
+
+    nowPeer* peer = findLocked(mac);
+    bool changed = false;
+    if (!peer) {
+        peer = freeLocked();
+        if (registerPeer(mac)) {
+            memcpy(peer->mac, mac, 6);
+            peer->stats = nowPeerStats();
+            peer->stats.lastSeen = millis();
+            peer->used = true;
+        } else {
+            peer = nullptr;
+        }
+        changed = true; // An evicted peer is gone from NVS too
+    }
+    if (peer && peer->id != id) {
+        peer->id = id;
+        changed = true;
+    }
+    bool paired = peer != nullptr;
+    xSemaphoreGive(mutex);
+
+    if (changed) save();
+    return paired;
+}
+
+bool omegaNowPeers::remove(const uint8_t* mac) {
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return false;
+    nowPeer* peer = findLocked(mac);
+    if (peer) {
+        peer->used = false;
+        esp_now_del_peer(mac);
+    }
+    xSemaphoreGive(mutex);
+
+    if (peer) save();
+    return peer != nullptr;
+}
+
+void omegaNowPeers::clear() {
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return;
+    for (uint8_t i = 0; i < NOW_MAX_PEERS; i++) {
+        if (peers[i].used) esp_now_del_peer(peers[i].mac);
+        peers[i].used = false;
+    }
+    xSemaphoreGive(mutex);
+    save();
+}
+
+bool omegaNowPeers::isPaired(const uint8_t* mac) {
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return false;
+    bool paired = findLocked(mac) != nullptr;
+    xSemaphoreGive(mutex);
+    return paired;
+}
+
+uint8_t omegaNowPeers::count() {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < NOW_MAX_PEERS; i++) {
+        if (peers[i].used) n++;
+    }
+    return n;
+}
+
+bool omegaNowPeers::get(uint8_t index, nowPeer& peer) {
+    if (index >= NOW_MAX_PEERS) return false;
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return false;
+    peer = peers[index];
+    xSemaphoreGive(mutex);
+    return peer.used;
+}
+
+void omegaNowPeers::heard(const uint8_t* mac, uint16_t id, uint8_t type) {
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return;
+    nowPeer* peer = findLocked(mac);
+    if (peer) {
+        peer->stats.received++;
+        peer->stats.lastSeen = millis();
+    }
+    xSemaphoreGive(mutex);
+
+    if (!peer && type < 16 && (autoPairTypes & (1 << type))) add(mac, id);
+}
+
+void omegaNowPeers::sendResult(const uint8_t* mac, bool delivered) {
+    // WiFi task, must not wait for a task holding the mutex
+    for (uint8_t i = 0; i < NOW_MAX_PEERS; i++) {
+        if (peers[i].used && memcmp(peers[i].mac, mac, 6) == 0) {
+            __atomic_fetch_add(&peers[i].stats.sent, 1, __ATOMIC_RELAXED);
+            if (!delivered) __atomic_fetch_add(&peers[i].stats.failed, 1, __ATOMIC_RELAXED);
+            return;
+        }
+    }
+}
+
+void omegaNowPeers::ackLatency(const uint8_t* mac, uint32_t ms) {
+    if (ms > 0xFFFF) ms = 0xFFFF;
+    if (xSemaphoreTake(mutex, portMAX_DELAY) != pdTRUE) return;
+    nowPeer* peer = findLocked(mac);
+    if (peer) {
+        // Moving average over roughly 8 acks
+        uint16_t& avg = peer->stats.latency;
+        avg = avg ? (uint16_t)((avg * 7 + ms) / 8) : (uint16_t)ms;
+    }
+    xSemaphoreGive(mutex);
+}
+
+void omegaNowPeers::rssi(const uint8_t* mac, int8_t dbm) {
+    for (uint8_t i = 0; i < NOW_MAX_PEERS; i++) {
+        if (peers[i].used && memcmp(peers[i].mac, mac, 6) == 0) {
+            peers[i].stats.rssi = dbm;
+            return;
+        }
+    }
+}
+
+bool omegaNowPeers::save() {
+    // Snapshots are written in the order they were taken, the newest table wins
+    if (xSemaphoreTake(saveMutex, portMAX_DELAY) != pdTRUE) return false;
+
+    record records[NOW_MAX_PEERS];
+    uint8_t n = 0;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    for (uint8_t i = 0; i < NOW_MAX_PEERS; i++) {
+        if (!peers[i].used) continue;
+        memcpy(records[n].mac, peers[i].mac, 6);
+        records[n].id = peers[i].id;
+        n++;
+    }
+    xSemaphoreGive(mutex);
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NOW_PEERS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    if (err != ESP_OK) {
+        xSemaphoreGive(saveMutex);
+        return false;
+    }
+
+    if (n) err = nvs_set_blob(nvs_handle, "peers", records, n * sizeof(record));
+    else err = nvs_erase_key(nvs_handle, "peers");
+    if (err == ESP_ERR_NVS_NOT_FOUND) err = ESP_OK; // Nothing stored yet
+    if (err == ESP_OK) err = nvs_commit(nvs_handle);
+    nvs_close(nvs_handle);
+    xSemaphoreGive(saveMutex);
+    return err == ESP_OK;
+}
+
+bool omegaNowPeers::load() {
+    record records[NOW_MAX_PEERS];
+    size_t size = sizeof(records);
+
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(NOW_PEERS_NAMESPACE, NVS_READONLY, &nvs_handle);
+    if (err != ESP_OK) return false;
+    err = nvs_get_blob(nvs_handle, "peers", records, &size);
+    nvs_close(nvs_handle);
+    if (err != ESP_OK) return false;
+
+    uint8_t n = size / sizeof(record);
+    for (uint8_t i = 0; i < n && i < NOW_MAX_PEERS; i++) {
+        memcpy(peers[i].mac, records[i].mac, 6);
+        peers[i].id = records[i].id;
+        peers[i].stats = nowPeerStats();
+        peers[i].used = true;
+    }
+    return true;
+}
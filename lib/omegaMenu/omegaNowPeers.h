@@ -0,0 +1,132 @@
+/**
+ * @file omegaNowPeers.h
+ * @brief Persistent ESP-NOW peer table with per-peer link statistics
+ *
+ * Paired devices are stored in NVS and registered with the ESP-NOW driver
+ * once at startup, so frames can be sent unicast with hardware acks instead
+ * of adding a peer before every send. For every peer the table tracks signal
+ * strength, the share of frames the radio could not deliver and the time
+ * until the receiver acknowledged a frame.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGANOWPEERS_H
+#define OMEGANOWPEERS_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <nvs.h>
+#include <esp_now.h>
+
+/** Settings */
+#define NOW_MAX_PEERS 10           // Paired devices, ESP-NOW allows 20 unencrypted
+#define NOW_PEERS_NAMESPACE "nowpeers"
+#define NOW_TRACK_RSSI 1           // Sniff the RSSI of ESP-NOW frames in promiscuous mode
+/** End Settings */
+
+/**
+ * @struct nowPeerStats
+ * @brief Link quality of one peer, reset on every boot
+ */
+struct nowPeerStats {
+    int8_t rssi = 0;       // dBm of the last frame heard, 0 if unknown
+    uint32_t sent = 0;     // Unicast frames handed to the radio
+    uint32_t failed = 0;   // Frames without hardware ack
+    uint32_t received = 0; // Frames heard from the peer
+    uint16_t latency = 0;  // Smoothed milliseconds until the link-level ack
+    uint32_t lastSeen = 0; // millis() of the last frame heard
+
+    /** @brief Frames without hardware ack in percent */
+    uint8_t lossPercent() const { return sent ? (uint8_t)(failed * 100 / sent) : 0; }
+};
+
+/**
+ * @struct nowPeer
+ * @brief A paired device, mac and id are persisted
+ */
+struct nowPeer {
+    uint8_t mac[6];
+    uint16_t id;
+    bool used;
+    nowPeerStats stats;
+};
+
+/**
+ * @class omegaNowPeers
+ * @brief Pairs devices, registers them with ESP-NOW and keeps their stats
+ */
+class omegaNowPeers {
+private:
+    struct record {
+        uint8_t mac[6];
+        uint16_t id;
+    };
+
+    nowPeer peers[NOW_MAX_PEERS];
+    SemaphoreHandle_t mutex = nullptr;
+    SemaphoreHandle_t saveMutex = nullptr; // Orders NVS writes, taken before mutex
+    uint16_t autoPairTypes = 0;
+
+    nowPeer* findLocked(const uint8_t* mac);
+    nowPeer* freeLocked();
+    bool registerPeer(const uint8_t* mac);
+    bool save(); // Takes the mutex itself, never call while holding it
+    bool load();
+
+public:
+    omegaNowPeers();
+
+    /**
+     * @brief Load the paired peers from NVS and register them with ESP-NOW
+     * Call after esp_now_init().
+     */
+    bool begin();
+
+    /**
+     * @brief Pair frames of these types automatically
+     * @param typeMask Bit n set pairs the sender of any frame with type n
+     */
+    void autoPair(uint16_t typeMask) { autoPairTypes = typeMask; }
+
+    /**
+     * @brief Pair a device, stored in NVS if it is new
+     * A full table unpairs the peer heard from longest ago to make room.
+     * @return False if the driver refused the peer
+     */
+    bool add(const uint8_t* mac, uint16_t id);
+
+    /** @brief Unpair a device */
+    bool remove(const uint8_t* mac);
+
+    /** @brief Unpair all devices */
+    void clear();
+
+    bool isPaired(const uint8_t* mac);
+    uint8_t count();
+
+    /**
+     * @brief Copy of a peer by table index
+     * @return False if the slot is free
+     */
+    bool get(uint8_t index, nowPeer& peer);
+
+    /** @brief A frame of type arrived from mac, pairs the sender if enabled */
+    void heard(const uint8_t* mac, uint16_t id, uint8_t type);
+
+    /** @brief Result of the hardware ack of a unicast frame, called from the WiFi task without locking */
+    void sendResult(const uint8_t* mac, bool delivered);
+
+    /** @brief Time from first transmission to the link-level ack */
+    void ackLatency(const uint8_t* mac, uint32_t ms);
+
+    /** @brief Signal strength of a frame, called from the sniffer without locking */
+    void rssi(const uint8_t* mac, int8_t dbm);
+};
+
+#endif // OMEGANOWPEERS_H
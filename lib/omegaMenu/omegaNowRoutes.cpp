@@ -0,0 +1,89 @@
+#include "omegaNowRoutes.h"
+
+static int8_t strength(int8_t rssi) {
+    return rssi ? rssi : NOW_RSSI_UNKNOWN;
+}
+
+omegaNowRoutes::omegaNowRoutes() {
+    memset(routes, 0, sizeof(routes));
+}
+
+nowRoute* omegaNowRoutes::find(uint16_t id) {
+    for (uint8_t i = 0; i < NOW_MAX_ROUTES; i++) {
+        if (routes[i].used && routes[i].id == id) return &routes[i];
+    }
+    return nullptr;
+}
+
+bool omegaNowRoutes::better(const nowRoute& current, const uint8_t* mac, int8_t rssi, uint8_t hops, uint32_t now) {
+    // The same neighbour always refreshes its own route
+    if (memcmp(current.mac, mac, 6) == 0) return true;
+    if (now - current.lastSeen >= NOW_ROUTE_TIMEOUT) return true;
+    if (hops != current.hops) return hops < current.hops;
+
+    return strength(rssi) >= strength(current.rssi) + NOW_ROUTE_HYSTERESIS;
+}
+
+void omegaNowRoutes::learn(uint16_t id, const uint8_t* mac, int8_t rssi, uint8_t hops, bool sink) {
+    uint32_t now = millis();
+    nowRoute* route = find(id);
+
+    if (!route) {
+        // Free slot or the least recently refreshed route
+        route = &routes[0];
+        for (uint8_t i = 0; i < NOW_MAX_ROUTES; i++) {
+            if (!routes[i].used) { route = &routes[i]; break; }
+            if (now - routes[i].lastSeen > now - route->lastSeen) route = &routes[i];
+        }
+        route->used = false;
+    }
+
+    if (route->used && !better(*route, mac, rssi, hops, now)) return;
+
+    route->id = id;
+    memcpy(route->mac, mac, 6);
+    if (rssi) route->rssi = rssi; // Keep the last known value while the sniffer misses frames
+    route->hops = hops;
+    route->sink = sink;
+    route->lastSeen = now;
+    route->used = true;
+}
+
+bool omegaNowRoutes::lookup(uint16_t id, uint8_t* mac) {
+    nowRoute* route = find(id);
+    if (!route) return false;
+    memcpy(mac, route->mac, 6);
+    return true;
+}
+
+bool omegaNowRoutes::nearestSink(uint8_t* mac) {
+    const nowRoute* best = nullptr;
+    for (uint8_t i = 0; i < NOW_MAX_ROUTES; i++) {
+        const nowRoute& r = routes[i];
+        if (!r.used || !r.sink) continue;
+        if (!best || r.hops < best->hops || (r.hops == best->hops && strength(r.rssi) > strength(best->rssi))) best = &r;
+    }
+    if (!best) return false;
+    memcpy(mac, best->mac, 6);
+    return true;
+}
+
+void omegaNowRoutes::drop(const uint8_t* mac) {
+    for (uint8_t i = 0; i < NOW_MAX_ROUTES; i++) {
+        if (routes[i].used && memcmp(routes[i].mac, mac, 6) == 0) routes[i].used = false;
+    }
+}
+
+uint8_t omegaNowRoutes::count() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < NOW_MAX_ROUTES; i++) {
+        if (routes[i].used) n++;
+    }
+    return n;
+}
+
+bool omegaNowRoutes::get(uint8_t index, nowRoute& route) const {
+    if (index >= NOW_MAX_ROUTES) return false;
+    route = routes[index];
+    return route.used;
+}
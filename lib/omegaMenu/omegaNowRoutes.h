@@ -0,0 +1,91 @@
+/**
+ * @file omegaNowRoutes.h
+ * @brief Next-hop table for relaying ESP-NOW frames
+ *
+ * Every frame a node hears tells it which neighbour the sender is reachable
+ * through, how many hops away it is and how strong that neighbour's signal
+ * was. The table keeps the best neighbour per device: fewer hops first, then
+ * the stronger signal. Entries that were not refreshed for NOW_ROUTE_TIMEOUT
+ * are replaced by any other route.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGANOWROUTES_H
+#define OMEGANOWROUTES_H
+
+#include <Arduino.h>
+
+/** Settings */
+#define NOW_MAX_ROUTES 16         // Devices a node keeps a next hop for
+#define NOW_ROUTE_TIMEOUT 60000   // Milliseconds until an unrefreshed route may be replaced
+#define NOW_ROUTE_HYSTERESIS 6    // dB a route must be stronger to replace one with equal hops
+/** End Settings */
+
+#define NOW_RSSI_UNKNOWN -100
+
+/**
+ * @struct nowRoute
+ * @brief Next hop towards one device
+ */
+struct nowRoute {
+    uint16_t id;       // Device the route leads to
+    uint8_t mac[6];    // Neighbour to send to
+    int8_t rssi;       // dBm of the neighbour when the route was learned
+    uint8_t hops;      // Relays between the neighbour and the device
+    bool sink;         // Device consumes sensor data
+    uint32_t lastSeen; // millis() of the last refresh
+    bool used;
+};
+
+/**
+ * @class omegaNowRoutes
+ * @brief Fixed size route table, not thread safe, the link locks around it
+ */
+class omegaNowRoutes {
+private:
+    nowRoute routes[NOW_MAX_ROUTES];
+
+    nowRoute* find(uint16_t id);
+    static bool better(const nowRoute& current, const uint8_t* mac, int8_t rssi, uint8_t hops, uint32_t now);
+
+public:
+    omegaNowRoutes();
+
+    /**
+     * @brief A frame from device id arrived through mac
+     * @param rssi dBm of mac, 0 if unknown
+     * @param hops Relays the frame passed
+     * @param sink Device consumes sensor data
+     */
+    void learn(uint16_t id, const uint8_t* mac, int8_t rssi, uint8_t hops, bool sink);
+
+    /**
+     * @brief Next hop towards device id
+     * @return False if no route is known
+     */
+    bool lookup(uint16_t id, uint8_t* mac);
+
+    /**
+     * @brief Next hop towards the closest sink
+     * @return False if no sink is known
+     */
+    bool nearestSink(uint8_t* mac);
+
+    /** @brief Forget a neighbour, e.g. after it stopped acking */
+    void drop(const uint8_t* mac);
+
+    uint8_t count() const;
+
+    /**
+     * @brief Copy of a route by table index
+     * @return False if the slot is free
+     */
+    bool get(uint8_t index, nowRoute& route) const;
+};
+
+#endif // OMEGANOWROUTES_H
@@ -0,0 +1,1233 @@
+// Generated by tools/omegaPackIcons.py from assets/omegaIcons.h, do not edit
+
+#ifndef OMEGAPACKEDICONS_H
+#define OMEGAPACKEDICONS_H
+
+#include <omegaImage.h>
+
+#define OMEGA_PACKED_ICONS(X) \
+    X(icon_bluetooth) \
+    X(icon_chart) \
+    X(icon_check) \
+    X(icon_compass) \
+    X(icon_cross) \
+    X(icon_eye) \
+    X(icon_function) \
+    X(icon_gear) \
+    X(icon_graduation_cap_1f393) \
+    X(icon_info) \
+    X(icon_light) \
+    X(icon_numeric) \
+    X(icon_question) \
+    X(icon_satellite_antenna) \
+    X(icon_thermometer) \
+    X(icon_wifi) \
+    X(icon_sunglasses) \
+    X(icon_potted_plant) \
+    X(icon_vase_plant) \
+    X(icon_Plant1) \
+    X(icon_cactus1) \
+
+#ifndef OMEGA_ASSET_PACK
+
+// 'bluetooth', 40x40px, 33 colours, 3200 -> 634 bytes
+const uint16_t icon_bluetooth_palette[] PROGMEM = {
+	0x0000, 0x391c, 0xffff, 0xb71b, 0x191c, 0x331b, 0x4200, 0xbfef, 0xf81b, 0xdfff, 0xbff7, 0x172c,
+	0xf95c, 0xdb8d, 0x9fe7, 0x9dae, 0x7b6d, 0xdc7d, 0xda44, 0xd71b, 0x1b55, 0x5a24, 0xb954, 0xd723,
+	0x9a7d, 0x7844, 0x7cae, 0x3a6d, 0x7ee7, 0x9fef, 0x1c96, 0x3b5d, 0x7a34
+};
+const uint8_t icon_bluetooth_data[] PROGMEM = {
+	0x8f, 0x00, 0x00, 0x05, 0x85, 0x01, 0x00, 0x05, 0x8f, 0x00, 0x8d, 0x00, 0x8b, 0x01, 0x8d, 0x00,
+	0x8b, 0x00, 0x8f, 0x01, 0x8b, 0x00, 0x8a, 0x00, 0x91, 0x01, 0x8a, 0x00, 0x89, 0x00, 0x93, 0x01,
+	0x89, 0x00, 0x88, 0x00, 0x95, 0x01, 0x88, 0x00, 0x87, 0x00, 0x00, 0x06, 0x89, 0x01, 0x01, 0x02,
+	0x02, 0x89, 0x01, 0x00, 0x06, 0x87, 0x00, 0x87, 0x00, 0x8a, 0x01, 0x82, 0x02, 0x89, 0x01, 0x87,
+	0x00, 0x87, 0x00, 0x8a, 0x01, 0x83, 0x02, 0x88, 0x01, 0x87, 0x00, 0x86, 0x00, 0x8b, 0x01, 0x84,
+	0x02, 0x88, 0x01, 0x86, 0x00, 0x86, 0x00, 0x8b, 0x01, 0x02, 0x02, 0x02, 0x0b, 0x82, 0x02, 0x87,
+	0x01, 0x86, 0x00, 0x86, 0x00, 0x8b, 0x01, 0x03, 0x02, 0x02, 0x03, 0x0c, 0x82, 0x02, 0x86, 0x01,
+	0x86, 0x00, 0x86, 0x00, 0x85, 0x01, 0x01, 0x02, 0x07, 0x83, 0x01, 0x04, 0x02, 0x02, 0x01, 0x03,
+	0x0d, 0x82, 0x02, 0x85, 0x01, 0x86, 0x00, 0x86, 0x00, 0x84, 0x01, 0x03, 0x07, 0x02, 0x02, 0x0e,
+	0x82, 0x01, 0x08, 0x02, 0x02, 0x01, 0x01, 0x03, 0x09, 0x02, 0x02, 0x0a, 0x84, 0x01, 0x86, 0x00,
+	0x86, 0x00, 0x84, 0x01, 0x00, 0x08, 0x82, 0x02, 0x07, 0x0f, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01,
+	0x10, 0x82, 0x02, 0x00, 0x08, 0x84, 0x01, 0x86, 0x00, 0x86, 0x00, 0x84, 0x01, 0x01, 0x04, 0x03,
+	0x82, 0x02, 0x05, 0x11, 0x01, 0x02, 0x02, 0x01, 0x12, 0x82, 0x02, 0x01, 0x03, 0x04, 0x84, 0x01,
+	0x86, 0x00, 0x86, 0x00, 0x85, 0x01, 0x01, 0x13, 0x03, 0x82, 0x02, 0x03, 0x14, 0x02, 0x02, 0x15,
+	0x82, 0x02, 0x01, 0x03, 0x03, 0x85, 0x01, 0x86, 0x00, 0x86, 0x00, 0x86, 0x01, 0x01, 0x03, 0x03,
+	0x87, 0x02, 0x01, 0x03, 0x03, 0x86, 0x01, 0x86, 0x00, 0x86, 0x00, 0x87, 0x01, 0x01, 0x03, 0x03,
+	0x85, 0x02, 0x01, 0x03, 0x03, 0x87, 0x01, 0x86, 0x00, 0x86, 0x00, 0x88, 0x01, 0x01, 0x03, 0x03,
+	0x83, 0x02, 0x01, 0x03, 0x03, 0x88, 0x01, 0x86, 0x00, 0x86, 0x00, 0x89, 0x01, 0x00, 0x03, 0x83,
+	0x02, 0x00, 0x03, 0x89, 0x01, 0x86, 0x00, 0x86, 0x00, 0x89, 0x01, 0x85, 0x02, 0x89, 0x01, 0x86,
+	0x00, 0x86, 0x00, 0x88, 0x01, 0x87, 0x02, 0x88, 0x01, 0x86, 0x00, 0x86, 0x00, 0x87, 0x01, 0x82,
+	0x02, 0x03, 0x16, 0x02, 0x02, 0x17, 0x82, 0x02, 0x87, 0x01, 0x86, 0x00, 0x86, 0x00, 0x86, 0x01,
+	0x82, 0x02, 0x05, 0x18, 0x03, 0x02, 0x02, 0x03, 0x19, 0x82, 0x02, 0x86, 0x01, 0x86, 0x00, 0x86,
+	0x00, 0x85, 0x01, 0x82, 0x02, 0x07, 0x1a, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x1b, 0x82, 0x02,
+	0x85, 0x01, 0x86, 0x00, 0x86, 0x00, 0x84, 0x01, 0x0f, 0x07, 0x02, 0x02, 0x1c, 0x03, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x03, 0x09, 0x02, 0x02, 0x0a, 0x84, 0x01, 0x86, 0x00, 0x86, 0x00, 0x84,
+	0x01, 0x03, 0x04, 0x02, 0x1d, 0x03, 0x82, 0x01, 0x04, 0x02, 0x02, 0x01, 0x01, 0x1e, 0x82, 0x02,
+	0x00, 0x08, 0x84, 0x01, 0x86, 0x00, 0x86, 0x00, 0x84, 0x01, 0x02, 0x04, 0x03, 0x03, 0x83, 0x01,
+	0x03, 0x02, 0x02, 0x01, 0x1f, 0x82, 0x02, 0x01, 0x03, 0x04, 0x84, 0x01, 0x86, 0x00, 0x86, 0x00,
+	0x8b, 0x01, 0x02, 0x02, 0x02, 0x20, 0x82, 0x02, 0x01, 0x03, 0x03, 0x85, 0x01, 0x86, 0x00, 0x86,
+	0x00, 0x8b, 0x01, 0x84, 0x02, 0x01, 0x03, 0x03, 0x86, 0x01, 0x86, 0x00, 0x87, 0x00, 0x8a, 0x01,
+	0x83, 0x02, 0x01, 0x03, 0x03, 0x86, 0x01, 0x87, 0x00, 0x87, 0x00, 0x8a, 0x01, 0x82, 0x02, 0x01,
+	0x03, 0x03, 0x87, 0x01, 0x87, 0x00, 0x87, 0x00, 0x00, 0x06, 0x89, 0x01, 0x03, 0x02, 0x02, 0x03,
+	0x03, 0x87, 0x01, 0x00, 0x06, 0x87, 0x00, 0x88, 0x00, 0x89, 0x01, 0x82, 0x03, 0x88, 0x01, 0x88,
+	0x00, 0x89, 0x00, 0x88, 0x01, 0x01, 0x03, 0x03, 0x88, 0x01, 0x89, 0x00, 0x8a, 0x00, 0x91, 0x01,
+	0x8a, 0x00, 0x8b, 0x00, 0x8f, 0x01, 0x8b, 0x00, 0x8d, 0x00, 0x8b, 0x01, 0x8d, 0x00, 0x8f, 0x00,
+	0x00, 0x05, 0x85, 0x01, 0x00, 0x05, 0x8f, 0x00
+};
+const omegaPackedImage icon_bluetooth = {40, 40, 33, 8, 0x00, icon_bluetooth_palette, icon_bluetooth_data, 0x01};
+
+// 'chart', 40x40px, 6 colours, 3200 -> 692 bytes
+const uint16_t icon_chart_palette[] PROGMEM = {
+	0xbbce, 0x5de7, 0x0000, 0xbb3c, 0x875c, 0x68d9
+};
+const uint8_t icon_chart_data[] PROGMEM = {
+	0xa7, 0x02, 0x83, 0x02, 0x9f, 0x01, 0x83, 0x02, 0x01, 0x22, 0xa3, 0x01, 0x01, 0x22, 0x01, 0x22,
+	0x82, 0x01, 0x84, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01, 0x11, 0x84, 0x00,
+	0x82, 0x01, 0x01, 0x22, 0x00, 0x20, 0x82, 0x01, 0x85, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01, 0x11,
+	0x86, 0x00, 0x01, 0x11, 0x85, 0x00, 0x82, 0x01, 0x00, 0x20, 0x02, 0x21, 0x10, 0x86, 0x00, 0x01,
+	0x11, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21,
+	0x10, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x02,
+	0x11, 0x20, 0x02, 0x21, 0x10, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01,
+	0x11, 0x86, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21, 0x10, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01,
+	0x11, 0x84, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21, 0x10, 0x86, 0x00, 0x01,
+	0x11, 0x86, 0x00, 0x01, 0x11, 0x84, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x00, 0x20,
+	0x98, 0x01, 0x85, 0x03, 0x86, 0x01, 0x00, 0x20, 0x00, 0x20, 0x98, 0x01, 0x85, 0x03, 0x86, 0x01,
+	0x00, 0x20, 0x02, 0x21, 0x10, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01, 0x11, 0x84, 0x00, 0x85,
+	0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21, 0x10, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01,
+	0x11, 0x84, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21, 0x10, 0x86, 0x00, 0x01,
+	0x11, 0x86, 0x00, 0x01, 0x11, 0x84, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21,
+	0x10, 0x86, 0x00, 0x01, 0x11, 0x86, 0x00, 0x01, 0x11, 0x84, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02,
+	0x11, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85, 0x04, 0x84, 0x00, 0x01, 0x11, 0x84, 0x00, 0x85,
+	0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85, 0x04, 0x84, 0x00, 0x01,
+	0x11, 0x84, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85,
+	0x04, 0x84, 0x00, 0x01, 0x11, 0x84, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x00, 0x20,
+	0x86, 0x01, 0x85, 0x04, 0x8b, 0x01, 0x85, 0x03, 0x86, 0x01, 0x00, 0x20, 0x00, 0x20, 0x86, 0x01,
+	0x85, 0x04, 0x8b, 0x01, 0x85, 0x03, 0x86, 0x01, 0x00, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85,
+	0x04, 0x84, 0x00, 0x01, 0x11, 0x84, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21,
+	0x10, 0x84, 0x00, 0x85, 0x04, 0x84, 0x00, 0x01, 0x11, 0x84, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02,
+	0x11, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85, 0x04, 0x83, 0x00, 0x83, 0x05, 0x83, 0x00, 0x85,
+	0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85, 0x04, 0x82, 0x00, 0x85,
+	0x05, 0x82, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85,
+	0x04, 0x82, 0x00, 0x85, 0x05, 0x82, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21,
+	0x10, 0x84, 0x00, 0x85, 0x04, 0x82, 0x00, 0x85, 0x05, 0x82, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02,
+	0x11, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85, 0x04, 0x82, 0x00, 0x85, 0x05, 0x82, 0x00, 0x85,
+	0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x00, 0x20, 0x86, 0x01, 0x85, 0x04, 0x82, 0x01, 0x85, 0x05,
+	0x82, 0x01, 0x85, 0x03, 0x86, 0x01, 0x00, 0x20, 0x00, 0x20, 0x86, 0x01, 0x85, 0x04, 0x82, 0x01,
+	0x85, 0x05, 0x82, 0x01, 0x85, 0x03, 0x86, 0x01, 0x00, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85,
+	0x04, 0x82, 0x00, 0x85, 0x05, 0x82, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21,
+	0x10, 0x84, 0x00, 0x85, 0x04, 0x82, 0x00, 0x85, 0x05, 0x82, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02,
+	0x11, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85, 0x04, 0x82, 0x00, 0x85, 0x05, 0x82, 0x00, 0x85,
+	0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85, 0x04, 0x82, 0x00, 0x85,
+	0x05, 0x82, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x02, 0x21, 0x10, 0x84, 0x00, 0x85,
+	0x04, 0x82, 0x00, 0x85, 0x05, 0x82, 0x00, 0x85, 0x03, 0x84, 0x00, 0x02, 0x11, 0x20, 0x00, 0x20,
+	0x82, 0x01, 0x83, 0x00, 0x85, 0x04, 0x82, 0x00, 0x85, 0x05, 0x82, 0x00, 0x85, 0x03, 0x83, 0x00,
+	0x82, 0x01, 0x00, 0x20, 0x01, 0x22, 0x82, 0x01, 0x82, 0x00, 0x85, 0x04, 0x82, 0x00, 0x85, 0x05,
+	0x82, 0x00, 0x85, 0x03, 0x82, 0x00, 0x82, 0x01, 0x01, 0x22, 0x01, 0x22, 0xa3, 0x01, 0x01, 0x22,
+	0x83, 0x02, 0x9f, 0x01, 0x83, 0x02, 0xa7, 0x02
+};
+const omegaPackedImage icon_chart = {40, 40, 6, 4, 0x02, icon_chart_palette, icon_chart_data, 0x01};
+
+// 'check', 40x40px, 8 colours, 3200 -> 243 bytes
+const uint16_t icon_check_palette[] PROGMEM = {
+	0x0000, 0x2116, 0xa115, 0x410c, 0x010c, 0x200b, 0xe00a, 0x0116
+};
+const uint8_t icon_check_data[] PROGMEM = {
+	0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa1, 0x00, 0x82, 0x01,
+	0x02, 0x30, 0x00, 0xa0, 0x00, 0x84, 0x01, 0x01, 0x40, 0x9f, 0x00, 0x86, 0x01, 0x00, 0x00, 0x9e,
+	0x00, 0x87, 0x01, 0x00, 0x00, 0x9d, 0x00, 0x88, 0x01, 0x00, 0x00, 0x9c, 0x00, 0x88, 0x01, 0x01,
+	0x00, 0x9b, 0x00, 0x88, 0x01, 0x82, 0x00, 0x9a, 0x00, 0x88, 0x01, 0x83, 0x00, 0x99, 0x00, 0x88,
+	0x01, 0x84, 0x00, 0x98, 0x00, 0x88, 0x01, 0x85, 0x00, 0x97, 0x00, 0x88, 0x01, 0x86, 0x00, 0x96,
+	0x00, 0x88, 0x01, 0x87, 0x00, 0x02, 0x00, 0x50, 0x82, 0x01, 0x8f, 0x00, 0x88, 0x01, 0x88, 0x00,
+	0x01, 0x06, 0x84, 0x01, 0x8d, 0x00, 0x88, 0x01, 0x89, 0x00, 0x00, 0x00, 0x86, 0x01, 0x8b, 0x00,
+	0x88, 0x01, 0x8a, 0x00, 0x00, 0x00, 0x87, 0x01, 0x89, 0x00, 0x88, 0x01, 0x8b, 0x00, 0x01, 0x07,
+	0x87, 0x01, 0x87, 0x00, 0x88, 0x01, 0x8c, 0x00, 0x01, 0x00, 0x88, 0x01, 0x85, 0x00, 0x88, 0x01,
+	0x8d, 0x00, 0x82, 0x00, 0x88, 0x01, 0x83, 0x00, 0x88, 0x01, 0x8e, 0x00, 0x83, 0x00, 0x88, 0x01,
+	0x01, 0x00, 0x88, 0x01, 0x8f, 0x00, 0x84, 0x00, 0x91, 0x01, 0x90, 0x00, 0x85, 0x00, 0x8f, 0x01,
+	0x91, 0x00, 0x86, 0x00, 0x8d, 0x01, 0x92, 0x00, 0x87, 0x00, 0x8b, 0x01, 0x93, 0x00, 0x88, 0x00,
+	0x89, 0x01, 0x94, 0x00, 0x89, 0x00, 0x87, 0x01, 0x95, 0x00, 0x8a, 0x00, 0x85, 0x01, 0x96, 0x00,
+	0x8b, 0x00, 0x03, 0x21, 0x12, 0x97, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7,
+	0x00, 0xa7, 0x00
+};
+const omegaPackedImage icon_check = {40, 40, 8, 4, 0x00, icon_check_palette, icon_check_data, 0x01};
+
+// 'compass', 40x40px, 18 colours, 3200 -> 780 bytes
+const uint16_t icon_compass_palette[] PROGMEM = {
+	0xdff7, 0x81f4, 0x0000, 0xd0fe, 0xbbce, 0x68d9, 0x6629, 0xd48c, 0xa1c3, 0x61f4, 0xc3f4, 0x006a,
+	0xbff7, 0xe069, 0xd8ed, 0x56ed, 0xd7b5, 0x35a5
+};
+const uint8_t icon_compass_data[] PROGMEM = {
+	0x8e, 0x02, 0x00, 0x0b, 0x87, 0x01, 0x00, 0x0b, 0x8e, 0x02, 0x8b, 0x02, 0x00, 0x08, 0x8d, 0x01,
+	0x00, 0x08, 0x8b, 0x02, 0x89, 0x02, 0x00, 0x09, 0x91, 0x01, 0x00, 0x09, 0x89, 0x02, 0x88, 0x02,
+	0x95, 0x01, 0x88, 0x02, 0x86, 0x02, 0x87, 0x01, 0x00, 0x0a, 0x87, 0x03, 0x00, 0x0a, 0x87, 0x01,
+	0x86, 0x02, 0x85, 0x02, 0x86, 0x01, 0x8d, 0x03, 0x86, 0x01, 0x85, 0x02, 0x84, 0x02, 0x85, 0x01,
+	0x83, 0x03, 0x89, 0x00, 0x83, 0x03, 0x85, 0x01, 0x84, 0x02, 0x83, 0x02, 0x85, 0x01, 0x82, 0x03,
+	0x8d, 0x00, 0x82, 0x03, 0x85, 0x01, 0x83, 0x02, 0x83, 0x02, 0x84, 0x01, 0x01, 0x03, 0x03, 0x91,
+	0x00, 0x01, 0x03, 0x03, 0x84, 0x01, 0x83, 0x02, 0x82, 0x02, 0x84, 0x01, 0x01, 0x03, 0x03, 0x93,
+	0x00, 0x01, 0x03, 0x03, 0x84, 0x01, 0x82, 0x02, 0x02, 0x02, 0x02, 0x09, 0x83, 0x01, 0x01, 0x03,
+	0x03, 0x95, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x02, 0x09, 0x02, 0x02, 0x01, 0x02, 0x02, 0x83,
+	0x01, 0x01, 0x03, 0x03, 0x82, 0x00, 0x00, 0x05, 0x86, 0x00, 0x01, 0x04, 0x04, 0x8a, 0x00, 0x01,
+	0x03, 0x03, 0x83, 0x01, 0x01, 0x02, 0x02, 0x01, 0x02, 0x08, 0x83, 0x01, 0x01, 0x03, 0x03, 0x83,
+	0x00, 0x01, 0x05, 0x0e, 0x84, 0x00, 0x01, 0x04, 0x04, 0x85, 0x00, 0x00, 0x04, 0x83, 0x00, 0x01,
+	0x03, 0x03, 0x83, 0x01, 0x01, 0x08, 0x02, 0x00, 0x02, 0x83, 0x01, 0x01, 0x03, 0x03, 0x84, 0x00,
+	0x02, 0x0f, 0x05, 0x05, 0x83, 0x00, 0x01, 0x04, 0x04, 0x83, 0x00, 0x01, 0x0c, 0x04, 0x85, 0x00,
+	0x01, 0x03, 0x03, 0x83, 0x01, 0x00, 0x02, 0x00, 0x02, 0x83, 0x01, 0x01, 0x03, 0x03, 0x85, 0x00,
+	0x83, 0x05, 0x03, 0x00, 0x00, 0x04, 0x04, 0x82, 0x00, 0x02, 0x04, 0x04, 0x0c, 0x85, 0x00, 0x01,
+	0x03, 0x03, 0x83, 0x01, 0x00, 0x02, 0x00, 0x0b, 0x82, 0x01, 0x01, 0x0a, 0x03, 0x87, 0x00, 0x83,
+	0x05, 0x87, 0x04, 0x87, 0x00, 0x01, 0x03, 0x0a, 0x82, 0x01, 0x00, 0x0d, 0x83, 0x01, 0x01, 0x03,
+	0x03, 0x87, 0x00, 0x85, 0x05, 0x84, 0x04, 0x88, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x83, 0x01,
+	0x01, 0x03, 0x03, 0x88, 0x00, 0x82, 0x05, 0x83, 0x07, 0x82, 0x04, 0x88, 0x00, 0x01, 0x03, 0x03,
+	0x83, 0x01, 0x83, 0x01, 0x01, 0x03, 0x03, 0x88, 0x00, 0x09, 0x04, 0x05, 0x07, 0x07, 0x00, 0x00,
+	0x07, 0x07, 0x04, 0x04, 0x88, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x83, 0x01, 0x01, 0x03, 0x03,
+	0x84, 0x00, 0x84, 0x04, 0x01, 0x05, 0x07, 0x83, 0x00, 0x00, 0x07, 0x85, 0x04, 0x84, 0x00, 0x01,
+	0x03, 0x03, 0x83, 0x01, 0x83, 0x01, 0x01, 0x03, 0x03, 0x84, 0x00, 0x85, 0x04, 0x00, 0x07, 0x83,
+	0x00, 0x01, 0x07, 0x06, 0x84, 0x04, 0x84, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x83, 0x01, 0x01,
+	0x03, 0x03, 0x88, 0x00, 0x09, 0x04, 0x04, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x06, 0x04, 0x88,
+	0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x83, 0x01, 0x01, 0x03, 0x03, 0x88, 0x00, 0x82, 0x04, 0x83,
+	0x07, 0x82, 0x06, 0x88, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x83, 0x01, 0x01, 0x03, 0x03, 0x88,
+	0x00, 0x84, 0x04, 0x85, 0x06, 0x87, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x00, 0x0b, 0x82, 0x01,
+	0x01, 0x0a, 0x03, 0x87, 0x00, 0x87, 0x04, 0x83, 0x06, 0x87, 0x00, 0x01, 0x03, 0x0a, 0x82, 0x01,
+	0x00, 0x0d, 0x00, 0x02, 0x83, 0x01, 0x01, 0x03, 0x03, 0x85, 0x00, 0x02, 0x0c, 0x04, 0x04, 0x82,
+	0x00, 0x03, 0x04, 0x04, 0x00, 0x00, 0x83, 0x06, 0x85, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x00,
+	0x02, 0x00, 0x02, 0x83, 0x01, 0x01, 0x03, 0x03, 0x85, 0x00, 0x01, 0x04, 0x0c, 0x83, 0x00, 0x01,
+	0x04, 0x04, 0x83, 0x00, 0x02, 0x06, 0x06, 0x10, 0x84, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x00,
+	0x02, 0x01, 0x02, 0x08, 0x83, 0x01, 0x01, 0x03, 0x03, 0x83, 0x00, 0x00, 0x04, 0x85, 0x00, 0x01,
+	0x04, 0x04, 0x84, 0x00, 0x01, 0x11, 0x06, 0x83, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x01, 0x08,
+	0x02, 0x01, 0x02, 0x02, 0x83, 0x01, 0x01, 0x03, 0x03, 0x8a, 0x00, 0x01, 0x04, 0x04, 0x86, 0x00,
+	0x00, 0x06, 0x82, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x09,
+	0x83, 0x01, 0x01, 0x03, 0x03, 0x95, 0x00, 0x01, 0x03, 0x03, 0x83, 0x01, 0x02, 0x09, 0x02, 0x02,
+	0x82, 0x02, 0x84, 0x01, 0x01, 0x03, 0x03, 0x93, 0x00, 0x01, 0x03, 0x03, 0x84, 0x01, 0x82, 0x02,
+	0x83, 0x02, 0x84, 0x01, 0x01, 0x03, 0x03, 0x91, 0x00, 0x01, 0x03, 0x03, 0x84, 0x01, 0x83, 0x02,
+	0x83, 0x02, 0x85, 0x01, 0x82, 0x03, 0x8d, 0x00, 0x82, 0x03, 0x85, 0x01, 0x83, 0x02, 0x84, 0x02,
+	0x85, 0x01, 0x83, 0x03, 0x89, 0x00, 0x83, 0x03, 0x85, 0x01, 0x84, 0x02, 0x85, 0x02, 0x86, 0x01,
+	0x8d, 0x03, 0x86, 0x01, 0x85, 0x02, 0x86, 0x02, 0x87, 0x01, 0x00, 0x0a, 0x87, 0x03, 0x00, 0x0a,
+	0x87, 0x01, 0x86, 0x02, 0x88, 0x02, 0x95, 0x01, 0x88, 0x02, 0x89, 0x02, 0x00, 0x09, 0x91, 0x01,
+	0x00, 0x09, 0x89, 0x02, 0x8b, 0x02, 0x00, 0x08, 0x8d, 0x01, 0x00, 0x08, 0x8b, 0x02, 0x8e, 0x02,
+	0x00, 0x0d, 0x87, 0x01, 0x00, 0x0d, 0x8e, 0x02
+};
+const omegaPackedImage icon_compass = {40, 40, 18, 8, 0x02, icon_compass_palette, icon_compass_data, 0x01};
+
+// 'cross', 40x40px, 27 colours, 3200 -> 750 bytes
+const uint16_t icon_cross_palette[] PROGMEM = {
+	0x0000, 0x06f2, 0x86c9, 0x4bf3, 0x4128, 0x2bf3, 0xc6d9, 0x88f2, 0x6128, 0x68f2, 0xe6e9, 0xeaf2,
+	0x0af3, 0xa6d1, 0xc360, 0x2018, 0x4018, 0x27f2, 0x47f2, 0xc6e1, 0xe6e1, 0x06ea, 0x0008, 0xa9f2,
+	0x8240, 0x8138, 0x2010
+};
+const uint8_t icon_cross_data[] PROGMEM = {
+	0xa7, 0x00, 0x82, 0x00, 0x03, 0x04, 0x02, 0x02, 0x04, 0x99, 0x00, 0x03, 0x0f, 0x02, 0x02, 0x04,
+	0x82, 0x00, 0x01, 0x00, 0x00, 0x83, 0x01, 0x01, 0x02, 0x02, 0x97, 0x00, 0x83, 0x01, 0x03, 0x02,
+	0x02, 0x00, 0x00, 0x01, 0x00, 0x08, 0x84, 0x01, 0x01, 0x02, 0x02, 0x95, 0x00, 0x85, 0x01, 0x02,
+	0x02, 0x04, 0x00, 0x00, 0x00, 0x86, 0x01, 0x01, 0x02, 0x02, 0x93, 0x00, 0x86, 0x01, 0x02, 0x02,
+	0x02, 0x00, 0x04, 0x00, 0x01, 0x01, 0x03, 0x03, 0x83, 0x01, 0x01, 0x02, 0x02, 0x91, 0x00, 0x87,
+	0x01, 0x02, 0x02, 0x02, 0x00, 0x04, 0x00, 0x10, 0x01, 0x03, 0x03, 0x84, 0x01, 0x01, 0x02, 0x02,
+	0x8f, 0x00, 0x88, 0x01, 0x02, 0x02, 0x04, 0x00, 0x01, 0x00, 0x00, 0x82, 0x01, 0x01, 0x03, 0x03,
+	0x83, 0x01, 0x01, 0x02, 0x02, 0x8d, 0x00, 0x88, 0x01, 0x03, 0x02, 0x02, 0x00, 0x00, 0x82, 0x00,
+	0x04, 0x01, 0x01, 0x05, 0x03, 0x03, 0x83, 0x01, 0x01, 0x02, 0x02, 0x8b, 0x00, 0x88, 0x01, 0x01,
+	0x02, 0x02, 0x82, 0x00, 0x83, 0x00, 0x01, 0x01, 0x01, 0x82, 0x03, 0x83, 0x01, 0x01, 0x02, 0x02,
+	0x89, 0x00, 0x88, 0x01, 0x01, 0x02, 0x02, 0x83, 0x00, 0x84, 0x00, 0x01, 0x01, 0x01, 0x82, 0x03,
+	0x83, 0x01, 0x01, 0x02, 0x02, 0x87, 0x00, 0x88, 0x01, 0x01, 0x02, 0x02, 0x84, 0x00, 0x85, 0x00,
+	0x01, 0x01, 0x01, 0x82, 0x03, 0x83, 0x01, 0x01, 0x02, 0x02, 0x85, 0x00, 0x88, 0x01, 0x01, 0x02,
+	0x02, 0x85, 0x00, 0x86, 0x00, 0x01, 0x01, 0x01, 0x82, 0x03, 0x83, 0x01, 0x01, 0x02, 0x02, 0x83,
+	0x00, 0x88, 0x01, 0x01, 0x02, 0x02, 0x86, 0x00, 0x87, 0x00, 0x01, 0x01, 0x01, 0x82, 0x03, 0x83,
+	0x01, 0x03, 0x02, 0x02, 0x00, 0x00, 0x88, 0x01, 0x01, 0x02, 0x02, 0x87, 0x00, 0x88, 0x00, 0x01,
+	0x01, 0x01, 0x82, 0x03, 0x83, 0x01, 0x01, 0x02, 0x02, 0x88, 0x01, 0x01, 0x02, 0x02, 0x88, 0x00,
+	0x89, 0x00, 0x01, 0x01, 0x01, 0x82, 0x03, 0x8c, 0x01, 0x01, 0x02, 0x02, 0x89, 0x00, 0x8a, 0x00,
+	0x01, 0x01, 0x01, 0x82, 0x03, 0x8a, 0x01, 0x01, 0x02, 0x02, 0x8a, 0x00, 0x8b, 0x00, 0x01, 0x01,
+	0x01, 0x82, 0x03, 0x88, 0x01, 0x01, 0x02, 0x02, 0x8b, 0x00, 0x8c, 0x00, 0x03, 0x01, 0x01, 0x03,
+	0x03, 0x87, 0x01, 0x01, 0x02, 0x02, 0x8c, 0x00, 0x8d, 0x00, 0x89, 0x01, 0x01, 0x02, 0x02, 0x8d,
+	0x00, 0x8d, 0x00, 0x89, 0x01, 0x01, 0x02, 0x02, 0x8d, 0x00, 0x8c, 0x00, 0x8b, 0x01, 0x01, 0x02,
+	0x02, 0x8c, 0x00, 0x8b, 0x00, 0x8d, 0x01, 0x01, 0x02, 0x02, 0x8b, 0x00, 0x8a, 0x00, 0x8f, 0x01,
+	0x01, 0x02, 0x02, 0x8a, 0x00, 0x89, 0x00, 0x87, 0x01, 0x00, 0x06, 0x83, 0x01, 0x00, 0x03, 0x83,
+	0x01, 0x01, 0x02, 0x02, 0x89, 0x00, 0x88, 0x00, 0x87, 0x01, 0x08, 0x06, 0x02, 0x02, 0x01, 0x01,
+	0x0b, 0x03, 0x03, 0x11, 0x82, 0x01, 0x01, 0x02, 0x02, 0x88, 0x00, 0x87, 0x00, 0x87, 0x01, 0x06,
+	0x06, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x82, 0x03, 0x00, 0x12, 0x82, 0x01, 0x01, 0x02, 0x02,
+	0x87, 0x00, 0x86, 0x00, 0x87, 0x01, 0x02, 0x13, 0x02, 0x02, 0x83, 0x00, 0x01, 0x01, 0x01, 0x82,
+	0x03, 0x00, 0x09, 0x82, 0x01, 0x01, 0x02, 0x02, 0x86, 0x00, 0x85, 0x00, 0x87, 0x01, 0x02, 0x14,
+	0x02, 0x02, 0x85, 0x00, 0x05, 0x01, 0x01, 0x05, 0x03, 0x03, 0x09, 0x82, 0x01, 0x01, 0x02, 0x02,
+	0x85, 0x00, 0x84, 0x00, 0x87, 0x01, 0x02, 0x0a, 0x02, 0x02, 0x87, 0x00, 0x05, 0x01, 0x01, 0x05,
+	0x03, 0x03, 0x09, 0x82, 0x01, 0x01, 0x02, 0x02, 0x84, 0x00, 0x83, 0x00, 0x87, 0x01, 0x02, 0x0a,
+	0x02, 0x02, 0x89, 0x00, 0x05, 0x01, 0x01, 0x05, 0x03, 0x03, 0x07, 0x82, 0x01, 0x01, 0x02, 0x02,
+	0x83, 0x00, 0x82, 0x00, 0x87, 0x01, 0x02, 0x15, 0x02, 0x02, 0x8b, 0x00, 0x05, 0x01, 0x01, 0x05,
+	0x03, 0x03, 0x07, 0x82, 0x01, 0x01, 0x02, 0x02, 0x82, 0x00, 0x01, 0x00, 0x00, 0x88, 0x01, 0x01,
+	0x02, 0x02, 0x8d, 0x00, 0x05, 0x01, 0x01, 0x0c, 0x03, 0x03, 0x07, 0x82, 0x01, 0x03, 0x02, 0x02,
+	0x00, 0x00, 0x01, 0x00, 0x08, 0x87, 0x01, 0x01, 0x02, 0x02, 0x8f, 0x00, 0x0b, 0x01, 0x01, 0x0c,
+	0x03, 0x03, 0x07, 0x01, 0x01, 0x0d, 0x02, 0x16, 0x00, 0x00, 0x00, 0x87, 0x01, 0x01, 0x02, 0x02,
+	0x91, 0x00, 0x04, 0x01, 0x01, 0x0b, 0x03, 0x03, 0x82, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
+	0x86, 0x01, 0x01, 0x02, 0x02, 0x93, 0x00, 0x09, 0x01, 0x01, 0x17, 0x03, 0x03, 0x01, 0x01, 0x02,
+	0x02, 0x00, 0x01, 0x00, 0x08, 0x84, 0x01, 0x01, 0x02, 0x02, 0x95, 0x00, 0x84, 0x01, 0x03, 0x06,
+	0x02, 0x18, 0x00, 0x01, 0x00, 0x00, 0x83, 0x01, 0x01, 0x02, 0x02, 0x97, 0x00, 0x07, 0x0a, 0x01,
+	0x01, 0x0d, 0x02, 0x02, 0x00, 0x00, 0x82, 0x00, 0x03, 0x19, 0x02, 0x02, 0x1a, 0x99, 0x00, 0x03,
+	0x0e, 0x02, 0x02, 0x0e, 0x82, 0x00, 0xa7, 0x00
+};
+const omegaPackedImage icon_cross = {40, 40, 27, 8, 0x00, icon_cross_palette, icon_cross_data, 0x01};
+
+// 'eye', 40x40px, 34 colours, 3200 -> 445 bytes
+const uint16_t icon_eye_palette[] PROGMEM = {
+	0x0000, 0xffff, 0x293a, 0xe420, 0xdff7, 0x0421, 0xdbde, 0x9ef7, 0x7def, 0x4529, 0xaa52, 0xc318,
+	0x8210, 0x79ce, 0x107c, 0x2000, 0x083a, 0x3ce7, 0x2d5b, 0xab4a, 0xd7bd, 0x9ace, 0x518c, 0x2429,
+	0x1cdf, 0x96ad, 0x3184, 0x4a42, 0x96b5, 0x35a5, 0x3084, 0x6108, 0x5def, 0x75ad
+};
+const uint8_t icon_eye_data[] PROGMEM = {
+	0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0x8f, 0x00,
+	0x00, 0x0a, 0x85, 0x01, 0x00, 0x06, 0x8f, 0x00, 0x8c, 0x00, 0x8d, 0x01, 0x00, 0x0b, 0x8b, 0x00,
+	0x8a, 0x00, 0x91, 0x01, 0x00, 0x0c, 0x89, 0x00, 0x88, 0x00, 0x00, 0x0d, 0x86, 0x01, 0x85, 0x02,
+	0x00, 0x06, 0x86, 0x01, 0x88, 0x00, 0x87, 0x00, 0x86, 0x01, 0x89, 0x02, 0x86, 0x01, 0x87, 0x00,
+	0x86, 0x00, 0x86, 0x01, 0x8b, 0x02, 0x00, 0x0e, 0x85, 0x01, 0x86, 0x00, 0x85, 0x00, 0x86, 0x01,
+	0x8d, 0x02, 0x00, 0x07, 0x85, 0x01, 0x85, 0x00, 0x84, 0x00, 0x86, 0x01, 0x85, 0x02, 0x83, 0x03,
+	0x00, 0x05, 0x84, 0x02, 0x86, 0x01, 0x84, 0x00, 0x83, 0x00, 0x00, 0x0f, 0x86, 0x01, 0x83, 0x02,
+	0x00, 0x10, 0x86, 0x03, 0x04, 0x02, 0x11, 0x02, 0x02, 0x12, 0x86, 0x01, 0x83, 0x00, 0x83, 0x00,
+	0x86, 0x01, 0x00, 0x08, 0x83, 0x02, 0x87, 0x03, 0x82, 0x04, 0x01, 0x13, 0x02, 0x86, 0x01, 0x00,
+	0x09, 0x82, 0x00, 0x82, 0x00, 0x87, 0x01, 0x83, 0x02, 0x00, 0x05, 0x86, 0x03, 0x00, 0x14, 0x83,
+	0x04, 0x00, 0x02, 0x87, 0x01, 0x82, 0x00, 0x82, 0x00, 0x87, 0x01, 0x83, 0x02, 0x88, 0x03, 0x82,
+	0x04, 0x01, 0x15, 0x02, 0x87, 0x01, 0x02, 0x16, 0x00, 0x00, 0x82, 0x00, 0x87, 0x01, 0x83, 0x02,
+	0x88, 0x03, 0x04, 0x17, 0x04, 0x18, 0x02, 0x02, 0x88, 0x01, 0x01, 0x00, 0x00, 0x82, 0x00, 0x87,
+	0x01, 0x83, 0x02, 0x00, 0x05, 0x88, 0x03, 0x83, 0x02, 0x87, 0x01, 0x82, 0x00, 0x83, 0x00, 0x87,
+	0x01, 0x83, 0x02, 0x87, 0x03, 0x00, 0x09, 0x83, 0x02, 0x87, 0x01, 0x82, 0x00, 0x83, 0x00, 0x87,
+	0x01, 0x84, 0x02, 0x86, 0x03, 0x83, 0x02, 0x00, 0x19, 0x86, 0x01, 0x83, 0x00, 0x84, 0x00, 0x86,
+	0x01, 0x00, 0x1a, 0x84, 0x02, 0x83, 0x03, 0x85, 0x02, 0x86, 0x01, 0x84, 0x00, 0x85, 0x00, 0x86,
+	0x01, 0x8d, 0x02, 0x86, 0x01, 0x00, 0x08, 0x84, 0x00, 0x86, 0x00, 0x86, 0x01, 0x8b, 0x02, 0x87,
+	0x01, 0x85, 0x00, 0x87, 0x00, 0x86, 0x01, 0x00, 0x1b, 0x88, 0x02, 0x86, 0x01, 0x00, 0x1c, 0x86,
+	0x00, 0x88, 0x00, 0x87, 0x01, 0x00, 0x1d, 0x84, 0x02, 0x88, 0x01, 0x87, 0x00, 0x8a, 0x00, 0x94,
+	0x01, 0x87, 0x00, 0x8c, 0x00, 0x92, 0x01, 0x87, 0x00, 0x90, 0x00, 0x00, 0x1e, 0x84, 0x01, 0x00,
+	0x1f, 0x83, 0x00, 0x83, 0x01, 0x00, 0x07, 0x86, 0x00, 0x9c, 0x00, 0x83, 0x01, 0x86, 0x00, 0x9e,
+	0x00, 0x02, 0x01, 0x01, 0x20, 0x85, 0x00, 0xa0, 0x00, 0x00, 0x21, 0x85, 0x00, 0xa7, 0x00, 0xa7,
+	0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00
+};
+const omegaPackedImage icon_eye = {40, 40, 34, 8, 0x00, icon_eye_palette, icon_eye_data, 0x01};
+
+// 'function', 40x40px, 144 colours, 3200 -> 1093 bytes
+const uint16_t icon_function_palette[] PROGMEM = {
+	0x0000, 0x01fe, 0xc0fd, 0xe1fd, 0x60fd, 0x80fd, 0xa0fd, 0x40fd, 0x00f4, 0xc0fc, 0x80fc, 0xe782,
+	0xffff, 0x00fd, 0xc1fd, 0xe0fc, 0xe0f3, 0x20fd, 0x60fc, 0xc0f3, 0x40f4, 0xabfe, 0xe191, 0xa0fc,
+	0x20f4, 0x20fc, 0xa0f3, 0x8afe, 0xdbde, 0x40fc, 0x219a, 0xbef7, 0xa0f4, 0x60f4, 0x40f5, 0x20e4,
+	0xe0fd, 0x00ed, 0x3cef, 0xe0f4, 0x5def, 0x1ce7, 0xa0e3, 0xc0ec, 0x1bef, 0x80dc, 0xa0ec, 0x20f5,
+	0xe0ec, 0x40ec, 0x7def, 0x22b3, 0x80f4, 0xc0e3, 0x80d3, 0x51c5, 0xe0eb, 0x20c3, 0x60e3, 0x856a,
+	0xa349, 0x2cd5, 0xcdfe, 0xeffe, 0x0683, 0x45fe, 0x86ed, 0x20ed, 0x9cff, 0x7bff, 0xc7f5, 0x01ed,
+	0xecf5, 0x70f6, 0xa1fd, 0x38ff, 0xf6f6, 0xe1ec, 0xdeff, 0x2ef6, 0x5bff, 0xa9f5, 0xd8ee, 0x02f5,
+	0xa8f5, 0xbeff, 0xb5f6, 0xc2bb, 0x47c4, 0x5bf7, 0x03ed, 0xa7ab, 0x97e6, 0x01f5, 0xc1e4, 0x19f7,
+	0x5cef, 0x81dc, 0x56e6, 0xa0e4, 0x31e6, 0x06ed, 0x60d4, 0x90d5, 0x21cc, 0xead4, 0x7cf7, 0x22cc,
+	0xa2b3, 0x40d4, 0x60ec, 0x30c5, 0x43ab, 0x9df7, 0xeded, 0x69bc, 0x7df7, 0x9ef7, 0xc0f4, 0x20d4,
+	0x0fee, 0x08b4, 0x81ec, 0xc0db, 0x98de, 0xfbde, 0x61ec, 0xa6ab, 0x49f5, 0xe0e3, 0x6cb4, 0x16d6,
+	0x80e3, 0x4cb4, 0x80db, 0x40e3, 0x60db, 0x008a, 0x2020, 0xc081, 0x0192, 0xc191, 0x4169, 0x0010
+};
+const uint8_t icon_function_data[] PROGMEM = {
+	0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0x85, 0x00, 0x00, 0x3b, 0x9a, 0x0b, 0x00, 0x3c,
+	0x84, 0x00, 0x84, 0x00, 0x01, 0x3d, 0x3e, 0x91, 0x15, 0x88, 0x1b, 0x01, 0x3f, 0x40, 0x83, 0x00,
+	0x84, 0x00, 0x00, 0x41, 0x91, 0x01, 0x86, 0x03, 0x83, 0x02, 0x00, 0x42, 0x83, 0x00, 0x84, 0x00,
+	0x91, 0x01, 0x85, 0x03, 0x00, 0x24, 0x84, 0x02, 0x00, 0x43, 0x83, 0x00, 0x84, 0x00, 0x8f, 0x01,
+	0x86, 0x03, 0x00, 0x24, 0x85, 0x02, 0x00, 0x25, 0x83, 0x00, 0x84, 0x00, 0x88, 0x01, 0x00, 0x03,
+	0x84, 0x01, 0x86, 0x03, 0x00, 0x24, 0x86, 0x02, 0x00, 0x25, 0x83, 0x00, 0x84, 0x00, 0x86, 0x01,
+	0x03, 0x03, 0x05, 0x05, 0x0e, 0x82, 0x01, 0x06, 0x03, 0x0e, 0x06, 0x0e, 0x02, 0x03, 0x03, 0x88,
+	0x02, 0x00, 0x25, 0x83, 0x00, 0x84, 0x00, 0x85, 0x01, 0x0c, 0x03, 0x05, 0x44, 0x0c, 0x22, 0x0e,
+	0x03, 0x03, 0x0e, 0x22, 0x45, 0x46, 0x0e, 0x8a, 0x02, 0x00, 0x47, 0x83, 0x00, 0x84, 0x00, 0x84,
+	0x01, 0x0d, 0x03, 0x06, 0x48, 0x0c, 0x0c, 0x49, 0x4a, 0x03, 0x0e, 0x04, 0x4b, 0x0c, 0x4c, 0x06,
+	0x89, 0x02, 0x01, 0x06, 0x4d, 0x83, 0x00, 0x84, 0x00, 0x85, 0x03, 0x00, 0x22, 0x82, 0x0c, 0x08,
+	0x4e, 0x04, 0x0e, 0x05, 0x4f, 0x0c, 0x0c, 0x50, 0x04, 0x86, 0x02, 0x82, 0x06, 0x01, 0x05, 0x2b,
+	0x83, 0x00, 0x84, 0x00, 0x84, 0x03, 0x0d, 0x0e, 0x51, 0x0c, 0x2c, 0x52, 0x0c, 0x53, 0x04, 0x54,
+	0x0c, 0x0c, 0x26, 0x55, 0x11, 0x85, 0x02, 0x00, 0x06, 0x83, 0x05, 0x00, 0x2b, 0x83, 0x00, 0x84,
+	0x00, 0x84, 0x03, 0x0e, 0x06, 0x56, 0x0c, 0x57, 0x58, 0x0c, 0x59, 0x5a, 0x0c, 0x0c, 0x5b, 0x5c,
+	0x1f, 0x5d, 0x06, 0x82, 0x02, 0x01, 0x06, 0x06, 0x82, 0x05, 0x02, 0x04, 0x04, 0x5e, 0x83, 0x00,
+	0x84, 0x00, 0x00, 0x03, 0x83, 0x0e, 0x04, 0x06, 0x5f, 0x60, 0x2d, 0x61, 0x83, 0x0c, 0x05, 0x62,
+	0x63, 0x64, 0x1f, 0x65, 0x05, 0x82, 0x06, 0x82, 0x05, 0x04, 0x04, 0x04, 0x07, 0x07, 0x2e, 0x83,
+	0x00, 0x84, 0x00, 0x85, 0x0e, 0x11, 0x2d, 0x66, 0x06, 0x04, 0x67, 0x0c, 0x0c, 0x2c, 0x68, 0x04,
+	0x69, 0x1f, 0x6a, 0x07, 0x06, 0x06, 0x05, 0x05, 0x82, 0x04, 0x82, 0x07, 0x00, 0x2e, 0x83, 0x00,
+	0x84, 0x00, 0x83, 0x0e, 0x84, 0x06, 0x0e, 0x05, 0x6b, 0x0c, 0x0c, 0x6c, 0x04, 0x05, 0x6d, 0x1f,
+	0x1f, 0x27, 0x04, 0x05, 0x04, 0x04, 0x83, 0x07, 0x02, 0x11, 0x11, 0x6e, 0x83, 0x00, 0x84, 0x00,
+	0x89, 0x06, 0x0b, 0x2f, 0x6f, 0x70, 0x22, 0x05, 0x05, 0x30, 0x71, 0x1f, 0x72, 0x11, 0x04, 0x82,
+	0x07, 0x82, 0x11, 0x02, 0x0d, 0x0d, 0x31, 0x83, 0x00, 0x84, 0x00, 0x87, 0x06, 0x04, 0x05, 0x05,
+	0x04, 0x30, 0x2f, 0x82, 0x05, 0x08, 0x07, 0x73, 0x74, 0x75, 0x76, 0x07, 0x07, 0x11, 0x11, 0x83,
+	0x0d, 0x01, 0x0f, 0x31, 0x83, 0x00, 0x84, 0x00, 0x00, 0x06, 0x8d, 0x05, 0x07, 0x04, 0x07, 0x77,
+	0x32, 0x28, 0x78, 0x27, 0x11, 0x83, 0x0d, 0x82, 0x0f, 0x00, 0x23, 0x83, 0x00, 0x84, 0x00, 0x82,
+	0x05, 0x02, 0x04, 0x04, 0x05, 0x88, 0x04, 0x0a, 0x07, 0x07, 0x27, 0x79, 0x28, 0x28, 0x7a, 0x09,
+	0x0d, 0x0f, 0x0f, 0x83, 0x09, 0x00, 0x23, 0x83, 0x00, 0x84, 0x00, 0x8a, 0x04, 0x82, 0x07, 0x00,
+	0x11, 0x82, 0x0d, 0x0c, 0x7b, 0x7c, 0x29, 0x26, 0x21, 0x17, 0x09, 0x09, 0x17, 0x17, 0x20, 0x20,
+	0x23, 0x83, 0x00, 0x84, 0x00, 0x85, 0x04, 0x01, 0x07, 0x04, 0x82, 0x07, 0x01, 0x11, 0x11, 0x83,
+	0x0d, 0x07, 0x0f, 0x09, 0x33, 0x29, 0x7d, 0x26, 0x7e, 0x21, 0x83, 0x20, 0x01, 0x34, 0x23, 0x83,
+	0x00, 0x84, 0x00, 0x86, 0x07, 0x82, 0x11, 0x00, 0x0d, 0x84, 0x0f, 0x82, 0x09, 0x0b, 0x21, 0x7f,
+	0x1c, 0x1c, 0x29, 0x80, 0x08, 0x14, 0x12, 0x34, 0x14, 0x35, 0x83, 0x00, 0x84, 0x00, 0x82, 0x07,
+	0x83, 0x11, 0x00, 0x0d, 0x82, 0x0f, 0x85, 0x09, 0x04, 0x17, 0x17, 0x0a, 0x81, 0x82, 0x82, 0x1c,
+	0x01, 0x32, 0x08, 0x82, 0x14, 0x00, 0x2a, 0x83, 0x00, 0x84, 0x00, 0x01, 0x11, 0x11, 0x83, 0x0d,
+	0x82, 0x0f, 0x84, 0x09, 0x85, 0x0a, 0x0a, 0x21, 0x36, 0x37, 0x1c, 0x1c, 0x83, 0x38, 0x14, 0x18,
+	0x18, 0x2a, 0x83, 0x00, 0x84, 0x00, 0x00, 0x0d, 0x83, 0x0f, 0x84, 0x09, 0x01, 0x17, 0x17, 0x83,
+	0x0a, 0x82, 0x12, 0x82, 0x14, 0x08, 0x39, 0x37, 0x1c, 0x33, 0x08, 0x18, 0x08, 0x08, 0x84, 0x83,
+	0x00, 0x84, 0x00, 0x00, 0x0f, 0x84, 0x09, 0x01, 0x17, 0x17, 0x83, 0x0a, 0x83, 0x12, 0x00, 0x21,
+	0x82, 0x14, 0x05, 0x18, 0x18, 0x08, 0x39, 0x85, 0x35, 0x83, 0x08, 0x00, 0x86, 0x83, 0x00, 0x84,
+	0x00, 0x83, 0x17, 0x83, 0x0a, 0x83, 0x12, 0x00, 0x1d, 0x82, 0x14, 0x01, 0x19, 0x19, 0x82, 0x18,
+	0x82, 0x08, 0x00, 0x2a, 0x84, 0x10, 0x00, 0x3a, 0x83, 0x00, 0x84, 0x00, 0x00, 0x17, 0x82, 0x0a,
+	0x0a, 0x12, 0x0a, 0x12, 0x12, 0x1d, 0x1d, 0x14, 0x18, 0x18, 0x19, 0x18, 0x84, 0x08, 0x84, 0x10,
+	0x84, 0x13, 0x00, 0x3a, 0x83, 0x00, 0x84, 0x00, 0x00, 0x0a, 0x83, 0x12, 0x82, 0x1d, 0x83, 0x19,
+	0x83, 0x08, 0x84, 0x10, 0x84, 0x13, 0x83, 0x1a, 0x00, 0x87, 0x83, 0x00, 0x84, 0x00, 0x03, 0x0a,
+	0x12, 0x1d, 0x1d, 0x83, 0x19, 0x85, 0x08, 0x83, 0x10, 0x85, 0x13, 0x85, 0x1a, 0x00, 0x88, 0x83,
+	0x00, 0x84, 0x00, 0x01, 0x36, 0x17, 0x82, 0x0a, 0x01, 0x12, 0x12, 0x83, 0x14, 0x82, 0x18, 0x85,
+	0x08, 0x82, 0x10, 0x00, 0x38, 0x84, 0x13, 0x01, 0x10, 0x89, 0x83, 0x00, 0x84, 0x00, 0x01, 0x8a,
+	0x8b, 0x86, 0x1e, 0x00, 0x8c, 0x91, 0x16, 0x02, 0x8d, 0x8e, 0x8f, 0x83, 0x00, 0xa7, 0x00, 0xa7,
+	0x00, 0xa7, 0x00, 0xa7, 0x00
+};
+const omegaPackedImage icon_function = {40, 40, 144, 8, 0x00, icon_function_palette, icon_function_data, 0x01};
+
+// 'gear', 40x40px, 21 colours, 3200 -> 563 bytes
+const uint16_t icon_gear_palette[] PROGMEM = {
+	0x0000, 0x7885, 0x9c96, 0xd12b, 0x3dbf, 0x577d, 0x8208, 0x8f53, 0xd133, 0xb05b, 0xb885, 0x3a8e,
+	0x7b96, 0x1dbf, 0x3244, 0x1a8e, 0x5a9e, 0xfcb6, 0xf133, 0xf98d, 0x734c
+};
+const uint8_t icon_gear_data[] PROGMEM = {
+	0xa7, 0x00, 0x90, 0x00, 0x85, 0x01, 0x90, 0x00, 0x90, 0x00, 0x85, 0x01, 0x90, 0x00, 0x90, 0x00,
+	0x85, 0x01, 0x90, 0x00, 0x90, 0x00, 0x85, 0x01, 0x90, 0x00, 0x87, 0x00, 0x01, 0x01, 0x05, 0x86,
+	0x00, 0x85, 0x01, 0x86, 0x00, 0x01, 0x05, 0x01, 0x87, 0x00, 0x86, 0x00, 0x83, 0x01, 0x85, 0x00,
+	0x85, 0x01, 0x85, 0x00, 0x83, 0x01, 0x86, 0x00, 0x85, 0x00, 0x85, 0x01, 0x83, 0x00, 0x87, 0x01,
+	0x83, 0x00, 0x85, 0x01, 0x85, 0x00, 0x84, 0x00, 0x87, 0x01, 0x02, 0x06, 0x01, 0x01, 0x84, 0x02,
+	0x84, 0x01, 0x00, 0x06, 0x87, 0x01, 0x84, 0x00, 0x84, 0x00, 0x00, 0x05, 0x87, 0x01, 0x86, 0x02,
+	0x8c, 0x01, 0x00, 0x05, 0x84, 0x00, 0x85, 0x00, 0x85, 0x01, 0x00, 0x0b, 0x83, 0x02, 0x90, 0x01,
+	0x85, 0x00, 0x86, 0x00, 0x83, 0x01, 0x00, 0x0c, 0x82, 0x02, 0x91, 0x01, 0x86, 0x00, 0x87, 0x00,
+	0x04, 0x01, 0x01, 0x0a, 0x02, 0x02, 0x92, 0x01, 0x87, 0x00, 0x87, 0x00, 0x03, 0x06, 0x01, 0x02,
+	0x02, 0x85, 0x01, 0x02, 0x0d, 0x04, 0x04, 0x89, 0x01, 0x00, 0x06, 0x87, 0x00, 0x87, 0x00, 0x03,
+	0x01, 0x02, 0x02, 0x0a, 0x83, 0x01, 0x84, 0x04, 0x8a, 0x01, 0x87, 0x00, 0x87, 0x00, 0x02, 0x01,
+	0x02, 0x02, 0x83, 0x01, 0x82, 0x04, 0x86, 0x01, 0x00, 0x0e, 0x85, 0x01, 0x87, 0x00, 0x86, 0x00,
+	0x02, 0x01, 0x0f, 0x02, 0x83, 0x01, 0x06, 0x10, 0x04, 0x11, 0x01, 0x01, 0x07, 0x07, 0x84, 0x01,
+	0x00, 0x12, 0x85, 0x01, 0x86, 0x00, 0x00, 0x00, 0x86, 0x01, 0x01, 0x02, 0x02, 0x83, 0x01, 0x03,
+	0x04, 0x04, 0x01, 0x09, 0x83, 0x00, 0x00, 0x09, 0x82, 0x01, 0x00, 0x08, 0x8b, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x86, 0x01, 0x01, 0x02, 0x02, 0x83, 0x01, 0x02, 0x04, 0x01, 0x01, 0x85, 0x00, 0x83,
+	0x01, 0x00, 0x03, 0x8a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x86, 0x01, 0x01, 0x02, 0x13, 0x83, 0x01,
+	0x02, 0x04, 0x01, 0x07, 0x85, 0x00, 0x00, 0x07, 0x82, 0x01, 0x00, 0x03, 0x8a, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x86, 0x01, 0x00, 0x02, 0x84, 0x01, 0x02, 0x04, 0x01, 0x07, 0x85, 0x00, 0x00, 0x07,
+	0x82, 0x01, 0x00, 0x03, 0x8a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x01, 0x85, 0x00, 0x83, 0x01,
+	0x00, 0x03, 0x8a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x09, 0x83, 0x00, 0x00, 0x09,
+	0x82, 0x01, 0x01, 0x08, 0x03, 0x8a, 0x01, 0x00, 0x00, 0x86, 0x00, 0x8b, 0x01, 0x01, 0x07, 0x07,
+	0x84, 0x01, 0x01, 0x03, 0x03, 0x84, 0x01, 0x86, 0x00, 0x87, 0x00, 0x90, 0x01, 0x01, 0x03, 0x03,
+	0x84, 0x01, 0x87, 0x00, 0x87, 0x00, 0x8f, 0x01, 0x82, 0x03, 0x84, 0x01, 0x87, 0x00, 0x87, 0x00,
+	0x00, 0x06, 0x87, 0x01, 0x00, 0x08, 0x83, 0x01, 0x03, 0x08, 0x03, 0x03, 0x08, 0x84, 0x01, 0x00,
+	0x06, 0x87, 0x00, 0x87, 0x00, 0x89, 0x01, 0x00, 0x14, 0x84, 0x03, 0x87, 0x01, 0x87, 0x00, 0x86,
+	0x00, 0x99, 0x01, 0x86, 0x00, 0x85, 0x00, 0x9b, 0x01, 0x85, 0x00, 0x84, 0x00, 0x00, 0x05, 0x9b,
+	0x01, 0x00, 0x05, 0x84, 0x00, 0x84, 0x00, 0x87, 0x01, 0x00, 0x06, 0x8b, 0x01, 0x00, 0x06, 0x87,
+	0x01, 0x84, 0x00, 0x85, 0x00, 0x85, 0x01, 0x83, 0x00, 0x87, 0x01, 0x83, 0x00, 0x85, 0x01, 0x85,
+	0x00, 0x86, 0x00, 0x83, 0x01, 0x85, 0x00, 0x85, 0x01, 0x85, 0x00, 0x83, 0x01, 0x86, 0x00, 0x87,
+	0x00, 0x01, 0x01, 0x05, 0x86, 0x00, 0x85, 0x01, 0x86, 0x00, 0x01, 0x05, 0x01, 0x87, 0x00, 0x90,
+	0x00, 0x85, 0x01, 0x90, 0x00, 0x90, 0x00, 0x85, 0x01, 0x90, 0x00, 0x90, 0x00, 0x85, 0x01, 0x90,
+	0x00, 0x90, 0x00, 0x85, 0x01, 0x90, 0x00, 0xa7, 0x00
+};
+const omegaPackedImage icon_gear = {40, 40, 21, 8, 0x00, icon_gear_palette, icon_gear_data, 0x01};
+
+// 'graduation-cap_1f393', 40x40px, 33 colours, 3200 -> 528 bytes
+const uint16_t icon_graduation_cap_1f393_palette[] PROGMEM = {
+	0x0000, 0x0842, 0x22e5, 0x0421, 0x45fe, 0x0c63, 0xf39c, 0xa19b, 0xc739, 0x694a, 0xcb5a, 0xeb5a,
+	0x6529, 0xa631, 0xd39c, 0x2842, 0x4529, 0xa210, 0x2773, 0x6852, 0x677b, 0xe5f5, 0x0183, 0x8e73,
+	0x9294, 0xc272, 0xe739, 0x819b, 0xc051, 0x8172, 0x41bc, 0x6193, 0x6010
+};
+const uint8_t icon_graduation_cap_1f393_data[] PROGMEM = {
+	0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0x92, 0x00, 0x01, 0x01, 0x01, 0x92, 0x00, 0x90,
+	0x00, 0x00, 0x0c, 0x83, 0x01, 0x00, 0x0c, 0x90, 0x00, 0x8f, 0x00, 0x87, 0x01, 0x8f, 0x00, 0x8d,
+	0x00, 0x8b, 0x01, 0x8d, 0x00, 0x8b, 0x00, 0x00, 0x0d, 0x8d, 0x01, 0x00, 0x0d, 0x8b, 0x00, 0x8a,
+	0x00, 0x91, 0x01, 0x8a, 0x00, 0x88, 0x00, 0x95, 0x01, 0x88, 0x00, 0x86, 0x00, 0x00, 0x08, 0x8a,
+	0x01, 0x01, 0x09, 0x0a, 0x8a, 0x01, 0x00, 0x08, 0x86, 0x00, 0x85, 0x00, 0x8b, 0x01, 0x02, 0x0a,
+	0x05, 0x05, 0x8c, 0x01, 0x85, 0x00, 0x83, 0x00, 0x8c, 0x01, 0x02, 0x12, 0x09, 0x05, 0x8f, 0x01,
+	0x83, 0x00, 0x01, 0x00, 0x00, 0x8d, 0x01, 0x01, 0x04, 0x04, 0x82, 0x01, 0x00, 0x04, 0x8f, 0x01,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x8b, 0x01, 0x02, 0x04, 0x04, 0x01, 0x82, 0x04, 0x00, 0x13,
+	0x90, 0x01, 0x01, 0x05, 0x00, 0x03, 0x00, 0x00, 0x06, 0x0f, 0x87, 0x01, 0x00, 0x14, 0x84, 0x04,
+	0x00, 0x0f, 0x91, 0x01, 0x02, 0x05, 0x00, 0x00, 0x83, 0x00, 0x00, 0x06, 0x85, 0x01, 0x84, 0x04,
+	0x92, 0x01, 0x00, 0x05, 0x83, 0x00, 0x84, 0x00, 0x04, 0x0e, 0x06, 0x01, 0x01, 0x15, 0x83, 0x04,
+	0x92, 0x01, 0x01, 0x05, 0x0b, 0x84, 0x00, 0x86, 0x00, 0x00, 0x06, 0x83, 0x04, 0x92, 0x01, 0x01,
+	0x0b, 0x05, 0x86, 0x00, 0x86, 0x00, 0x02, 0x16, 0x04, 0x04, 0x93, 0x01, 0x00, 0x05, 0x88, 0x00,
+	0x86, 0x00, 0x04, 0x02, 0x02, 0x03, 0x01, 0x06, 0x8f, 0x01, 0x02, 0x05, 0x0b, 0x03, 0x88, 0x00,
+	0x86, 0x00, 0x01, 0x02, 0x02, 0x82, 0x03, 0x01, 0x06, 0x06, 0x8b, 0x01, 0x04, 0x05, 0x05, 0x03,
+	0x03, 0x01, 0x88, 0x00, 0x86, 0x00, 0x01, 0x02, 0x02, 0x84, 0x03, 0x01, 0x06, 0x17, 0x87, 0x01,
+	0x06, 0x09, 0x05, 0x03, 0x03, 0x10, 0x01, 0x01, 0x88, 0x00, 0x86, 0x00, 0x01, 0x02, 0x02, 0x82,
+	0x03, 0x04, 0x01, 0x03, 0x03, 0x18, 0x06, 0x85, 0x01, 0x03, 0x05, 0x0a, 0x03, 0x03, 0x83, 0x01,
+	0x88, 0x00, 0x86, 0x00, 0x82, 0x02, 0x00, 0x03, 0x83, 0x01, 0x09, 0x03, 0x03, 0x06, 0x06, 0x01,
+	0x01, 0x05, 0x05, 0x03, 0x03, 0x84, 0x01, 0x00, 0x05, 0x88, 0x00, 0x86, 0x00, 0x82, 0x02, 0x00,
+	0x03, 0x84, 0x01, 0x04, 0x10, 0x03, 0x03, 0x06, 0x05, 0x82, 0x03, 0x85, 0x01, 0x00, 0x05, 0x88,
+	0x00, 0x86, 0x00, 0x03, 0x07, 0x07, 0x03, 0x03, 0x86, 0x01, 0x83, 0x03, 0x87, 0x01, 0x00, 0x05,
+	0x88, 0x00, 0x86, 0x00, 0x03, 0x07, 0x07, 0x19, 0x03, 0x92, 0x01, 0x00, 0x05, 0x88, 0x00, 0x86,
+	0x00, 0x82, 0x02, 0x00, 0x03, 0x92, 0x01, 0x89, 0x00, 0x86, 0x00, 0x82, 0x02, 0x01, 0x00, 0x00,
+	0x8f, 0x01, 0x8b, 0x00, 0x85, 0x00, 0x83, 0x02, 0x82, 0x00, 0x00, 0x11, 0x8b, 0x01, 0x00, 0x11,
+	0x8c, 0x00, 0x85, 0x00, 0x83, 0x02, 0x85, 0x00, 0x00, 0x1a, 0x85, 0x01, 0x00, 0x08, 0x8f, 0x00,
+	0x85, 0x00, 0x83, 0x02, 0x9d, 0x00, 0x85, 0x00, 0x00, 0x1b, 0x82, 0x02, 0x9d, 0x00, 0x85, 0x00,
+	0x00, 0x1c, 0x82, 0x02, 0x9d, 0x00, 0x84, 0x00, 0x01, 0x02, 0x1d, 0x82, 0x02, 0x9d, 0x00, 0x84,
+	0x00, 0x05, 0x1e, 0x07, 0x02, 0x02, 0x1f, 0x20, 0x9c, 0x00, 0xa7, 0x00, 0xa7, 0x00
+};
+const omegaPackedImage icon_graduation_cap_1f393 = {40, 40, 33, 8, 0x00, icon_graduation_cap_1f393_palette, icon_graduation_cap_1f393_data, 0x01};
+
+// 'info', 40x40px, 18 colours, 3200 -> 429 bytes
+const uint16_t icon_info_palette[] PROGMEM = {
+	0x3d05, 0x0000, 0xffff, 0x5fbf, 0xfc04, 0x1d05, 0x1704, 0x7904, 0x3fbf, 0xff9e, 0x3e5e, 0x1e56,
+	0x5d05, 0x9e86, 0x7e76, 0xd503, 0x9403, 0x5303
+};
+const uint8_t icon_info_data[] PROGMEM = {
+	0xa7, 0x01, 0x84, 0x01, 0x00, 0x04, 0x9b, 0x00, 0x00, 0x04, 0x84, 0x01, 0x82, 0x01, 0xa1, 0x00,
+	0x82, 0x01, 0x01, 0x01, 0x01, 0xa3, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xa3, 0x00, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x07, 0xa3, 0x00, 0x01, 0x06, 0x01, 0x00, 0x01, 0xa5, 0x00, 0x00, 0x01,
+	0x00, 0x01, 0x90, 0x00, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x08,
+	0x83, 0x02, 0x00, 0x09, 0x8f, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f, 0x00, 0x85, 0x02, 0x8f, 0x00,
+	0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00,
+	0x03, 0x0a, 0x02, 0x02, 0x0b, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x00,
+	0x01, 0xa5, 0x00, 0x00, 0x01, 0x00, 0x01, 0x91, 0x00, 0x00, 0x0c, 0x92, 0x00, 0x00, 0x01, 0x00,
+	0x01, 0x90, 0x00, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x0d, 0x83,
+	0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00,
+	0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f,
+	0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83,
+	0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00,
+	0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f,
+	0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83,
+	0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00,
+	0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f,
+	0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83,
+	0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00,
+	0x01, 0x00, 0x01, 0x8f, 0x00, 0x00, 0x03, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8f,
+	0x00, 0x00, 0x0e, 0x83, 0x02, 0x90, 0x00, 0x00, 0x01, 0x00, 0x01, 0x90, 0x00, 0x83, 0x02, 0x90,
+	0x00, 0x00, 0x01, 0x00, 0x01, 0xa5, 0x00, 0x00, 0x01, 0x01, 0x01, 0x06, 0xa3, 0x00, 0x01, 0x0f,
+	0x01, 0x01, 0x01, 0x01, 0xa3, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x05, 0xa1, 0x00, 0x02,
+	0x05, 0x01, 0x01, 0x82, 0x01, 0x00, 0x05, 0x9f, 0x00, 0x00, 0x04, 0x82, 0x01, 0x84, 0x01, 0x00,
+	0x10, 0x9b, 0x00, 0x00, 0x11, 0x84, 0x01, 0xa7, 0x01
+};
+const omegaPackedImage icon_info = {40, 40, 18, 8, 0x01, icon_info_palette, icon_info_data, 0x01};
+
+// 'light', 40x40px, 26 colours, 3200 -> 450 bytes
+const uint16_t icon_light_palette[] PROGMEM = {
+	0x0000, 0xd0fe, 0xbbce, 0x569d, 0x69fe, 0xcffe, 0x7ac6, 0x8cfe, 0x8e6b, 0x39be, 0x4fee, 0x90fe,
+	0x6110, 0x8bac, 0xb0fe, 0x2229, 0xc118, 0x6008, 0x2000, 0x8339, 0xe220, 0xd5ee, 0xd8ad, 0x769d,
+	0x9bce, 0x18be
+};
+const uint8_t icon_light_data[] PROGMEM = {
+	0x90, 0x00, 0x00, 0x0a, 0x83, 0x01, 0x00, 0x0b, 0x90, 0x00, 0x8d, 0x00, 0x00, 0x0c, 0x89, 0x01,
+	0x00, 0x0d, 0x8d, 0x00, 0x8c, 0x00, 0x8d, 0x01, 0x8c, 0x00, 0x8b, 0x00, 0x8f, 0x01, 0x8b, 0x00,
+	0x8a, 0x00, 0x91, 0x01, 0x8a, 0x00, 0x89, 0x00, 0x93, 0x01, 0x89, 0x00, 0x88, 0x00, 0x95, 0x01,
+	0x88, 0x00, 0x88, 0x00, 0x95, 0x01, 0x88, 0x00, 0x87, 0x00, 0x00, 0x0e, 0x96, 0x01, 0x87, 0x00,
+	0x87, 0x00, 0x97, 0x01, 0x87, 0x00, 0x87, 0x00, 0x97, 0x01, 0x87, 0x00, 0x87, 0x00, 0x86, 0x01,
+	0x01, 0x04, 0x05, 0x86, 0x01, 0x00, 0x04, 0x86, 0x01, 0x87, 0x00, 0x87, 0x00, 0x85, 0x01, 0x03,
+	0x07, 0x04, 0x04, 0x05, 0x83, 0x01, 0x03, 0x05, 0x04, 0x04, 0x07, 0x85, 0x01, 0x87, 0x00, 0x87,
+	0x00, 0x86, 0x01, 0x82, 0x04, 0x00, 0x05, 0x82, 0x01, 0x82, 0x04, 0x86, 0x01, 0x87, 0x00, 0x87,
+	0x00, 0x87, 0x01, 0x82, 0x04, 0x01, 0x01, 0x01, 0x82, 0x04, 0x87, 0x01, 0x87, 0x00, 0x87, 0x00,
+	0x88, 0x01, 0x85, 0x04, 0x88, 0x01, 0x87, 0x00, 0x87, 0x00, 0x00, 0x0f, 0x88, 0x01, 0x83, 0x04,
+	0x88, 0x01, 0x00, 0x10, 0x87, 0x00, 0x88, 0x00, 0x89, 0x01, 0x01, 0x04, 0x04, 0x89, 0x01, 0x88,
+	0x00, 0x88, 0x00, 0x00, 0x11, 0x88, 0x01, 0x01, 0x04, 0x04, 0x88, 0x01, 0x00, 0x12, 0x88, 0x00,
+	0x89, 0x00, 0x88, 0x01, 0x01, 0x04, 0x04, 0x88, 0x01, 0x89, 0x00, 0x8a, 0x00, 0x87, 0x01, 0x01,
+	0x04, 0x04, 0x87, 0x01, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x13, 0x86, 0x01, 0x01, 0x04, 0x04, 0x86,
+	0x01, 0x8b, 0x00, 0x8b, 0x00, 0x86, 0x01, 0x01, 0x04, 0x04, 0x86, 0x01, 0x8b, 0x00, 0x8b, 0x00,
+	0x00, 0x14, 0x85, 0x01, 0x01, 0x04, 0x04, 0x85, 0x01, 0x8c, 0x00, 0x8c, 0x00, 0x85, 0x01, 0x01,
+	0x04, 0x04, 0x85, 0x01, 0x8c, 0x00, 0x8c, 0x00, 0x85, 0x01, 0x01, 0x04, 0x04, 0x85, 0x01, 0x8c,
+	0x00, 0x8c, 0x00, 0x85, 0x01, 0x01, 0x04, 0x04, 0x85, 0x01, 0x8c, 0x00, 0x8c, 0x00, 0x85, 0x01,
+	0x02, 0x04, 0x04, 0x15, 0x85, 0x02, 0x8b, 0x00, 0x8c, 0x00, 0x02, 0x03, 0x03, 0x16, 0x8a, 0x02,
+	0x00, 0x08, 0x8b, 0x00, 0x8b, 0x00, 0x8a, 0x02, 0x83, 0x03, 0x8c, 0x00, 0x8b, 0x00, 0x84, 0x02,
+	0x00, 0x17, 0x88, 0x03, 0x8c, 0x00, 0x8c, 0x00, 0x8a, 0x03, 0x03, 0x06, 0x02, 0x02, 0x08, 0x8b,
+	0x00, 0x8c, 0x00, 0x84, 0x03, 0x00, 0x06, 0x88, 0x02, 0x8b, 0x00, 0x8c, 0x00, 0x8b, 0x02, 0x01,
+	0x06, 0x03, 0x8c, 0x00, 0x8b, 0x00, 0x86, 0x02, 0x00, 0x18, 0x86, 0x03, 0x8c, 0x00, 0x8c, 0x00,
+	0x00, 0x09, 0x8b, 0x03, 0x8d, 0x00, 0x8e, 0x00, 0x89, 0x03, 0x8e, 0x00, 0x8f, 0x00, 0x00, 0x19,
+	0x85, 0x02, 0x00, 0x09, 0x8f, 0x00, 0x91, 0x00, 0x83, 0x02, 0x91, 0x00, 0xa7, 0x00
+};
+const omegaPackedImage icon_light = {40, 40, 26, 8, 0x00, icon_light_palette, icon_light_data, 0x01};
+
+// 'numeric', 40x40px, 13 colours, 3200 -> 433 bytes
+const uint16_t icon_numeric_palette[] PROGMEM = {
+	0xf75b, 0x0000, 0x3643, 0xffff, 0x1864, 0x9fef, 0xdbad, 0xfdd6, 0x5ee7, 0xb97c, 0xdfff, 0xddd6,
+	0xf763
+};
+const uint8_t icon_numeric_data[] PROGMEM = {
+	0xa7, 0x01, 0xa7, 0x01, 0xa7, 0x01, 0xa7, 0x01, 0x01, 0x11, 0xa3, 0x02, 0x01, 0x11, 0x02, 0x12,
+	0x20, 0xa1, 0x00, 0x02, 0x22, 0x10, 0x01, 0x22, 0xa3, 0x00, 0x01, 0x22, 0x01, 0x22, 0xa3, 0x00,
+	0x01, 0x22, 0x01, 0x22, 0xa3, 0x00, 0x01, 0x22, 0x01, 0x22, 0xa3, 0x00, 0x01, 0x22, 0x01, 0x22,
+	0xa3, 0x00, 0x01, 0x22, 0x01, 0x22, 0xa3, 0x00, 0x01, 0x22, 0x01, 0x22, 0x84, 0x00, 0x01, 0x33,
+	0x87, 0x00, 0x84, 0x03, 0x85, 0x00, 0x84, 0x03, 0x84, 0x00, 0x01, 0x22, 0x04, 0x22, 0x00, 0x40,
+	0x83, 0x03, 0x86, 0x00, 0x86, 0x03, 0x83, 0x00, 0x86, 0x03, 0x83, 0x00, 0x01, 0x22, 0x08, 0x22,
+	0x00, 0x45, 0x53, 0x30, 0x85, 0x00, 0x82, 0x03, 0x82, 0x00, 0x82, 0x03, 0x82, 0x00, 0x01, 0x33,
+	0x82, 0x00, 0x82, 0x03, 0x82, 0x00, 0x01, 0x22, 0x01, 0x22, 0x84, 0x00, 0x01, 0x33, 0x85, 0x00,
+	0x01, 0x33, 0x83, 0x00, 0x82, 0x03, 0x87, 0x00, 0x02, 0x63, 0x30, 0x82, 0x00, 0x01, 0x22, 0x01,
+	0x22, 0x84, 0x00, 0x01, 0x33, 0x8b, 0x00, 0x82, 0x03, 0x87, 0x00, 0x82, 0x03, 0x82, 0x00, 0x01,
+	0x22, 0x01, 0x22, 0x84, 0x00, 0x01, 0x33, 0x8b, 0x00, 0x82, 0x03, 0x84, 0x00, 0x01, 0x97, 0x82,
+	0x03, 0x83, 0x00, 0x01, 0x22, 0x01, 0x22, 0x84, 0x00, 0x01, 0x33, 0x8a, 0x00, 0x82, 0x03, 0x85,
+	0x00, 0x83, 0x03, 0x84, 0x00, 0x01, 0x22, 0x01, 0x22, 0x84, 0x00, 0x01, 0x33, 0x89, 0x00, 0x82,
+	0x03, 0x86, 0x00, 0x84, 0x03, 0x00, 0xa0, 0x82, 0x00, 0x01, 0x22, 0x01, 0x22, 0x84, 0x00, 0x01,
+	0x33, 0x87, 0x00, 0x00, 0xb0, 0x82, 0x03, 0x8a, 0x00, 0x02, 0x73, 0x30, 0x82, 0x00, 0x01, 0x22,
+	0x01, 0x22, 0x84, 0x00, 0x01, 0x33, 0x86, 0x00, 0x83, 0x03, 0x8c, 0x00, 0x06, 0x33, 0xc0, 0x02,
+	0x20, 0x01, 0x22, 0x84, 0x00, 0x01, 0x33, 0x85, 0x00, 0x83, 0x03, 0x87, 0x00, 0x00, 0x30, 0x84,
+	0x00, 0x01, 0x33, 0x82, 0x00, 0x01, 0x22, 0x01, 0x22, 0x84, 0x00, 0x01, 0x33, 0x85, 0x00, 0x82,
+	0x03, 0x87, 0x00, 0x82, 0x03, 0x82, 0x00, 0x82, 0x03, 0x82, 0x00, 0x01, 0x22, 0x01, 0x22, 0x82,
+	0x00, 0x85, 0x03, 0x00, 0x80, 0x82, 0x00, 0x88, 0x03, 0x82, 0x00, 0x86, 0x03, 0x00, 0x60, 0x82,
+	0x00, 0x01, 0x22, 0x01, 0x22, 0x82, 0x00, 0x85, 0x03, 0x00, 0x80, 0x82, 0x00, 0x88, 0x03, 0x83,
+	0x00, 0x84, 0x03, 0x84, 0x00, 0x01, 0x22, 0x01, 0x22, 0xa3, 0x00, 0x01, 0x22, 0x01, 0x22, 0xa3,
+	0x00, 0x01, 0x22, 0x01, 0x22, 0xa3, 0x00, 0x01, 0x22, 0x01, 0x22, 0xa3, 0x00, 0x01, 0x22, 0x01,
+	0x22, 0xa3, 0x00, 0x01, 0x22, 0x01, 0x22, 0xa3, 0x00, 0x01, 0x22, 0x82, 0x02, 0xa1, 0x00, 0x82,
+	0x02, 0xa7, 0x02, 0x00, 0x10, 0xa5, 0x02, 0x00, 0x10, 0x01, 0x11, 0xa3, 0x02, 0x01, 0x11, 0xa7,
+	0x01, 0xa7, 0x01, 0xa7, 0x01, 0xa7, 0x01
+};
+const omegaPackedImage icon_numeric = {40, 40, 13, 4, 0x01, icon_numeric_palette, icon_numeric_data, 0x01};
+
+// 'question', 40x40px, 27 colours, 3200 -> 460 bytes
+const uint16_t icon_question_palette[] PROGMEM = {
+	0x0000, 0x1ce7, 0xf7bd, 0xffff, 0x18c6, 0xdbde, 0xd7bd, 0x59ce, 0x2000, 0x38c6, 0x96b5, 0x9ad6,
+	0xa210, 0x718c, 0xf39c, 0x8a52, 0xfbde, 0x494a, 0x6108, 0x0421, 0xbad6, 0x34a5, 0x55ad, 0x694a,
+	0x79ce, 0xd39c, 0x5def
+};
+const uint8_t icon_question_data[] PROGMEM = {
+	0xa7, 0x00, 0x90, 0x00, 0x05, 0x0a, 0x01, 0x01, 0x0b, 0x02, 0x02, 0x90, 0x00, 0x8d, 0x00, 0x89,
+	0x01, 0x01, 0x02, 0x02, 0x8d, 0x00, 0x8b, 0x00, 0x01, 0x0c, 0x01, 0x84, 0x03, 0x85, 0x01, 0x02,
+	0x04, 0x02, 0x06, 0x8b, 0x00, 0x8a, 0x00, 0x01, 0x0d, 0x01, 0x83, 0x03, 0x88, 0x01, 0x02, 0x07,
+	0x02, 0x02, 0x8a, 0x00, 0x8a, 0x00, 0x00, 0x01, 0x82, 0x03, 0x8b, 0x01, 0x01, 0x02, 0x02, 0x8a,
+	0x00, 0x89, 0x00, 0x00, 0x01, 0x82, 0x03, 0x07, 0x01, 0x01, 0x05, 0x02, 0x02, 0x08, 0x00, 0x0e,
+	0x85, 0x01, 0x01, 0x02, 0x02, 0x89, 0x00, 0x89, 0x00, 0x06, 0x01, 0x03, 0x03, 0x01, 0x05, 0x02,
+	0x02, 0x85, 0x00, 0x00, 0x05, 0x83, 0x01, 0x01, 0x02, 0x02, 0x89, 0x00, 0x88, 0x00, 0x06, 0x01,
+	0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x87, 0x00, 0x83, 0x01, 0x82, 0x02, 0x88, 0x00, 0x88, 0x00,
+	0x83, 0x01, 0x02, 0x02, 0x02, 0x08, 0x87, 0x00, 0x00, 0x0f, 0x82, 0x01, 0x02, 0x10, 0x02, 0x02,
+	0x88, 0x00, 0x88, 0x00, 0x00, 0x11, 0x82, 0x01, 0x01, 0x02, 0x02, 0x89, 0x00, 0x83, 0x01, 0x01,
+	0x02, 0x02, 0x88, 0x00, 0x98, 0x00, 0x83, 0x01, 0x01, 0x02, 0x02, 0x88, 0x00, 0x97, 0x00, 0x00,
+	0x12, 0x82, 0x01, 0x02, 0x05, 0x02, 0x02, 0x88, 0x00, 0x97, 0x00, 0x83, 0x01, 0x02, 0x02, 0x02,
+	0x13, 0x88, 0x00, 0x97, 0x00, 0x83, 0x01, 0x01, 0x02, 0x02, 0x89, 0x00, 0x96, 0x00, 0x83, 0x01,
+	0x02, 0x14, 0x02, 0x02, 0x89, 0x00, 0x95, 0x00, 0x84, 0x01, 0x01, 0x02, 0x02, 0x8a, 0x00, 0x94,
+	0x00, 0x84, 0x01, 0x01, 0x02, 0x02, 0x8b, 0x00, 0x93, 0x00, 0x84, 0x01, 0x02, 0x04, 0x02, 0x15,
+	0x8b, 0x00, 0x92, 0x00, 0x84, 0x01, 0x02, 0x09, 0x02, 0x06, 0x8c, 0x00, 0x91, 0x00, 0x84, 0x01,
+	0x02, 0x09, 0x02, 0x02, 0x8d, 0x00, 0x91, 0x00, 0x83, 0x01, 0x02, 0x04, 0x02, 0x16, 0x8e, 0x00,
+	0x90, 0x00, 0x83, 0x01, 0x02, 0x07, 0x02, 0x06, 0x8f, 0x00, 0x90, 0x00, 0x83, 0x01, 0x01, 0x02,
+	0x02, 0x90, 0x00, 0x90, 0x00, 0x82, 0x01, 0x02, 0x04, 0x02, 0x02, 0x90, 0x00, 0x90, 0x00, 0x82,
+	0x01, 0x01, 0x02, 0x02, 0x91, 0x00, 0x8f, 0x00, 0x00, 0x17, 0x82, 0x01, 0x01, 0x02, 0x02, 0x91,
+	0x00, 0x90, 0x00, 0x04, 0x01, 0x01, 0x18, 0x02, 0x19, 0x91, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7,
+	0x00, 0x91, 0x00, 0x82, 0x02, 0x92, 0x00, 0x90, 0x00, 0x83, 0x01, 0x00, 0x02, 0x91, 0x00, 0x8f,
+	0x00, 0x02, 0x01, 0x1a, 0x03, 0x82, 0x01, 0x00, 0x02, 0x90, 0x00, 0x8f, 0x00, 0x01, 0x01, 0x03,
+	0x83, 0x01, 0x00, 0x02, 0x90, 0x00, 0x8f, 0x00, 0x85, 0x01, 0x00, 0x02, 0x90, 0x00, 0x8f, 0x00,
+	0x85, 0x01, 0x00, 0x02, 0x90, 0x00, 0x90, 0x00, 0x83, 0x01, 0x00, 0x02, 0x91, 0x00, 0x91, 0x00,
+	0x82, 0x02, 0x92, 0x00, 0xa7, 0x00
+};
+const omegaPackedImage icon_question = {40, 40, 27, 8, 0x00, icon_question_palette, icon_question_data, 0x01};
+
+// 'satellite-antenna', 40x40px, 167 colours, 3200 -> 969 bytes
+const uint16_t icon_satellite_antenna_palette[] PROGMEM = {
+	0x0000, 0x6839, 0xb8bd, 0xbcde, 0xf8b4, 0xdbcd, 0xdde6, 0xf8c5, 0x39ce, 0xdacd, 0xfde6, 0xd8c5,
+	0xd9c5, 0x1cd6, 0x1ace, 0xfbcd, 0x9cde, 0x7bd6, 0xd39c, 0x19ce, 0xb9c5, 0x3bd6, 0xfcd5, 0xdce6,
+	0x9bde, 0x2000, 0x6108, 0xb7bd, 0xd7c5, 0xf7c5, 0x7ad6, 0x3cd6, 0xbac5, 0x98bd, 0x5eef, 0xbc1a,
+	0x0421, 0xb29c, 0x35ad, 0x19c6, 0x4108, 0xf3a4, 0x97bd, 0x14a5, 0x96b5, 0x15ad, 0xf9c5, 0xf9cd,
+	0xfacd, 0xf7ac, 0x1de7, 0x1def, 0xbf33, 0x2c11, 0xff3b, 0x7e2b, 0x7622, 0x55ad, 0x5ace, 0x318c,
+	0x328c, 0xb49c, 0x9294, 0xf5a4, 0xb6bd, 0x76b5, 0x34ad, 0xb394, 0xab5a, 0xd8bd, 0x95a4, 0x37b5,
+	0x55b5, 0x1bce, 0x18b5, 0x78bd, 0xdac5, 0x1bd6, 0x96a4, 0x9ac5, 0x99bd, 0x36ad, 0x9bd6, 0xbbcd,
+	0x9bc5, 0x3eef, 0x7ef7, 0x2200, 0x2811, 0x2100, 0x4a19, 0xdf33, 0x1d23, 0x3d23, 0x7f44, 0x4100,
+	0x531a, 0x111a, 0x982a, 0x1f3c, 0xbf54, 0x3f44, 0x4e6b, 0x5e23, 0x4200, 0xf8bd, 0x322a, 0xb622,
+	0xbb1a, 0x4a11, 0x7ace, 0x6d19, 0x192b, 0x6300, 0xe739, 0xcb5a, 0x7294, 0x8f73, 0x16ad, 0xb92a,
+	0x6308, 0x9f2b, 0x6d6b, 0xc318, 0x8f7b, 0x749c, 0x6a52, 0xf083, 0x2d6b, 0xd3a4, 0x4529, 0x518c,
+	0xd6c5, 0xb4a4, 0x34a5, 0x18c6, 0x15a5, 0xd5a4, 0x8631, 0xf4a4, 0x95bd, 0x77b5, 0x5ad6, 0x3ace,
+	0x3bce, 0x759c, 0x17ad, 0xd7ac, 0x96bd, 0x57a4, 0x128c, 0x38a4, 0x98ac, 0x13ad, 0xfccd, 0x78b5,
+	0xdcde, 0xb9bd, 0x294a, 0x77bd, 0x5bd6, 0x97b5, 0x6629, 0xbbde, 0x3def, 0xd8b4, 0x38b5
+};
+const uint8_t icon_satellite_antenna_data[] PROGMEM = {
+	0xa7, 0x00, 0xa7, 0x00, 0x9c, 0x00, 0x02, 0x57, 0x58, 0x59, 0x87, 0x00, 0x9a, 0x00, 0x06, 0x5a,
+	0x5b, 0x5c, 0x23, 0x5d, 0x34, 0x5e, 0x85, 0x00, 0xa0, 0x00, 0x02, 0x35, 0x36, 0x5f, 0x83, 0x00,
+	0x9c, 0x00, 0x01, 0x60, 0x61, 0x82, 0x00, 0x01, 0x19, 0x36, 0x83, 0x00, 0x9b, 0x00, 0x08, 0x37,
+	0x38, 0x62, 0x37, 0x63, 0x00, 0x00, 0x35, 0x64, 0x82, 0x00, 0x9f, 0x00, 0x04, 0x38, 0x65, 0x00,
+	0x00, 0x34, 0x82, 0x00, 0x9b, 0x00, 0x01, 0x24, 0x66, 0x82, 0x00, 0x06, 0x67, 0x00, 0x00, 0x23,
+	0x68, 0x00, 0x00, 0x9a, 0x00, 0x0c, 0x25, 0x39, 0x69, 0x3a, 0x00, 0x00, 0x6a, 0x6b, 0x00, 0x6c,
+	0x6d, 0x00, 0x00, 0x9a, 0x00, 0x0c, 0x25, 0x26, 0x27, 0x6e, 0x28, 0x00, 0x6f, 0x70, 0x00, 0x23,
+	0x71, 0x00, 0x00, 0x8e, 0x00, 0x01, 0x72, 0x73, 0x83, 0x00, 0x0f, 0x1a, 0x74, 0x29, 0x12, 0x3b,
+	0x75, 0x3c, 0x3d, 0x76, 0x2a, 0x00, 0x00, 0x77, 0x78, 0x00, 0x79, 0x82, 0x00, 0x8e, 0x00, 0x07,
+	0x29, 0x2b, 0x2c, 0x2b, 0x12, 0x3e, 0x7a, 0x7b, 0x83, 0x00, 0x03, 0x7c, 0x3c, 0x7d, 0x7e, 0x88,
+	0x00, 0x8e, 0x00, 0x03, 0x25, 0x29, 0x2b, 0x1b, 0x86, 0x00, 0x03, 0x7f, 0x80, 0x00, 0x3f, 0x89,
+	0x00, 0x8d, 0x00, 0x06, 0x19, 0x40, 0x41, 0x81, 0x42, 0x2c, 0x82, 0x83, 0x00, 0x04, 0x24, 0x83,
+	0x00, 0x00, 0x26, 0x89, 0x00, 0x8d, 0x00, 0x07, 0x84, 0x1c, 0x1c, 0x1b, 0x85, 0x2d, 0x2c, 0x86,
+	0x82, 0x00, 0x00, 0x12, 0x82, 0x00, 0x00, 0x26, 0x89, 0x00, 0x8d, 0x00, 0x0a, 0x1c, 0x1d, 0x07,
+	0x07, 0x0b, 0x3d, 0x2d, 0x1b, 0x87, 0x00, 0x43, 0x83, 0x00, 0x00, 0x88, 0x89, 0x00, 0x8c, 0x00,
+	0x0b, 0x44, 0x1d, 0x07, 0x07, 0x2e, 0x07, 0x07, 0x89, 0x3f, 0x2a, 0x08, 0x8a, 0x83, 0x00, 0x00,
+	0x8b, 0x89, 0x00, 0x8c, 0x00, 0x03, 0x8c, 0x1d, 0x07, 0x07, 0x82, 0x13, 0x05, 0x2e, 0x45, 0x46,
+	0x8d, 0x1e, 0x44, 0x82, 0x00, 0x00, 0x12, 0x89, 0x00, 0x8c, 0x00, 0x04, 0x40, 0x1d, 0x0b, 0x2f,
+	0x13, 0x83, 0x0e, 0x07, 0x14, 0x46, 0x47, 0x8e, 0x27, 0x00, 0x00, 0x12, 0x89, 0x00, 0x8c, 0x00,
+	0x10, 0x48, 0x0b, 0x0b, 0x2f, 0x0e, 0x0e, 0x8f, 0x15, 0x90, 0x49, 0x09, 0x91, 0x92, 0x0c, 0x1e,
+	0x00, 0x43, 0x89, 0x00, 0x8c, 0x00, 0x06, 0x28, 0x0b, 0x0b, 0x0c, 0x2f, 0x30, 0x49, 0x83, 0x15,
+	0x06, 0x09, 0x4a, 0x93, 0x4b, 0x3a, 0x3e, 0x19, 0x88, 0x00, 0x8d, 0x00, 0x10, 0x1c, 0x0b, 0x0c,
+	0x4c, 0x30, 0x0f, 0x4d, 0x0d, 0x1f, 0x1f, 0x0d, 0x30, 0x20, 0x4e, 0x47, 0x0c, 0x3b, 0x88, 0x00,
+	0x8d, 0x00, 0x11, 0x94, 0x0b, 0x14, 0x4c, 0x09, 0x0f, 0x0f, 0x16, 0x0d, 0x1f, 0x1f, 0x0d, 0x0f,
+	0x4f, 0x95, 0x31, 0x21, 0x96, 0x87, 0x00, 0x8d, 0x00, 0x08, 0x42, 0x41, 0x14, 0x0c, 0x20, 0x05,
+	0x05, 0x0f, 0x16, 0x82, 0x0d, 0x05, 0x4d, 0x05, 0x50, 0x97, 0x98, 0x1a, 0x87, 0x00, 0x8c, 0x00,
+	0x09, 0x99, 0x39, 0x51, 0x51, 0x14, 0x20, 0x09, 0x05, 0x05, 0x0f, 0x82, 0x16, 0x02, 0x9a, 0x05,
+	0x4f, 0x8a, 0x00, 0x8a, 0x00, 0x09, 0x07, 0x1e, 0x52, 0x08, 0x1b, 0x21, 0x9b, 0x0c, 0x20, 0x09,
+	0x84, 0x05, 0x01, 0x53, 0x54, 0x8b, 0x00, 0x89, 0x00, 0x09, 0x48, 0x1e, 0x10, 0x9c, 0x17, 0x18,
+	0x2e, 0x9d, 0x4b, 0x14, 0x83, 0x09, 0x02, 0x53, 0x54, 0x19, 0x8c, 0x00, 0x89, 0x00, 0x0c, 0x08,
+	0x11, 0x10, 0x18, 0x03, 0x0a, 0x17, 0x27, 0x21, 0x9e, 0x00, 0x00, 0x28, 0x90, 0x00, 0x89, 0x00,
+	0x08, 0x08, 0x11, 0x11, 0x21, 0x9f, 0x03, 0x0a, 0x32, 0x10, 0x94, 0x00, 0x89, 0x00, 0x09, 0x08,
+	0x11, 0xa0, 0x13, 0xa1, 0x03, 0x06, 0x32, 0x55, 0x32, 0x93, 0x00, 0x89, 0x00, 0x01, 0x08, 0x18,
+	0x82, 0x03, 0x06, 0x17, 0x06, 0x0a, 0x33, 0x22, 0x22, 0xa2, 0x91, 0x00, 0x89, 0x00, 0x03, 0x08,
+	0x18, 0x03, 0x17, 0x82, 0x06, 0x05, 0x0a, 0x0a, 0x33, 0x22, 0x56, 0xa3, 0x90, 0x00, 0x89, 0x00,
+	0x03, 0x08, 0x11, 0x03, 0x17, 0x83, 0x06, 0x82, 0x0a, 0x02, 0x55, 0x56, 0x22, 0x8f, 0x00, 0x88,
+	0x00, 0x03, 0x1a, 0x08, 0x11, 0x18, 0x82, 0x10, 0x84, 0x03, 0x05, 0x06, 0x0a, 0xa4, 0x33, 0x24,
+	0x1a, 0x8c, 0x00, 0x87, 0x00, 0x01, 0x2d, 0x2a, 0x8e, 0x02, 0x02, 0x45, 0x0c, 0x52, 0x8b, 0x00,
+	0x87, 0x00, 0x05, 0x4e, 0x31, 0x04, 0xa5, 0x04, 0x31, 0x8a, 0x04, 0x02, 0x4a, 0xa6, 0x50, 0x8b,
+	0x00, 0x88, 0x00, 0x91, 0x01, 0x8c, 0x00, 0xa7, 0x00, 0xa7, 0x00
+};
+const omegaPackedImage icon_satellite_antenna = {40, 40, 167, 8, 0x00, icon_satellite_antenna_palette, icon_satellite_antenna_data, 0x01};
+
+// 'thermometer', 40x40px, 31 colours, 3200 -> 544 bytes
+const uint16_t icon_thermometer_palette[] PROGMEM = {
+	0x0000, 0x9aae, 0x87e2, 0xffff, 0x4a4a, 0x97fe, 0x45d8, 0x77fe, 0x56fe, 0x36fe, 0x59a6, 0x16fe,
+	0xb795, 0xec4a, 0x9695, 0x558d, 0xdff7, 0xaf6b, 0x3184, 0x36f6, 0x56f6, 0xb8ad, 0x2419, 0x4aeb,
+	0x32f5, 0x86d8, 0xc310, 0x6a3a, 0x768d, 0x8cca, 0x86e1
+};
+const uint8_t icon_thermometer_data[] PROGMEM = {
+	0xa7, 0x00, 0x91, 0x00, 0x03, 0x0d, 0x01, 0x01, 0x0e, 0x91, 0x00, 0x90, 0x00, 0x85, 0x01, 0x90,
+	0x00, 0x8f, 0x00, 0x00, 0x0f, 0x86, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x82, 0x01, 0x04, 0x03, 0x03,
+	0x10, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x02, 0x01, 0x11, 0x12, 0x82, 0x03, 0x01, 0x01, 0x01,
+	0x8f, 0x00, 0x8f, 0x00, 0x00, 0x01, 0x82, 0x04, 0x03, 0x03, 0x03, 0x01, 0x01, 0x8f, 0x00, 0x8f,
+	0x00, 0x01, 0x01, 0x01, 0x83, 0x03, 0x01, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x01, 0x01, 0x01,
+	0x83, 0x03, 0x01, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x01, 0x01, 0x01, 0x83, 0x03, 0x01, 0x01,
+	0x01, 0x8f, 0x00, 0x8f, 0x00, 0x00, 0x01, 0x82, 0x04, 0x03, 0x03, 0x03, 0x01, 0x01, 0x8f, 0x00,
+	0x8f, 0x00, 0x01, 0x01, 0x01, 0x83, 0x03, 0x01, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x01, 0x01,
+	0x01, 0x83, 0x03, 0x01, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x07, 0x01, 0x01, 0x05, 0x05, 0x02,
+	0x02, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x00, 0x01, 0x82, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01,
+	0x8f, 0x00, 0x8f, 0x00, 0x07, 0x01, 0x0a, 0x13, 0x07, 0x02, 0x02, 0x01, 0x01, 0x8f, 0x00, 0x8f,
+	0x00, 0x07, 0x01, 0x01, 0x05, 0x07, 0x02, 0x02, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x07, 0x01,
+	0x01, 0x05, 0x07, 0x02, 0x02, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x00, 0x01, 0x82, 0x04, 0x03,
+	0x02, 0x02, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x00, 0x01, 0x82, 0x04, 0x03, 0x02, 0x02, 0x01,
+	0x01, 0x8f, 0x00, 0x8f, 0x00, 0x07, 0x01, 0x01, 0x05, 0x08, 0x02, 0x02, 0x01, 0x01, 0x8f, 0x00,
+	0x8f, 0x00, 0x07, 0x01, 0x01, 0x05, 0x08, 0x02, 0x02, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x07,
+	0x01, 0x01, 0x14, 0x08, 0x02, 0x02, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x00, 0x01, 0x82, 0x04,
+	0x03, 0x02, 0x02, 0x01, 0x01, 0x8f, 0x00, 0x8f, 0x00, 0x07, 0x01, 0x01, 0x05, 0x09, 0x02, 0x02,
+	0x01, 0x01, 0x8f, 0x00, 0x8e, 0x00, 0x82, 0x01, 0x03, 0x05, 0x09, 0x02, 0x02, 0x82, 0x01, 0x8e,
+	0x00, 0x8d, 0x00, 0x83, 0x01, 0x03, 0x05, 0x09, 0x02, 0x02, 0x83, 0x01, 0x8d, 0x00, 0x8c, 0x00,
+	0x82, 0x01, 0x03, 0x02, 0x02, 0x05, 0x0b, 0x82, 0x02, 0x03, 0x15, 0x01, 0x01, 0x16, 0x8c, 0x00,
+	0x8c, 0x00, 0x82, 0x01, 0x03, 0x17, 0x05, 0x05, 0x0b, 0x82, 0x02, 0x00, 0x06, 0x82, 0x01, 0x8c,
+	0x00, 0x8c, 0x00, 0x02, 0x01, 0x01, 0x02, 0x82, 0x05, 0x00, 0x18, 0x83, 0x02, 0x02, 0x19, 0x01,
+	0x01, 0x8c, 0x00, 0x8b, 0x00, 0x82, 0x01, 0x00, 0x02, 0x82, 0x05, 0x84, 0x02, 0x03, 0x06, 0x01,
+	0x01, 0x1a, 0x8b, 0x00, 0x8b, 0x00, 0x82, 0x01, 0x88, 0x02, 0x03, 0x06, 0x01, 0x01, 0x1b, 0x8b,
+	0x00, 0x8b, 0x00, 0x02, 0x1c, 0x01, 0x01, 0x87, 0x02, 0x03, 0x06, 0x06, 0x01, 0x01, 0x8c, 0x00,
+	0x8c, 0x00, 0x02, 0x01, 0x01, 0x1d, 0x86, 0x02, 0x00, 0x06, 0x82, 0x01, 0x8c, 0x00, 0x8c, 0x00,
+	0x82, 0x01, 0x00, 0x06, 0x83, 0x02, 0x02, 0x1e, 0x06, 0x06, 0x82, 0x01, 0x8c, 0x00, 0x8d, 0x00,
+	0x82, 0x01, 0x85, 0x06, 0x82, 0x01, 0x8d, 0x00, 0x8d, 0x00, 0x00, 0x0c, 0x89, 0x01, 0x00, 0x0c,
+	0x8d, 0x00, 0x8f, 0x00, 0x87, 0x01, 0x8f, 0x00, 0x91, 0x00, 0x82, 0x01, 0x00, 0x0a, 0x91, 0x00,
+	0xa7, 0x00
+};
+const omegaPackedImage icon_thermometer = {40, 40, 31, 8, 0x00, icon_thermometer_palette, icon_thermometer_data, 0x01};
+
+// 'wifi-svgrepo-com', 40x40px, 34 colours, 3200 -> 478 bytes
+const uint16_t icon_wifi_palette[] PROGMEM = {
+	0x0000, 0x193c, 0x7def, 0x4b32, 0xf494, 0x0c1a, 0xae73, 0x9b8d, 0xdb9d, 0xea29, 0x384c, 0x2000,
+	0x694a, 0xf03a, 0x533b, 0xcf3a, 0xa921, 0xda64, 0x594c, 0xf83b, 0xb06b, 0x123b, 0x8d3a, 0x159d,
+	0x113b, 0xf594, 0x323b, 0x56a5, 0xcb5a, 0x4108, 0xfb9d, 0x494a, 0xdbde, 0xfbde
+};
+const uint8_t icon_wifi_data[] PROGMEM = {
+	0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0x91, 0x00, 0x03, 0x0a,
+	0x01, 0x01, 0x0a, 0x91, 0x00, 0x8d, 0x00, 0x00, 0x10, 0x89, 0x01, 0x00, 0x09, 0x8d, 0x00, 0x8c,
+	0x00, 0x8d, 0x01, 0x8c, 0x00, 0x8a, 0x00, 0x91, 0x01, 0x8a, 0x00, 0x89, 0x00, 0x93, 0x01, 0x89,
+	0x00, 0x88, 0x00, 0x95, 0x01, 0x88, 0x00, 0x83, 0x00, 0x00, 0x0b, 0x83, 0x05, 0x8d, 0x01, 0x00,
+	0x11, 0x86, 0x08, 0x83, 0x06, 0x84, 0x00, 0x01, 0x00, 0x00, 0x92, 0x01, 0x00, 0x12, 0x8f, 0x02,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x93, 0x01, 0x91, 0x02, 0x00, 0x00, 0x00, 0x09, 0x93, 0x01, 0x91,
+	0x02, 0x00, 0x0c, 0x84, 0x01, 0x06, 0x0d, 0x01, 0x01, 0x0e, 0x01, 0x01, 0x13, 0x88, 0x01, 0x83,
+	0x02, 0x00, 0x14, 0x83, 0x03, 0x89, 0x02, 0x84, 0x01, 0x0a, 0x03, 0x15, 0x01, 0x03, 0x03, 0x01,
+	0x03, 0x16, 0x01, 0x03, 0x03, 0x84, 0x01, 0x83, 0x02, 0x84, 0x03, 0x03, 0x02, 0x02, 0x03, 0x17,
+	0x85, 0x02, 0x84, 0x01, 0x06, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x88, 0x01, 0x83, 0x02,
+	0x01, 0x03, 0x04, 0x8c, 0x02, 0x84, 0x01, 0x0a, 0x0f, 0x03, 0x18, 0x03, 0x03, 0x01, 0x03, 0x01,
+	0x01, 0x03, 0x03, 0x84, 0x01, 0x83, 0x02, 0x01, 0x03, 0x04, 0x84, 0x02, 0x01, 0x03, 0x19, 0x85,
+	0x02, 0x85, 0x01, 0x85, 0x03, 0x03, 0x01, 0x01, 0x03, 0x03, 0x84, 0x01, 0x83, 0x02, 0x84, 0x03,
+	0x03, 0x02, 0x02, 0x03, 0x04, 0x85, 0x02, 0x85, 0x01, 0x02, 0x03, 0x03, 0x0d, 0x82, 0x03, 0x03,
+	0x01, 0x01, 0x03, 0x03, 0x84, 0x01, 0x83, 0x02, 0x01, 0x03, 0x04, 0x84, 0x02, 0x01, 0x03, 0x04,
+	0x85, 0x02, 0x85, 0x01, 0x04, 0x03, 0x03, 0x01, 0x03, 0x03, 0x82, 0x01, 0x01, 0x03, 0x03, 0x84,
+	0x01, 0x83, 0x02, 0x01, 0x03, 0x04, 0x84, 0x02, 0x01, 0x03, 0x04, 0x85, 0x02, 0x85, 0x01, 0x04,
+	0x03, 0x03, 0x01, 0x1a, 0x03, 0x82, 0x01, 0x01, 0x03, 0x03, 0x84, 0x01, 0x83, 0x02, 0x01, 0x03,
+	0x04, 0x84, 0x02, 0x01, 0x03, 0x04, 0x85, 0x02, 0x00, 0x09, 0x85, 0x01, 0x03, 0x0e, 0x01, 0x01,
+	0x0f, 0x89, 0x01, 0x83, 0x02, 0x00, 0x1b, 0x85, 0x02, 0x00, 0x03, 0x85, 0x02, 0x00, 0x1c, 0x00,
+	0x00, 0x92, 0x01, 0x92, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x91, 0x01, 0x91, 0x02, 0x01, 0x00,
+	0x00, 0x83, 0x00, 0x00, 0x1d, 0x83, 0x05, 0x87, 0x07, 0x00, 0x1e, 0x8c, 0x02, 0x83, 0x06, 0x00,
+	0x0b, 0x83, 0x00, 0x88, 0x00, 0x95, 0x02, 0x88, 0x00, 0x89, 0x00, 0x93, 0x02, 0x89, 0x00, 0x8a,
+	0x00, 0x91, 0x02, 0x8a, 0x00, 0x8c, 0x00, 0x8d, 0x02, 0x8c, 0x00, 0x8d, 0x00, 0x00, 0x0c, 0x89,
+	0x02, 0x00, 0x1f, 0x8d, 0x00, 0x91, 0x00, 0x03, 0x20, 0x02, 0x02, 0x21, 0x91, 0x00, 0xa7, 0x00,
+	0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00, 0xa7, 0x00
+};
+const omegaPackedImage icon_wifi = {40, 40, 34, 8, 0x00, icon_wifi_palette, icon_wifi_data, 0x01};
+
+// 'sunglasses', 50x10px, 7 colours, 1000 -> 162 bytes
+const uint16_t icon_sunglasses_palette[] PROGMEM = {
+	0xc318, 0x0000, 0xffff, 0x18c6, 0x3084, 0x0c63, 0xdbde
+};
+const uint8_t icon_sunglasses_data[] PROGMEM = {
+	0xb1, 0x00, 0xb1, 0x00, 0x83, 0x00, 0x05, 0x22, 0x00, 0x23, 0x8c, 0x00, 0x83, 0x01, 0x83, 0x00,
+	0x05, 0x22, 0x00, 0x22, 0x8c, 0x00, 0x83, 0x00, 0x05, 0x22, 0x00, 0x23, 0x8c, 0x00, 0x83, 0x01,
+	0x83, 0x00, 0x05, 0x22, 0x00, 0x22, 0x8c, 0x00, 0x01, 0x11, 0x83, 0x00, 0x05, 0x22, 0x04, 0x25,
+	0x8a, 0x00, 0x83, 0x01, 0x85, 0x00, 0x05, 0x22, 0x00, 0x22, 0x88, 0x00, 0x01, 0x11, 0x01, 0x11,
+	0x83, 0x00, 0x05, 0x22, 0x04, 0x25, 0x8a, 0x00, 0x83, 0x01, 0x85, 0x00, 0x05, 0x22, 0x00, 0x22,
+	0x88, 0x00, 0x01, 0x11, 0x83, 0x01, 0x83, 0x00, 0x04, 0x23, 0x06, 0x20, 0x87, 0x00, 0x87, 0x01,
+	0x85, 0x00, 0x04, 0x22, 0x00, 0x20, 0x85, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x00, 0x04, 0x23,
+	0x06, 0x20, 0x87, 0x00, 0x87, 0x01, 0x85, 0x00, 0x04, 0x22, 0x00, 0x20, 0x85, 0x00, 0x83, 0x01,
+	0x85, 0x01, 0x8c, 0x00, 0x8b, 0x01, 0x8c, 0x00, 0x85, 0x01, 0x85, 0x01, 0x8c, 0x00, 0x8b, 0x01,
+	0x8c, 0x00, 0x85, 0x01
+};
+const omegaPackedImage icon_sunglasses = {50, 10, 7, 4, 0x01, icon_sunglasses_palette, icon_sunglasses_data, 0x01};
+
+// 'potted-plant', 40x40px, 256 colours, 3200 -> 1457 bytes
+const uint16_t icon_potted_plant_palette[] PROGMEM = {
+	0x0000, 0xa279, 0x6bbe, 0x2000, 0xe7ad, 0x819a, 0x60bb, 0x6cbe, 0x6695, 0xa595, 0x4123, 0xa13b,
+	0x6164, 0x411b, 0x8008, 0x4bbe, 0xe181, 0x20b3, 0x6000, 0xe008, 0xc8a5, 0x214c, 0xe9ad, 0x4154,
+	0x858d, 0xc7a5, 0x08b6, 0xe019, 0x415c, 0xc019, 0xc13b, 0xa008, 0x2375, 0x0585, 0x468d, 0xa16c,
+	0x226d, 0x8485, 0x0144, 0x613b, 0x2ab6, 0x00ab, 0x4000, 0x4011, 0x0122, 0x8164, 0xa133, 0x615c,
+	0x812b, 0x014c, 0xa36c, 0x813b, 0xe6a5, 0x6011, 0x637d, 0x202a, 0xc69d, 0x4192, 0xe281, 0xc181,
+	0x2154, 0x6133, 0xe474, 0xc274, 0x413b, 0x4022, 0xc16c, 0x6123, 0x215c, 0x437d, 0xa79d, 0x612b,
+	0xc143, 0x2254, 0xe8ad, 0x816c, 0x0011, 0x0265, 0xa69d, 0x837d, 0x447d, 0xa15c, 0x4385, 0xa143,
+	0x658d, 0x4275, 0xa02a, 0x035c, 0x268d, 0xacc6, 0xc7ad, 0x6375, 0x07ae, 0x8bc6, 0xe26c, 0x028a,
+	0x6161, 0xc0a2, 0x4159, 0x018a, 0x40b3, 0x60b3, 0x40bb, 0x208a, 0xc24b, 0xe12a, 0xc132, 0x8122,
+	0x4364, 0xa12a, 0xe13b, 0xe57c, 0x435c, 0x4bb6, 0xe253, 0xa243, 0xe15c, 0x0154, 0xe14b, 0x879d,
+	0xa12b, 0x027d, 0xa264, 0xa019, 0x802a, 0xe353, 0xa474, 0xc26c, 0xc12a, 0x402a, 0x8cc6, 0xe264,
+	0xa485, 0x4ab6, 0xa14b, 0xa58d, 0xc6a5, 0x09ae, 0xc021, 0x2132, 0x6159, 0xa19a, 0x0133, 0xc1a2,
+	0x4282, 0xc39a, 0x02a3, 0x23ab, 0xa39a, 0xa271, 0x628a, 0xe0a2, 0xc279, 0x027a, 0x0282, 0xa0a2,
+	0x408a, 0xc030, 0x4092, 0xc281, 0xe3a2, 0x62b3, 0x6292, 0x4018, 0x03a3, 0x6092, 0xa030, 0x2011,
+	0x8133, 0x602a, 0xc9a5, 0x4585, 0x4254, 0x611b, 0x0354, 0xa7a5, 0xe8a5, 0xe9a5, 0xc15c, 0xc595,
+	0x411a, 0xc153, 0xe36c, 0x2265, 0x414c, 0x247d, 0x29b6, 0x4375, 0x6585, 0xe021, 0x0475, 0x08ae,
+	0x6485, 0xa139, 0xc139, 0x8143, 0x258d, 0x0254, 0x615b, 0xc182, 0x6192, 0x2159, 0x016a, 0x825b,
+	0xc79d, 0xe263, 0x01a3, 0x8169, 0xe271, 0xc58a, 0x8385, 0x6254, 0x647d, 0x0183, 0xe0aa, 0x8271,
+	0x6482, 0x2472, 0x625c, 0x848a, 0xa392, 0x8392, 0x858a, 0x8582, 0xc261, 0x8269, 0x0022, 0xa24b,
+	0xc492, 0x218a, 0xe279, 0xa169, 0x8161, 0xe171, 0x4151, 0x0141, 0x61b3, 0x428a, 0xc028, 0x4010,
+	0x20ab, 0xa09a, 0x809a, 0x2010, 0x63b3, 0x8092, 0xa292, 0x2008, 0x00b3, 0x228a, 0x0182, 0xa179,
+	0xc271, 0x8028, 0xa028, 0x6018
+};
+const uint8_t icon_potted_plant_data[] PROGMEM = {
+	0xa7, 0x00, 0x93, 0x00, 0x01, 0x12, 0x2a, 0x91, 0x00, 0x92, 0x00, 0x02, 0x03, 0x68, 0x2b, 0x91,
+	0x00, 0x92, 0x00, 0x02, 0x0b, 0x0c, 0x2c, 0x91, 0x00, 0x91, 0x00, 0x03, 0x69, 0x3c, 0x2d, 0x6a,
+	0x87, 0x00, 0x02, 0x13, 0x1b, 0x13, 0x86, 0x00, 0x90, 0x00, 0x04, 0x6b, 0x2e, 0x1c, 0x2f, 0x3d,
+	0x85, 0x00, 0x03, 0x1d, 0x6c, 0x3e, 0x6d, 0x87, 0x00, 0x8f, 0x00, 0x05, 0x03, 0x0a, 0x6e, 0x3f,
+	0x1c, 0x30, 0x83, 0x00, 0x04, 0x1b, 0x6f, 0x08, 0x14, 0x40, 0x88, 0x00, 0x8f, 0x00, 0x0d, 0x41,
+	0x0d, 0x15, 0x42, 0x31, 0x43, 0x00, 0x00, 0x1b, 0x32, 0x08, 0x16, 0x02, 0x70, 0x89, 0x00, 0x8a,
+	0x00, 0x12, 0x13, 0x2b, 0x2b, 0x2a, 0x00, 0x0a, 0x30, 0x0c, 0x0c, 0x1e, 0x0d, 0x1f, 0x0b, 0x20,
+	0x09, 0x16, 0x02, 0x6f, 0x0e, 0x89, 0x00, 0x88, 0x00, 0x16, 0x2c, 0x21, 0x08, 0x22, 0x21, 0x32,
+	0x2c, 0x0d, 0x2e, 0x23, 0x44, 0x30, 0x0d, 0x33, 0x24, 0x25, 0x71, 0x07, 0x08, 0x1b, 0x00, 0x03,
+	0x2a, 0x83, 0x0e, 0x00, 0x12, 0x82, 0x00, 0x87, 0x00, 0x03, 0x72, 0x22, 0x0f, 0x02, 0x82, 0x07,
+	0x15, 0x0f, 0x73, 0x26, 0x42, 0x15, 0x43, 0x0a, 0x74, 0x45, 0x02, 0x07, 0x46, 0x6c, 0x6b, 0x47,
+	0x0b, 0x75, 0x1c, 0x0c, 0x44, 0x48, 0x03, 0x82, 0x00, 0x85, 0x00, 0x1d, 0x1f, 0x49, 0x14, 0x16,
+	0x16, 0x4a, 0x14, 0x46, 0x14, 0x02, 0x07, 0x70, 0x3f, 0x76, 0x0d, 0x26, 0x20, 0x07, 0x07, 0x16,
+	0x77, 0x47, 0x78, 0x17, 0x3f, 0x79, 0x4b, 0x1c, 0x48, 0x2a, 0x83, 0x00, 0x84, 0x00, 0x1d, 0x4c,
+	0x17, 0x4d, 0x20, 0x18, 0x4e, 0x04, 0x04, 0x34, 0x09, 0x4f, 0x50, 0x0f, 0x7a, 0x15, 0x0d, 0x51,
+	0x0f, 0x07, 0x0f, 0x04, 0x21, 0x26, 0x52, 0x52, 0x23, 0x4b, 0x17, 0x53, 0x03, 0x84, 0x00, 0x83,
+	0x00, 0x1c, 0x35, 0x27, 0x69, 0x41, 0x7b, 0x35, 0x2c, 0x73, 0x3e, 0x22, 0x54, 0x36, 0x55, 0x4d,
+	0x22, 0x26, 0x0d, 0x32, 0x16, 0x71, 0x19, 0x19, 0x0b, 0x52, 0x79, 0x23, 0x2d, 0x3c, 0x0b, 0x86,
+	0x00, 0x8c, 0x00, 0x13, 0x4c, 0x7c, 0x40, 0x15, 0x51, 0x17, 0x3d, 0x56, 0x7d, 0x7d, 0x7e, 0x21,
+	0x08, 0x45, 0x7f, 0x23, 0x0c, 0x31, 0x0b, 0x12, 0x86, 0x00, 0x87, 0x00, 0x17, 0x13, 0x80, 0x1e,
+	0x75, 0x1c, 0x44, 0x40, 0x81, 0x81, 0x37, 0x7c, 0x56, 0x57, 0x82, 0x14, 0x08, 0x77, 0x58, 0x49,
+	0x3c, 0x2f, 0x26, 0x2e, 0xa7, 0x87, 0x00, 0x85, 0x00, 0x18, 0x03, 0x0a, 0x47, 0x6e, 0x17, 0x0c,
+	0x23, 0x2d, 0x15, 0xa8, 0x6a, 0x56, 0xa9, 0x37, 0xaa, 0x82, 0x59, 0x59, 0x02, 0x5a, 0x34, 0xab,
+	0xac, 0x3d, 0x35, 0x88, 0x00, 0x84, 0x00, 0x18, 0x1f, 0x0a, 0x43, 0x1e, 0x2f, 0x7f, 0x42, 0x2d,
+	0x15, 0x1e, 0x30, 0x33, 0x7e, 0x3e, 0x58, 0x83, 0x36, 0x18, 0x46, 0x0f, 0x59, 0x28, 0x38, 0x25,
+	0x49, 0x89, 0x00, 0x84, 0x00, 0x19, 0x0a, 0xad, 0x1e, 0x31, 0x0c, 0x4b, 0x2f, 0x31, 0x78, 0xae,
+	0x08, 0xaf, 0xb0, 0x02, 0xb1, 0xb2, 0x5b, 0x84, 0xb3, 0x04, 0x5a, 0x07, 0x85, 0x09, 0x20, 0x41,
+	0x88, 0x00, 0x83, 0x00, 0x1b, 0xb4, 0x0a, 0x2e, 0x53, 0x86, 0x86, 0xb5, 0x48, 0x0b, 0x22, 0x5a,
+	0x04, 0x02, 0x02, 0x14, 0x24, 0x53, 0x24, 0x4f, 0x87, 0x88, 0x5c, 0x1a, 0x0f, 0x28, 0x25, 0xb6,
+	0x13, 0x87, 0x00, 0x83, 0x00, 0x02, 0x0a, 0x6d, 0x12, 0x83, 0x00, 0x14, 0x27, 0x54, 0x04, 0x4a,
+	0x5d, 0x02, 0x18, 0x36, 0xb7, 0x1d, 0xb8, 0x55, 0x84, 0x38, 0x04, 0x1a, 0x1a, 0x28, 0x85, 0x36,
+	0x17, 0x87, 0x00, 0x82, 0x00, 0x01, 0x1d, 0x03, 0x84, 0x00, 0x16, 0x1d, 0xb9, 0x38, 0xba, 0x5d,
+	0x89, 0x38, 0x25, 0x55, 0x74, 0x1d, 0x7b, 0x76, 0xbb, 0x09, 0x34, 0x5c, 0x1a, 0x04, 0x28, 0xbc,
+	0x24, 0x80, 0x86, 0x00, 0x88, 0x00, 0x18, 0x2b, 0x20, 0x09, 0x02, 0x5d, 0x4a, 0x34, 0x87, 0x4f,
+	0x4d, 0x33, 0xbd, 0x8a, 0x8a, 0x27, 0xbe, 0x09, 0x04, 0x1a, 0x5c, 0x88, 0x02, 0x5b, 0x51, 0x03,
+	0x85, 0x00, 0x87, 0x00, 0x19, 0x12, 0x83, 0x25, 0x02, 0x89, 0xbf, 0x04, 0x09, 0xc0, 0x5e, 0x33,
+	0x8b, 0x8b, 0x37, 0x37, 0xc1, 0xc2, 0xc3, 0x21, 0x08, 0x19, 0x04, 0x09, 0x18, 0x24, 0x1b, 0x85,
+	0x00, 0x87, 0x00, 0x19, 0x27, 0x45, 0x28, 0x19, 0x1a, 0x19, 0xc4, 0xc5, 0xc6, 0xc7, 0x05, 0x05,
+	0xc8, 0x39, 0x5f, 0x01, 0x60, 0xc9, 0x8c, 0xca, 0xcb, 0x58, 0x4e, 0x09, 0x5b, 0x27, 0x85, 0x00,
+	0x86, 0x00, 0x08, 0x1f, 0x5e, 0xcc, 0x4e, 0x19, 0x08, 0xcd, 0xce, 0x61, 0x82, 0x05, 0x0e, 0x8d,
+	0x05, 0x39, 0x10, 0x01, 0xcf, 0x62, 0x62, 0xd0, 0xd1, 0x0e, 0x57, 0x18, 0xd2, 0xd3, 0x85, 0x00,
+	0x86, 0x00, 0x1b, 0x8e, 0xd4, 0x18, 0x54, 0x57, 0xd5, 0x11, 0x11, 0xd6, 0x8d, 0x05, 0x8f, 0x8f,
+	0x05, 0x39, 0x10, 0x01, 0xd7, 0x60, 0x60, 0xd8, 0xd9, 0x00, 0x00, 0x8e, 0x50, 0x5e, 0x12, 0x84,
+	0x00, 0x86, 0x00, 0x15, 0xda, 0x50, 0x72, 0x0e, 0x00, 0x00, 0xdb, 0x90, 0xdc, 0x91, 0x92, 0x93,
+	0x93, 0x92, 0x94, 0xdd, 0xde, 0xdf, 0xe0, 0x8c, 0xe1, 0x03, 0x82, 0x00, 0x02, 0xe2, 0x32, 0x13,
+	0x84, 0x00, 0x85, 0x00, 0x02, 0x03, 0x7a, 0xe3, 0x83, 0x00, 0x07, 0xe4, 0x05, 0x39, 0xe5, 0x63,
+	0x3a, 0x3a, 0xe6, 0x83, 0x01, 0x02, 0x95, 0xe7, 0x95, 0x84, 0x00, 0x01, 0x35, 0x4c, 0x84, 0x00,
+	0x85, 0x00, 0x01, 0x03, 0x68, 0x84, 0x00, 0x00, 0x96, 0x82, 0x29, 0x03, 0x97, 0x05, 0x63, 0x3b,
+	0x83, 0x01, 0x02, 0x98, 0x99, 0xe8, 0x8b, 0x00, 0x85, 0x00, 0x01, 0x03, 0x1f, 0x84, 0x00, 0x08,
+	0xe9, 0x64, 0x65, 0x06, 0x06, 0x29, 0x05, 0x63, 0x3b, 0x82, 0x01, 0x02, 0x9a, 0x96, 0x62, 0x8b,
+	0x00, 0x8c, 0x00, 0x01, 0xea, 0x65, 0x82, 0x06, 0x09, 0x64, 0x9b, 0x9c, 0x10, 0x01, 0x01, 0x98,
+	0x5f, 0x91, 0xeb, 0x8b, 0x00, 0x8c, 0x00, 0x01, 0x9d, 0xec, 0x82, 0x06, 0x09, 0x11, 0x9b, 0x9e,
+	0x10, 0x01, 0x01, 0x9f, 0xed, 0xa0, 0xee, 0x8b, 0x00, 0x8c, 0x00, 0x0e, 0xef, 0xa1, 0x65, 0x06,
+	0x06, 0xf0, 0xf1, 0x9e, 0x10, 0x01, 0x01, 0x3a, 0xa2, 0xa0, 0xa3, 0x8b, 0x00, 0x8d, 0x00, 0x0d,
+	0xa1, 0x64, 0x06, 0x66, 0x29, 0xf2, 0x9c, 0x10, 0x01, 0x01, 0x9a, 0xa2, 0xa4, 0xf3, 0x8b, 0x00,
+	0x8d, 0x00, 0x0d, 0xf4, 0x11, 0x66, 0x11, 0x97, 0xf5, 0x67, 0x10, 0x01, 0x01, 0x5f, 0xf6, 0xa4,
+	0xf7, 0x8b, 0x00, 0x8d, 0x00, 0x0c, 0x90, 0x11, 0x66, 0xf8, 0x61, 0xa5, 0x67, 0x3b, 0x01, 0x9f,
+	0xf9, 0x94, 0x99, 0x8c, 0x00, 0x8e, 0x00, 0x0a, 0xa6, 0xfa, 0x11, 0x61, 0xa5, 0x67, 0x3b, 0xfb,
+	0x3a, 0xfc, 0x9d, 0x8d, 0x00, 0x91, 0x00, 0x04, 0xa3, 0xfd, 0xa6, 0xfe, 0xff, 0x90, 0x00, 0xa7,
+	0x00
+};
+const omegaPackedImage icon_potted_plant = {40, 40, 256, 8, 0x00, icon_potted_plant_palette, icon_potted_plant_data, 0x01};
+
+// 'Plant2', 120x120px, 10 colours, 28800 -> 1810 bytes
+const uint16_t icon_vase_plant_palette[] PROGMEM = {
+	0x0000, 0x4531, 0x0522, 0x2923, 0x2c34, 0xa570, 0x05b1, 0x715d, 0xbccf, 0xf796
+};
+const uint8_t icon_vase_plant_data[] PROGMEM = {
+	0xad, 0x00, 0x84, 0x01, 0xc4, 0x00, 0xad, 0x00, 0x84, 0x01, 0xc4, 0x00, 0xad, 0x00, 0x84, 0x01,
+	0xc4, 0x00, 0xad, 0x00, 0x84, 0x01, 0xc4, 0x00, 0xad, 0x00, 0x84, 0x01, 0xc4, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x06, 0x84, 0x01, 0x84, 0x00, 0x85, 0x01, 0xb4, 0x00, 0xa8, 0x00, 0x84, 0x01,
+	0x84, 0x06, 0x84, 0x01, 0x84, 0x00, 0x85, 0x01, 0xb4, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x06,
+	0x84, 0x01, 0x84, 0x00, 0x85, 0x01, 0xb4, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x06, 0x84, 0x01,
+	0x84, 0x00, 0x85, 0x01, 0xb4, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x06, 0x84, 0x01, 0x84, 0x00,
+	0x85, 0x01, 0xb4, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x06, 0x84, 0x01, 0x84, 0x00, 0x85, 0x01,
+	0xb4, 0x00, 0xa2, 0x00, 0x85, 0x01, 0x84, 0x06, 0x84, 0x05, 0x89, 0x01, 0x85, 0x06, 0x84, 0x01,
+	0xaf, 0x00, 0xa2, 0x00, 0x85, 0x01, 0x84, 0x06, 0x84, 0x05, 0x89, 0x01, 0x85, 0x06, 0x84, 0x01,
+	0xaf, 0x00, 0xa2, 0x00, 0x85, 0x01, 0x84, 0x06, 0x84, 0x05, 0x89, 0x01, 0x85, 0x06, 0x84, 0x01,
+	0xaf, 0x00, 0xa2, 0x00, 0x85, 0x01, 0x84, 0x06, 0x84, 0x05, 0x89, 0x01, 0x85, 0x06, 0x84, 0x01,
+	0xaf, 0x00, 0xa2, 0x00, 0x85, 0x01, 0x84, 0x06, 0x84, 0x05, 0x89, 0x01, 0x85, 0x06, 0x84, 0x01,
+	0xaf, 0x00, 0xa8, 0x00, 0x89, 0x01, 0x84, 0x00, 0x84, 0x01, 0x8a, 0x05, 0x84, 0x01, 0xaa, 0x00,
+	0xa8, 0x00, 0x89, 0x01, 0x84, 0x00, 0x84, 0x01, 0x8a, 0x05, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x89, 0x01, 0x84, 0x00, 0x84, 0x01, 0x8a, 0x05, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x89, 0x01,
+	0x84, 0x00, 0x84, 0x01, 0x8a, 0x05, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x89, 0x01, 0x84, 0x00,
+	0x84, 0x01, 0x8a, 0x05, 0x84, 0x01, 0xaa, 0x00, 0xad, 0x00, 0x84, 0x01, 0x84, 0x00, 0x8f, 0x01,
+	0xaf, 0x00, 0xad, 0x00, 0x84, 0x01, 0x84, 0x00, 0x8f, 0x01, 0xaf, 0x00, 0xad, 0x00, 0x84, 0x01,
+	0x84, 0x00, 0x8f, 0x01, 0xaf, 0x00, 0xad, 0x00, 0x84, 0x01, 0x84, 0x00, 0x8f, 0x01, 0xaf, 0x00,
+	0xad, 0x00, 0x84, 0x01, 0x84, 0x00, 0x8f, 0x01, 0xaf, 0x00, 0xad, 0x00, 0x84, 0x01, 0x84, 0x00,
+	0x84, 0x01, 0xba, 0x00, 0xad, 0x00, 0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0xba, 0x00, 0xad, 0x00,
+	0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0xba, 0x00, 0xad, 0x00, 0x84, 0x01, 0x84, 0x00, 0x84, 0x01,
+	0xba, 0x00, 0xad, 0x00, 0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0xba, 0x00, 0xa2, 0x00, 0x85, 0x01,
+	0x84, 0x00, 0x8e, 0x01, 0x85, 0x00, 0x93, 0x01, 0xa0, 0x00, 0xa2, 0x00, 0x85, 0x01, 0x84, 0x00,
+	0x8e, 0x01, 0x85, 0x00, 0x93, 0x01, 0xa0, 0x00, 0xa2, 0x00, 0x85, 0x01, 0x84, 0x00, 0x8e, 0x01,
+	0x85, 0x00, 0x93, 0x01, 0xa0, 0x00, 0xa2, 0x00, 0x85, 0x01, 0x84, 0x00, 0x8e, 0x01, 0x85, 0x00,
+	0x93, 0x01, 0xa0, 0x00, 0xa2, 0x00, 0x85, 0x01, 0x84, 0x00, 0x8e, 0x01, 0x85, 0x00, 0x93, 0x01,
+	0xa0, 0x00, 0xa2, 0x00, 0x85, 0x01, 0x84, 0x00, 0x8e, 0x01, 0x85, 0x00, 0x93, 0x01, 0xa0, 0x00,
+	0x9d, 0x00, 0x84, 0x01, 0x85, 0x06, 0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01,
+	0x89, 0x00, 0x8a, 0x01, 0x9a, 0x00, 0x9d, 0x00, 0x84, 0x01, 0x85, 0x06, 0x84, 0x01, 0x84, 0x00,
+	0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x89, 0x00, 0x8a, 0x01, 0x9a, 0x00, 0x9d, 0x00, 0x84, 0x01,
+	0x85, 0x06, 0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x89, 0x00, 0x8a, 0x01,
+	0x9a, 0x00, 0x9d, 0x00, 0x84, 0x01, 0x85, 0x06, 0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0x8a, 0x00,
+	0x84, 0x01, 0x89, 0x00, 0x8a, 0x01, 0x9a, 0x00, 0x9d, 0x00, 0x84, 0x01, 0x85, 0x06, 0x84, 0x01,
+	0x84, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x89, 0x00, 0x8a, 0x01, 0x9a, 0x00, 0x98, 0x00,
+	0x84, 0x01, 0x84, 0x06, 0x85, 0x05, 0x84, 0x01, 0x84, 0x00, 0x9e, 0x01, 0x84, 0x06, 0x85, 0x05,
+	0x84, 0x01, 0x95, 0x00, 0x98, 0x00, 0x84, 0x01, 0x84, 0x06, 0x85, 0x05, 0x84, 0x01, 0x84, 0x00,
+	0x9e, 0x01, 0x84, 0x06, 0x85, 0x05, 0x84, 0x01, 0x95, 0x00, 0x98, 0x00, 0x84, 0x01, 0x84, 0x06,
+	0x85, 0x05, 0x84, 0x01, 0x84, 0x00, 0x9e, 0x01, 0x84, 0x06, 0x85, 0x05, 0x84, 0x01, 0x95, 0x00,
+	0x98, 0x00, 0x84, 0x01, 0x84, 0x06, 0x85, 0x05, 0x84, 0x01, 0x84, 0x00, 0x9e, 0x01, 0x84, 0x06,
+	0x85, 0x05, 0x84, 0x01, 0x95, 0x00, 0x98, 0x00, 0x84, 0x01, 0x84, 0x06, 0x85, 0x05, 0x84, 0x01,
+	0x84, 0x00, 0x9e, 0x01, 0x84, 0x06, 0x85, 0x05, 0x84, 0x01, 0x95, 0x00, 0x9d, 0x00, 0x94, 0x01,
+	0x84, 0x00, 0x84, 0x01, 0x85, 0x06, 0x84, 0x05, 0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0x85, 0x05,
+	0x84, 0x01, 0x95, 0x00, 0x9d, 0x00, 0x94, 0x01, 0x84, 0x00, 0x84, 0x01, 0x85, 0x06, 0x84, 0x05,
+	0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0x85, 0x05, 0x84, 0x01, 0x95, 0x00, 0x9d, 0x00, 0x94, 0x01,
+	0x84, 0x00, 0x84, 0x01, 0x85, 0x06, 0x84, 0x05, 0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0x85, 0x05,
+	0x84, 0x01, 0x95, 0x00, 0x9d, 0x00, 0x94, 0x01, 0x84, 0x00, 0x84, 0x01, 0x85, 0x06, 0x84, 0x05,
+	0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0x85, 0x05, 0x84, 0x01, 0x95, 0x00, 0x9d, 0x00, 0x94, 0x01,
+	0x84, 0x00, 0x84, 0x01, 0x85, 0x06, 0x84, 0x05, 0x84, 0x01, 0x84, 0x00, 0x84, 0x01, 0x85, 0x05,
+	0x84, 0x01, 0x95, 0x00, 0xad, 0x00, 0x89, 0x01, 0x84, 0x00, 0x85, 0x01, 0x84, 0x05, 0x84, 0x01,
+	0x89, 0x00, 0x85, 0x01, 0x9a, 0x00, 0xad, 0x00, 0x89, 0x01, 0x84, 0x00, 0x85, 0x01, 0x84, 0x05,
+	0x84, 0x01, 0x89, 0x00, 0x85, 0x01, 0x9a, 0x00, 0xad, 0x00, 0x89, 0x01, 0x84, 0x00, 0x85, 0x01,
+	0x84, 0x05, 0x84, 0x01, 0x89, 0x00, 0x85, 0x01, 0x9a, 0x00, 0xad, 0x00, 0x89, 0x01, 0x84, 0x00,
+	0x85, 0x01, 0x84, 0x05, 0x84, 0x01, 0x89, 0x00, 0x85, 0x01, 0x9a, 0x00, 0xad, 0x00, 0x89, 0x01,
+	0x84, 0x00, 0x85, 0x01, 0x84, 0x05, 0x84, 0x01, 0x89, 0x00, 0x85, 0x01, 0x9a, 0x00, 0xad, 0x00,
+	0x89, 0x01, 0x84, 0x00, 0x85, 0x01, 0x84, 0x05, 0x84, 0x01, 0x89, 0x00, 0x85, 0x01, 0x9a, 0x00,
+	0xad, 0x00, 0x84, 0x01, 0x89, 0x00, 0x8a, 0x01, 0xaf, 0x00, 0xad, 0x00, 0x84, 0x01, 0x89, 0x00,
+	0x8a, 0x01, 0xaf, 0x00, 0xad, 0x00, 0x84, 0x01, 0x89, 0x00, 0x8a, 0x01, 0xaf, 0x00, 0xad, 0x00,
+	0x84, 0x01, 0x89, 0x00, 0x8a, 0x01, 0xaf, 0x00, 0xad, 0x00, 0x84, 0x01, 0x89, 0x00, 0x8a, 0x01,
+	0xaf, 0x00, 0xa2, 0x00, 0xae, 0x01, 0xa5, 0x00, 0xa2, 0x00, 0xae, 0x01, 0xa5, 0x00, 0xa2, 0x00,
+	0xae, 0x01, 0xa5, 0x00, 0xa2, 0x00, 0xae, 0x01, 0xa5, 0x00, 0xa2, 0x00, 0xae, 0x01, 0xa5, 0x00,
+	0xa8, 0x00, 0x84, 0x01, 0x84, 0x08, 0x84, 0x02, 0x84, 0x08, 0x85, 0x02, 0x84, 0x09, 0x84, 0x01,
+	0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x08, 0x84, 0x02, 0x84, 0x08, 0x85, 0x02, 0x84, 0x09,
+	0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x08, 0x84, 0x02, 0x84, 0x08, 0x85, 0x02,
+	0x84, 0x09, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x08, 0x84, 0x02, 0x84, 0x08,
+	0x85, 0x02, 0x84, 0x09, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x08, 0x84, 0x02,
+	0x84, 0x08, 0x85, 0x02, 0x84, 0x09, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x08,
+	0x84, 0x02, 0x84, 0x09, 0x85, 0x02, 0x84, 0x07, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01,
+	0x84, 0x08, 0x84, 0x02, 0x84, 0x09, 0x85, 0x02, 0x84, 0x07, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x08, 0x84, 0x02, 0x84, 0x09, 0x85, 0x02, 0x84, 0x07, 0x84, 0x01, 0xaa, 0x00,
+	0xa8, 0x00, 0x84, 0x01, 0x84, 0x08, 0x84, 0x02, 0x84, 0x09, 0x85, 0x02, 0x84, 0x07, 0x84, 0x01,
+	0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x08, 0x84, 0x02, 0x84, 0x09, 0x85, 0x02, 0x84, 0x07,
+	0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x02, 0x84, 0x04, 0x85, 0x02,
+	0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x02, 0x84, 0x04,
+	0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x02,
+	0x84, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07,
+	0x84, 0x02, 0x84, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01,
+	0x84, 0x07, 0x84, 0x02, 0x84, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x07, 0x84, 0x02, 0x84, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00,
+	0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x02, 0x84, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01,
+	0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x02, 0x84, 0x04, 0x85, 0x02, 0x84, 0x03,
+	0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x02, 0x84, 0x04, 0x85, 0x02,
+	0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x02, 0x84, 0x04,
+	0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x02,
+	0x84, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07,
+	0x84, 0x04, 0x84, 0x02, 0x85, 0x04, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01,
+	0x84, 0x07, 0x84, 0x04, 0x84, 0x02, 0x85, 0x04, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x07, 0x84, 0x04, 0x84, 0x02, 0x85, 0x04, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00,
+	0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x04, 0x84, 0x02, 0x85, 0x04, 0x84, 0x03, 0x84, 0x01,
+	0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x04, 0x84, 0x02, 0x85, 0x04, 0x84, 0x03,
+	0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x04, 0x84, 0x02, 0x85, 0x04,
+	0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x04, 0x84, 0x02,
+	0x85, 0x04, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07, 0x84, 0x04,
+	0x84, 0x02, 0x85, 0x04, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01, 0x84, 0x07,
+	0x84, 0x04, 0x84, 0x02, 0x85, 0x04, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0x84, 0x01,
+	0x84, 0x07, 0x84, 0x04, 0x84, 0x02, 0x85, 0x04, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x07, 0x89, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x07, 0x89, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x07, 0x89, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x07, 0x89, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x07, 0x89, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x07, 0x89, 0x04, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x04, 0x89, 0x03, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x04, 0x89, 0x03, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x04, 0x89, 0x03, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x04, 0x89, 0x03, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xa8, 0x00,
+	0x84, 0x01, 0x84, 0x04, 0x89, 0x03, 0x85, 0x02, 0x84, 0x03, 0x84, 0x01, 0xaa, 0x00, 0xad, 0x00,
+	0x84, 0x01, 0x8f, 0x03, 0x84, 0x01, 0xaf, 0x00, 0xad, 0x00, 0x84, 0x01, 0x8f, 0x03, 0x84, 0x01,
+	0xaf, 0x00, 0xad, 0x00, 0x84, 0x01, 0x8f, 0x03, 0x84, 0x01, 0xaf, 0x00, 0xad, 0x00, 0x84, 0x01,
+	0x8f, 0x03, 0x84, 0x01, 0xaf, 0x00, 0xad, 0x00, 0x84, 0x01, 0x8f, 0x03, 0x84, 0x01, 0xaf, 0x00,
+	0xa8, 0x00, 0xa3, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0xa3, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0xa3, 0x01,
+	0xaa, 0x00, 0xa8, 0x00, 0xa3, 0x01, 0xaa, 0x00, 0xa8, 0x00, 0xa3, 0x01, 0xaa, 0x00
+};
+const omegaPackedImage icon_vase_plant = {120, 120, 10, 4, 0x00, icon_vase_plant_palette, icon_vase_plant_data, 0x01};
+
+// 'Plant1', 120x120px, 8 colours, 28800 -> 2244 bytes
+const uint16_t icon_Plant1_palette[] PROGMEM = {
+	0x0000, 0x4531, 0x687c, 0xc6ad, 0xc5b2, 0x065b, 0xc661, 0x46ec
+};
+const uint8_t icon_Plant1_data[] PROGMEM = {
+	0xa5, 0x00, 0x88, 0x01, 0xc8, 0x00, 0xa5, 0x00, 0x88, 0x01, 0xc8, 0x00, 0xa5, 0x00, 0x88, 0x01,
+	0xc8, 0x00, 0xa5, 0x00, 0x88, 0x01, 0xc8, 0x00, 0xaa, 0x00, 0x8c, 0x01, 0xbf, 0x00, 0xaa, 0x00,
+	0x8c, 0x01, 0xbf, 0x00, 0xaa, 0x00, 0x8c, 0x01, 0xbf, 0x00, 0xaa, 0x00, 0x8c, 0x01, 0xbf, 0x00,
+	0xae, 0x00, 0x83, 0x01, 0x84, 0x03, 0x83, 0x01, 0xbb, 0x00, 0xae, 0x00, 0x83, 0x01, 0x84, 0x03,
+	0x83, 0x01, 0xbb, 0x00, 0xae, 0x00, 0x83, 0x01, 0x84, 0x03, 0x83, 0x01, 0xbb, 0x00, 0xae, 0x00,
+	0x83, 0x01, 0x84, 0x03, 0x83, 0x01, 0xbb, 0x00, 0xae, 0x00, 0x83, 0x01, 0x84, 0x03, 0x83, 0x01,
+	0xbb, 0x00, 0x99, 0x00, 0x8b, 0x01, 0x88, 0x00, 0x83, 0x01, 0x88, 0x03, 0x83, 0x01, 0x87, 0x00,
+	0x8b, 0x01, 0xa3, 0x00, 0x99, 0x00, 0x8b, 0x01, 0x88, 0x00, 0x83, 0x01, 0x88, 0x03, 0x83, 0x01,
+	0x87, 0x00, 0x8b, 0x01, 0xa3, 0x00, 0x99, 0x00, 0x8b, 0x01, 0x88, 0x00, 0x83, 0x01, 0x88, 0x03,
+	0x83, 0x01, 0x87, 0x00, 0x8b, 0x01, 0xa3, 0x00, 0x99, 0x00, 0x8b, 0x01, 0x88, 0x00, 0x83, 0x01,
+	0x88, 0x03, 0x83, 0x01, 0x87, 0x00, 0x8b, 0x01, 0xa3, 0x00, 0x90, 0x00, 0x88, 0x01, 0x8b, 0x03,
+	0x88, 0x01, 0x83, 0x00, 0x84, 0x01, 0x87, 0x03, 0x87, 0x01, 0x8b, 0x03, 0x8c, 0x01, 0x96, 0x00,
+	0x90, 0x00, 0x88, 0x01, 0x8b, 0x03, 0x88, 0x01, 0x83, 0x00, 0x84, 0x01, 0x87, 0x03, 0x87, 0x01,
+	0x8b, 0x03, 0x8c, 0x01, 0x96, 0x00, 0x90, 0x00, 0x88, 0x01, 0x8b, 0x03, 0x88, 0x01, 0x83, 0x00,
+	0x84, 0x01, 0x87, 0x03, 0x87, 0x01, 0x8b, 0x03, 0x8c, 0x01, 0x96, 0x00, 0x90, 0x00, 0x88, 0x01,
+	0x8b, 0x03, 0x88, 0x01, 0x83, 0x00, 0x84, 0x01, 0x87, 0x03, 0x87, 0x01, 0x8b, 0x03, 0x8c, 0x01,
+	0x96, 0x00, 0x89, 0x00, 0x86, 0x01, 0x9d, 0x03, 0x88, 0x01, 0x83, 0x02, 0x83, 0x03, 0x83, 0x01,
+	0x83, 0x03, 0x8b, 0x02, 0x84, 0x03, 0x83, 0x01, 0x9a, 0x00, 0x89, 0x00, 0x86, 0x01, 0x9d, 0x03,
+	0x88, 0x01, 0x83, 0x02, 0x83, 0x03, 0x83, 0x01, 0x83, 0x03, 0x8b, 0x02, 0x84, 0x03, 0x83, 0x01,
+	0x9a, 0x00, 0x89, 0x00, 0x86, 0x01, 0x9d, 0x03, 0x88, 0x01, 0x83, 0x02, 0x83, 0x03, 0x83, 0x01,
+	0x83, 0x03, 0x8b, 0x02, 0x84, 0x03, 0x83, 0x01, 0x9a, 0x00, 0x89, 0x00, 0x86, 0x01, 0x9d, 0x03,
+	0x88, 0x01, 0x83, 0x02, 0x83, 0x03, 0x83, 0x01, 0x83, 0x03, 0x8b, 0x02, 0x84, 0x03, 0x83, 0x01,
+	0x9a, 0x00, 0x90, 0x00, 0x88, 0x01, 0x8b, 0x02, 0x8c, 0x03, 0x84, 0x01, 0x83, 0x02, 0x83, 0x01,
+	0x83, 0x03, 0x87, 0x02, 0x83, 0x05, 0x88, 0x01, 0x9e, 0x00, 0x90, 0x00, 0x88, 0x01, 0x8b, 0x02,
+	0x8c, 0x03, 0x84, 0x01, 0x83, 0x02, 0x83, 0x01, 0x83, 0x03, 0x87, 0x02, 0x83, 0x05, 0x88, 0x01,
+	0x9e, 0x00, 0x90, 0x00, 0x88, 0x01, 0x8b, 0x02, 0x8c, 0x03, 0x84, 0x01, 0x83, 0x02, 0x83, 0x01,
+	0x83, 0x03, 0x87, 0x02, 0x83, 0x05, 0x88, 0x01, 0x9e, 0x00, 0x90, 0x00, 0x88, 0x01, 0x8b, 0x02,
+	0x8c, 0x03, 0x84, 0x01, 0x83, 0x02, 0x83, 0x01, 0x83, 0x03, 0x87, 0x02, 0x83, 0x05, 0x88, 0x01,
+	0x9e, 0x00, 0x99, 0x00, 0x83, 0x01, 0x83, 0x05, 0x88, 0x02, 0x87, 0x03, 0x84, 0x01, 0x83, 0x05,
+	0x83, 0x01, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01, 0xa7, 0x00, 0x99, 0x00, 0x83, 0x01, 0x83, 0x05,
+	0x88, 0x02, 0x87, 0x03, 0x84, 0x01, 0x83, 0x05, 0x83, 0x01, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01,
+	0xa7, 0x00, 0x99, 0x00, 0x83, 0x01, 0x83, 0x05, 0x88, 0x02, 0x87, 0x03, 0x84, 0x01, 0x83, 0x05,
+	0x83, 0x01, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01, 0xa7, 0x00, 0x99, 0x00, 0x83, 0x01, 0x83, 0x05,
+	0x88, 0x02, 0x87, 0x03, 0x84, 0x01, 0x83, 0x05, 0x83, 0x01, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01,
+	0xa7, 0x00, 0x9d, 0x00, 0x83, 0x01, 0x83, 0x05, 0x88, 0x02, 0x83, 0x03, 0x88, 0x01, 0x83, 0x03,
+	0x87, 0x02, 0x83, 0x05, 0x83, 0x01, 0xa7, 0x00, 0x9d, 0x00, 0x83, 0x01, 0x83, 0x05, 0x88, 0x02,
+	0x83, 0x03, 0x88, 0x01, 0x83, 0x03, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01, 0xa7, 0x00, 0x9d, 0x00,
+	0x83, 0x01, 0x83, 0x05, 0x88, 0x02, 0x83, 0x03, 0x88, 0x01, 0x83, 0x03, 0x87, 0x02, 0x83, 0x05,
+	0x83, 0x01, 0xa7, 0x00, 0x9d, 0x00, 0x83, 0x01, 0x83, 0x05, 0x88, 0x02, 0x83, 0x03, 0x88, 0x01,
+	0x83, 0x03, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01, 0xa7, 0x00, 0x90, 0x00, 0x8c, 0x01, 0x83, 0x03,
+	0x83, 0x01, 0x84, 0x05, 0x83, 0x02, 0x88, 0x03, 0x83, 0x01, 0x83, 0x03, 0x87, 0x02, 0x83, 0x05,
+	0x90, 0x01, 0x9a, 0x00, 0x90, 0x00, 0x8c, 0x01, 0x83, 0x03, 0x83, 0x01, 0x84, 0x05, 0x83, 0x02,
+	0x88, 0x03, 0x83, 0x01, 0x83, 0x03, 0x87, 0x02, 0x83, 0x05, 0x90, 0x01, 0x9a, 0x00, 0x90, 0x00,
+	0x8c, 0x01, 0x83, 0x03, 0x83, 0x01, 0x84, 0x05, 0x83, 0x02, 0x88, 0x03, 0x83, 0x01, 0x83, 0x03,
+	0x87, 0x02, 0x83, 0x05, 0x90, 0x01, 0x9a, 0x00, 0x90, 0x00, 0x8c, 0x01, 0x83, 0x03, 0x83, 0x01,
+	0x84, 0x05, 0x83, 0x02, 0x88, 0x03, 0x83, 0x01, 0x83, 0x03, 0x87, 0x02, 0x83, 0x05, 0x90, 0x01,
+	0x9a, 0x00, 0x90, 0x00, 0x8c, 0x01, 0x83, 0x03, 0x83, 0x01, 0x84, 0x05, 0x83, 0x02, 0x88, 0x03,
+	0x83, 0x01, 0x83, 0x03, 0x87, 0x02, 0x83, 0x05, 0x90, 0x01, 0x9a, 0x00, 0x8d, 0x00, 0x86, 0x01,
+	0x90, 0x03, 0x84, 0x01, 0x87, 0x02, 0x84, 0x03, 0x83, 0x01, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01,
+	0x83, 0x02, 0x8c, 0x03, 0x88, 0x01, 0x91, 0x00, 0x8d, 0x00, 0x86, 0x01, 0x90, 0x03, 0x84, 0x01,
+	0x87, 0x02, 0x84, 0x03, 0x83, 0x01, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01, 0x83, 0x02, 0x8c, 0x03,
+	0x88, 0x01, 0x91, 0x00, 0x8d, 0x00, 0x86, 0x01, 0x90, 0x03, 0x84, 0x01, 0x87, 0x02, 0x84, 0x03,
+	0x83, 0x01, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01, 0x83, 0x02, 0x8c, 0x03, 0x88, 0x01, 0x91, 0x00,
+	0x8d, 0x00, 0x86, 0x01, 0x90, 0x03, 0x84, 0x01, 0x87, 0x02, 0x84, 0x03, 0x83, 0x01, 0x87, 0x02,
+	0x83, 0x05, 0x83, 0x01, 0x83, 0x02, 0x8c, 0x03, 0x88, 0x01, 0x91, 0x00, 0x8d, 0x00, 0x82, 0x01,
+	0x8c, 0x03, 0x87, 0x02, 0x84, 0x01, 0x83, 0x05, 0x88, 0x02, 0x83, 0x01, 0x87, 0x02, 0x83, 0x05,
+	0x83, 0x01, 0x90, 0x02, 0x88, 0x03, 0x83, 0x01, 0x8d, 0x00, 0x8d, 0x00, 0x82, 0x01, 0x8c, 0x03,
+	0x87, 0x02, 0x84, 0x01, 0x83, 0x05, 0x88, 0x02, 0x83, 0x01, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01,
+	0x90, 0x02, 0x88, 0x03, 0x83, 0x01, 0x8d, 0x00, 0x8d, 0x00, 0x82, 0x01, 0x8c, 0x03, 0x87, 0x02,
+	0x84, 0x01, 0x83, 0x05, 0x88, 0x02, 0x83, 0x01, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01, 0x90, 0x02,
+	0x88, 0x03, 0x83, 0x01, 0x8d, 0x00, 0x8d, 0x00, 0x82, 0x01, 0x8c, 0x03, 0x87, 0x02, 0x84, 0x01,
+	0x83, 0x05, 0x88, 0x02, 0x83, 0x01, 0x87, 0x02, 0x83, 0x05, 0x83, 0x01, 0x90, 0x02, 0x88, 0x03,
+	0x83, 0x01, 0x8d, 0x00, 0x89, 0x00, 0x83, 0x01, 0x86, 0x03, 0x95, 0x02, 0x83, 0x01, 0x88, 0x02,
+	0x83, 0x01, 0x83, 0x02, 0x83, 0x05, 0x83, 0x01, 0x87, 0x02, 0x8c, 0x05, 0x88, 0x02, 0x83, 0x03,
+	0x83, 0x01, 0x89, 0x00, 0x89, 0x00, 0x83, 0x01, 0x86, 0x03, 0x95, 0x02, 0x83, 0x01, 0x88, 0x02,
+	0x83, 0x01, 0x83, 0x02, 0x83, 0x05, 0x83, 0x01, 0x87, 0x02, 0x8c, 0x05, 0x88, 0x02, 0x83, 0x03,
+	0x83, 0x01, 0x89, 0x00, 0x89, 0x00, 0x83, 0x01, 0x86, 0x03, 0x95, 0x02, 0x83, 0x01, 0x88, 0x02,
+	0x83, 0x01, 0x83, 0x02, 0x83, 0x05, 0x83, 0x01, 0x87, 0x02, 0x8c, 0x05, 0x88, 0x02, 0x83, 0x03,
+	0x83, 0x01, 0x89, 0x00, 0x89, 0x00, 0x83, 0x01, 0x86, 0x03, 0x95, 0x02, 0x83, 0x01, 0x88, 0x02,
+	0x83, 0x01, 0x83, 0x02, 0x83, 0x05, 0x83, 0x01, 0x87, 0x02, 0x8c, 0x05, 0x88, 0x02, 0x83, 0x03,
+	0x83, 0x01, 0x89, 0x00, 0x89, 0x00, 0x83, 0x01, 0x82, 0x03, 0x8c, 0x01, 0x83, 0x05, 0x88, 0x02,
+	0x83, 0x01, 0x83, 0x05, 0x84, 0x02, 0x83, 0x01, 0x83, 0x02, 0x83, 0x05, 0x83, 0x01, 0x83, 0x02,
+	0x87, 0x05, 0x91, 0x01, 0x83, 0x02, 0x83, 0x01, 0x89, 0x00, 0x89, 0x00, 0x83, 0x01, 0x82, 0x03,
+	0x8c, 0x01, 0x83, 0x05, 0x88, 0x02, 0x83, 0x01, 0x83, 0x05, 0x84, 0x02, 0x83, 0x01, 0x83, 0x02,
+	0x83, 0x05, 0x83, 0x01, 0x83, 0x02, 0x87, 0x05, 0x91, 0x01, 0x83, 0x02, 0x83, 0x01, 0x89, 0x00,
+	0x89, 0x00, 0x83, 0x01, 0x82, 0x03, 0x8c, 0x01, 0x83, 0x05, 0x88, 0x02, 0x83, 0x01, 0x83, 0x05,
+	0x84, 0x02, 0x83, 0x01, 0x83, 0x02, 0x83, 0x05, 0x83, 0x01, 0x83, 0x02, 0x87, 0x05, 0x91, 0x01,
+	0x83, 0x02, 0x83, 0x01, 0x89, 0x00, 0x89, 0x00, 0x83, 0x01, 0x82, 0x03, 0x8c, 0x01, 0x83, 0x05,
+	0x88, 0x02, 0x83, 0x01, 0x83, 0x05, 0x84, 0x02, 0x83, 0x01, 0x83, 0x02, 0x83, 0x05, 0x83, 0x01,
+	0x83, 0x02, 0x87, 0x05, 0x91, 0x01, 0x83, 0x02, 0x83, 0x01, 0x89, 0x00, 0x89, 0x00, 0x83, 0x01,
+	0x82, 0x03, 0x8c, 0x01, 0x83, 0x05, 0x88, 0x02, 0x83, 0x01, 0x83, 0x05, 0x84, 0x02, 0x83, 0x01,
+	0x83, 0x02, 0x83, 0x05, 0x83, 0x01, 0x83, 0x02, 0x87, 0x05, 0x91, 0x01, 0x83, 0x02, 0x83, 0x01,
+	0x89, 0x00, 0x84, 0x00, 0x84, 0x01, 0x83, 0x03, 0x82, 0x01, 0x8c, 0x00, 0x83, 0x01, 0x83, 0x05,
+	0x84, 0x02, 0x83, 0x01, 0x83, 0x05, 0x84, 0x02, 0x83, 0x01, 0x83, 0x02, 0x83, 0x05, 0x83, 0x01,
+	0x87, 0x05, 0x83, 0x01, 0x91, 0x00, 0x83, 0x01, 0x83, 0x02, 0x83, 0x01, 0x85, 0x00, 0x84, 0x00,
+	0x84, 0x01, 0x83, 0x03, 0x82, 0x01, 0x8c, 0x00, 0x83, 0x01, 0x83, 0x05, 0x84, 0x02, 0x83, 0x01,
+	0x83, 0x05, 0x84, 0x02, 0x83, 0x01, 0x83, 0x02, 0x83, 0x05, 0x83, 0x01, 0x87, 0x05, 0x83, 0x01,
+	0x91, 0x00, 0x83, 0x01, 0x83, 0x02, 0x83, 0x01, 0x85, 0x00, 0x84, 0x00, 0x84, 0x01, 0x83, 0x03,
+	0x82, 0x01, 0x8c, 0x00, 0x83, 0x01, 0x83, 0x05, 0x84, 0x02, 0x83, 0x01, 0x83, 0x05, 0x84, 0x02,
+	0x83, 0x01, 0x83, 0x02, 0x83, 0x05, 0x83, 0x01, 0x87, 0x05, 0x83, 0x01, 0x91, 0x00, 0x83, 0x01,
+	0x83, 0x02, 0x83, 0x01, 0x85, 0x00, 0x84, 0x00, 0x84, 0x01, 0x83, 0x03, 0x82, 0x01, 0x8c, 0x00,
+	0x83, 0x01, 0x83, 0x05, 0x84, 0x02, 0x83, 0x01, 0x83, 0x05, 0x84, 0x02, 0x83, 0x01, 0x83, 0x02,
+	0x83, 0x05, 0x83, 0x01, 0x87, 0x05, 0x83, 0x01, 0x91, 0x00, 0x83, 0x01, 0x83, 0x02, 0x83, 0x01,
+	0x85, 0x00, 0x84, 0x00, 0x88, 0x01, 0x8b, 0x00, 0xbe, 0x01, 0x90, 0x00, 0x87, 0x01, 0x85, 0x00,
+	0x84, 0x00, 0x88, 0x01, 0x8b, 0x00, 0xbe, 0x01, 0x90, 0x00, 0x87, 0x01, 0x85, 0x00, 0x84, 0x00,
+	0x88, 0x01, 0x8b, 0x00, 0xbe, 0x01, 0x90, 0x00, 0x87, 0x01, 0x85, 0x00, 0x84, 0x00, 0x88, 0x01,
+	0x8b, 0x00, 0xbe, 0x01, 0x90, 0x00, 0x87, 0x01, 0x85, 0x00, 0x84, 0x00, 0x84, 0x01, 0x8f, 0x00,
+	0x83, 0x01, 0xa1, 0x07, 0x83, 0x04, 0x83, 0x07, 0x87, 0x04, 0x83, 0x06, 0x84, 0x01, 0x94, 0x00,
+	0x83, 0x01, 0x85, 0x00, 0x84, 0x00, 0x84, 0x01, 0x8f, 0x00, 0x83, 0x01, 0xa1, 0x07, 0x83, 0x04,
+	0x83, 0x07, 0x87, 0x04, 0x83, 0x06, 0x84, 0x01, 0x94, 0x00, 0x83, 0x01, 0x85, 0x00, 0x84, 0x00,
+	0x84, 0x01, 0x8f, 0x00, 0x83, 0x01, 0xa1, 0x07, 0x83, 0x04, 0x83, 0x07, 0x87, 0x04, 0x83, 0x06,
+	0x84, 0x01, 0x94, 0x00, 0x83, 0x01, 0x85, 0x00, 0x84, 0x00, 0x84, 0x01, 0x8f, 0x00, 0x83, 0x01,
+	0xa1, 0x07, 0x83, 0x04, 0x83, 0x07, 0x87, 0x04, 0x83, 0x06, 0x84, 0x01, 0x94, 0x00, 0x83, 0x01,
+	0x85, 0x00, 0x84, 0x00, 0x84, 0x01, 0x8f, 0x00, 0x83, 0x01, 0xa1, 0x07, 0x83, 0x04, 0x83, 0x07,
+	0x87, 0x04, 0x83, 0x06, 0x84, 0x01, 0x94, 0x00, 0x83, 0x01, 0x85, 0x00, 0x9d, 0x00, 0xb5, 0x01,
+	0xa3, 0x00, 0x9d, 0x00, 0xb5, 0x01, 0xa3, 0x00, 0x9d, 0x00, 0xb5, 0x01, 0xa3, 0x00, 0x9d, 0x00,
+	0xb5, 0x01, 0xa3, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x04, 0xa0, 0x06, 0x83, 0x01, 0xa7, 0x00,
+	0xa1, 0x00, 0x83, 0x01, 0x84, 0x04, 0xa0, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01,
+	0x84, 0x04, 0xa0, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x04, 0xa0, 0x06,
+	0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01,
+	0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00,
+	0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00,
+	0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01,
+	0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07,
+	0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04,
+	0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06,
+	0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01,
+	0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00,
+	0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00,
+	0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01,
+	0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07,
+	0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04,
+	0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06,
+	0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01,
+	0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00,
+	0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00,
+	0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01,
+	0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07,
+	0x9c, 0x04, 0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04,
+	0x83, 0x06, 0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06,
+	0x83, 0x01, 0xa7, 0x00, 0xa1, 0x00, 0x83, 0x01, 0x84, 0x07, 0x9c, 0x04, 0x83, 0x06, 0x83, 0x01,
+	0xa7, 0x00, 0x90, 0x00, 0xcf, 0x01, 0x96, 0x00, 0x90, 0x00, 0xcf, 0x01, 0x96, 0x00, 0x90, 0x00,
+	0xcf, 0x01, 0x96, 0x00, 0x90, 0x00, 0xcf, 0x01, 0x96, 0x00, 0x94, 0x00, 0x84, 0x01, 0x83, 0x07,
+	0x8c, 0x04, 0x83, 0x06, 0x83, 0x04, 0xa5, 0x06, 0x83, 0x01, 0x9a, 0x00, 0x94, 0x00, 0x84, 0x01,
+	0x83, 0x07, 0x8c, 0x04, 0x83, 0x06, 0x83, 0x04, 0xa5, 0x06, 0x83, 0x01, 0x9a, 0x00, 0x94, 0x00,
+	0x84, 0x01, 0x83, 0x07, 0x8c, 0x04, 0x83, 0x06, 0x83, 0x04, 0xa5, 0x06, 0x83, 0x01, 0x9a, 0x00,
+	0x94, 0x00, 0x84, 0x01, 0x83, 0x07, 0x8c, 0x04, 0x83, 0x06, 0x83, 0x04, 0xa5, 0x06, 0x83, 0x01,
+	0x9a, 0x00, 0x99, 0x00, 0xbe, 0x01, 0x9e, 0x00, 0x99, 0x00, 0xbe, 0x01, 0x9e, 0x00, 0x99, 0x00,
+	0xbe, 0x01, 0x9e, 0x00, 0x99, 0x00, 0xbe, 0x01, 0x9e, 0x00, 0x99, 0x00, 0xbe, 0x01, 0x9e, 0x00,
+	0xf7, 0x00, 0xf7, 0x00
+};
+const omegaPackedImage icon_Plant1 = {120, 120, 8, 4, 0x00, icon_Plant1_palette, icon_Plant1_data, 0x01};
+
+// 'Plant3', 120x120px, 10 colours, 28800 -> 1928 bytes
+const uint16_t icon_cactus1_palette[] PROGMEM = {
+	0x0000, 0x4531, 0xc5b2, 0xa894, 0xcbc5, 0x4763, 0xc661, 0x46ec, 0xf2ee, 0xb7ff
+};
+const uint8_t icon_cactus1_data[] PROGMEM = {
+	0xc1, 0x00, 0x88, 0x01, 0xac, 0x00, 0xc1, 0x00, 0x88, 0x01, 0xac, 0x00, 0xc1, 0x00, 0x88, 0x01,
+	0xac, 0x00, 0xc1, 0x00, 0x88, 0x01, 0xac, 0x00, 0xc1, 0x00, 0x88, 0x01, 0xac, 0x00, 0xbc, 0x00,
+	0x84, 0x01, 0x83, 0x04, 0x84, 0x03, 0x83, 0x01, 0xa8, 0x00, 0xbc, 0x00, 0x84, 0x01, 0x83, 0x04,
+	0x84, 0x03, 0x83, 0x01, 0xa8, 0x00, 0xbc, 0x00, 0x84, 0x01, 0x83, 0x04, 0x84, 0x03, 0x83, 0x01,
+	0xa8, 0x00, 0xbc, 0x00, 0x84, 0x01, 0x83, 0x04, 0x84, 0x03, 0x83, 0x01, 0xa8, 0x00, 0xbc, 0x00,
+	0x84, 0x01, 0x83, 0x03, 0x88, 0x01, 0xa8, 0x00, 0xbc, 0x00, 0x84, 0x01, 0x83, 0x03, 0x88, 0x01,
+	0xa8, 0x00, 0xbc, 0x00, 0x84, 0x01, 0x83, 0x03, 0x88, 0x01, 0xa8, 0x00, 0xbc, 0x00, 0x84, 0x01,
+	0x83, 0x03, 0x88, 0x01, 0xa8, 0x00, 0xbc, 0x00, 0x84, 0x01, 0x83, 0x03, 0x88, 0x01, 0xa8, 0x00,
+	0x9d, 0x00, 0x8d, 0x01, 0x95, 0x00, 0x83, 0x01, 0x88, 0x04, 0x84, 0x01, 0xa3, 0x00, 0x9d, 0x00,
+	0x8d, 0x01, 0x95, 0x00, 0x83, 0x01, 0x88, 0x04, 0x84, 0x01, 0xa3, 0x00, 0x9d, 0x00, 0x8d, 0x01,
+	0x95, 0x00, 0x83, 0x01, 0x88, 0x04, 0x84, 0x01, 0xa3, 0x00, 0x9d, 0x00, 0x8d, 0x01, 0x95, 0x00,
+	0x83, 0x01, 0x88, 0x04, 0x84, 0x01, 0xa3, 0x00, 0x99, 0x00, 0x83, 0x01, 0x8d, 0x04, 0x83, 0x01,
+	0x8c, 0x00, 0x84, 0x01, 0x88, 0x04, 0x83, 0x09, 0x84, 0x03, 0x83, 0x01, 0x9f, 0x00, 0x99, 0x00,
+	0x83, 0x01, 0x8d, 0x04, 0x83, 0x01, 0x8c, 0x00, 0x84, 0x01, 0x88, 0x04, 0x83, 0x09, 0x84, 0x03,
+	0x83, 0x01, 0x9f, 0x00, 0x99, 0x00, 0x83, 0x01, 0x8d, 0x04, 0x83, 0x01, 0x8c, 0x00, 0x84, 0x01,
+	0x88, 0x04, 0x83, 0x09, 0x84, 0x03, 0x83, 0x01, 0x9f, 0x00, 0x99, 0x00, 0x83, 0x01, 0x8d, 0x04,
+	0x83, 0x01, 0x8c, 0x00, 0x84, 0x01, 0x88, 0x04, 0x83, 0x09, 0x84, 0x03, 0x83, 0x01, 0x9f, 0x00,
+	0x99, 0x00, 0x83, 0x01, 0x8d, 0x04, 0x83, 0x01, 0x8c, 0x00, 0x84, 0x01, 0x88, 0x04, 0x83, 0x09,
+	0x84, 0x03, 0x83, 0x01, 0x9f, 0x00, 0x99, 0x00, 0x83, 0x01, 0x84, 0x09, 0x83, 0x04, 0x84, 0x03,
+	0x83, 0x01, 0x8c, 0x00, 0x84, 0x01, 0x83, 0x04, 0x88, 0x03, 0x84, 0x05, 0x83, 0x01, 0x9f, 0x00,
+	0x99, 0x00, 0x83, 0x01, 0x84, 0x09, 0x83, 0x04, 0x84, 0x03, 0x83, 0x01, 0x8c, 0x00, 0x84, 0x01,
+	0x83, 0x04, 0x88, 0x03, 0x84, 0x05, 0x83, 0x01, 0x9f, 0x00, 0x99, 0x00, 0x83, 0x01, 0x84, 0x09,
+	0x83, 0x04, 0x84, 0x03, 0x83, 0x01, 0x8c, 0x00, 0x84, 0x01, 0x83, 0x04, 0x88, 0x03, 0x84, 0x05,
+	0x83, 0x01, 0x9f, 0x00, 0x99, 0x00, 0x83, 0x01, 0x84, 0x09, 0x83, 0x04, 0x84, 0x03, 0x83, 0x01,
+	0x8c, 0x00, 0x84, 0x01, 0x83, 0x04, 0x88, 0x03, 0x84, 0x05, 0x83, 0x01, 0x9f, 0x00, 0x99, 0x00,
+	0x83, 0x01, 0x84, 0x04, 0x88, 0x03, 0x95, 0x01, 0x83, 0x04, 0x84, 0x08, 0x83, 0x03, 0x84, 0x05,
+	0x83, 0x01, 0x9f, 0x00, 0x99, 0x00, 0x83, 0x01, 0x84, 0x04, 0x88, 0x03, 0x95, 0x01, 0x83, 0x04,
+	0x84, 0x08, 0x83, 0x03, 0x84, 0x05, 0x83, 0x01, 0x9f, 0x00, 0x99, 0x00, 0x83, 0x01, 0x84, 0x04,
+	0x88, 0x03, 0x95, 0x01, 0x83, 0x04, 0x84, 0x08, 0x83, 0x03, 0x84, 0x05, 0x83, 0x01, 0x9f, 0x00,
+	0x99, 0x00, 0x83, 0x01, 0x84, 0x04, 0x88, 0x03, 0x95, 0x01, 0x83, 0x04, 0x84, 0x08, 0x83, 0x03,
+	0x84, 0x05, 0x83, 0x01, 0x9f, 0x00, 0x99, 0x00, 0x83, 0x01, 0x84, 0x04, 0x88, 0x03, 0x95, 0x01,
+	0x83, 0x04, 0x84, 0x08, 0x83, 0x03, 0x84, 0x05, 0x83, 0x01, 0x9f, 0x00, 0x9d, 0x00, 0x84, 0x01,
+	0x83, 0x03, 0x84, 0x05, 0x83, 0x01, 0x88, 0x04, 0x83, 0x09, 0x84, 0x04, 0x83, 0x01, 0x84, 0x03,
+	0x83, 0x05, 0x84, 0x01, 0xa3, 0x00, 0x9d, 0x00, 0x84, 0x01, 0x83, 0x03, 0x84, 0x05, 0x83, 0x01,
+	0x88, 0x04, 0x83, 0x09, 0x84, 0x04, 0x83, 0x01, 0x84, 0x03, 0x83, 0x05, 0x84, 0x01, 0xa3, 0x00,
+	0x9d, 0x00, 0x84, 0x01, 0x83, 0x03, 0x84, 0x05, 0x83, 0x01, 0x88, 0x04, 0x83, 0x09, 0x84, 0x04,
+	0x83, 0x01, 0x84, 0x03, 0x83, 0x05, 0x84, 0x01, 0xa3, 0x00, 0x9d, 0x00, 0x84, 0x01, 0x83, 0x03,
+	0x84, 0x05, 0x83, 0x01, 0x88, 0x04, 0x83, 0x09, 0x84, 0x04, 0x83, 0x01, 0x84, 0x03, 0x83, 0x05,
+	0x84, 0x01, 0xa3, 0x00, 0xa2, 0x00, 0x88, 0x01, 0x90, 0x04, 0x88, 0x03, 0x88, 0x01, 0xa8, 0x00,
+	0xa2, 0x00, 0x88, 0x01, 0x90, 0x04, 0x88, 0x03, 0x88, 0x01, 0xa8, 0x00, 0xa2, 0x00, 0x88, 0x01,
+	0x90, 0x04, 0x88, 0x03, 0x88, 0x01, 0xa8, 0x00, 0xa2, 0x00, 0x88, 0x01, 0x90, 0x04, 0x88, 0x03,
+	0x88, 0x01, 0xa8, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x88, 0x04, 0x90, 0x03, 0x84, 0x05, 0x8c, 0x01,
+	0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x88, 0x04, 0x90, 0x03, 0x84, 0x05, 0x8c, 0x01, 0x9f, 0x00,
+	0xa6, 0x00, 0x84, 0x01, 0x88, 0x04, 0x90, 0x03, 0x84, 0x05, 0x8c, 0x01, 0x9f, 0x00, 0xa6, 0x00,
+	0x84, 0x01, 0x88, 0x04, 0x90, 0x03, 0x84, 0x05, 0x8c, 0x01, 0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01,
+	0x88, 0x04, 0x90, 0x03, 0x84, 0x05, 0x8c, 0x01, 0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04,
+	0x84, 0x03, 0x83, 0x08, 0x8c, 0x03, 0x84, 0x05, 0x83, 0x01, 0x88, 0x04, 0x84, 0x01, 0x9a, 0x00,
+	0xa6, 0x00, 0x84, 0x01, 0x83, 0x04, 0x84, 0x03, 0x83, 0x08, 0x8c, 0x03, 0x84, 0x05, 0x83, 0x01,
+	0x88, 0x04, 0x84, 0x01, 0x9a, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04, 0x84, 0x03, 0x83, 0x08,
+	0x8c, 0x03, 0x84, 0x05, 0x83, 0x01, 0x88, 0x04, 0x84, 0x01, 0x9a, 0x00, 0xa6, 0x00, 0x84, 0x01,
+	0x83, 0x04, 0x84, 0x03, 0x83, 0x08, 0x8c, 0x03, 0x84, 0x05, 0x83, 0x01, 0x88, 0x04, 0x84, 0x01,
+	0x9a, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04, 0x8c, 0x03, 0x84, 0x04, 0x83, 0x03, 0x84, 0x05,
+	0x83, 0x01, 0x84, 0x08, 0x83, 0x03, 0x84, 0x04, 0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01,
+	0x83, 0x04, 0x8c, 0x03, 0x84, 0x04, 0x83, 0x03, 0x84, 0x05, 0x83, 0x01, 0x84, 0x08, 0x83, 0x03,
+	0x84, 0x04, 0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04, 0x8c, 0x03, 0x84, 0x04,
+	0x83, 0x03, 0x84, 0x05, 0x83, 0x01, 0x84, 0x08, 0x83, 0x03, 0x84, 0x04, 0x83, 0x01, 0x96, 0x00,
+	0xa6, 0x00, 0x84, 0x01, 0x83, 0x04, 0x8c, 0x03, 0x84, 0x04, 0x83, 0x03, 0x84, 0x05, 0x83, 0x01,
+	0x84, 0x08, 0x83, 0x03, 0x84, 0x04, 0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04,
+	0x8c, 0x03, 0x84, 0x04, 0x83, 0x03, 0x84, 0x05, 0x83, 0x01, 0x84, 0x08, 0x83, 0x03, 0x84, 0x04,
+	0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04, 0x91, 0x03, 0x88, 0x05, 0x83, 0x01,
+	0x8d, 0x03, 0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04, 0x91, 0x03, 0x88, 0x05,
+	0x83, 0x01, 0x8d, 0x03, 0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04, 0x91, 0x03,
+	0x88, 0x05, 0x83, 0x01, 0x8d, 0x03, 0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04,
+	0x91, 0x03, 0x88, 0x05, 0x83, 0x01, 0x8d, 0x03, 0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01,
+	0x83, 0x04, 0x91, 0x03, 0x83, 0x05, 0x84, 0x01, 0x83, 0x05, 0x84, 0x03, 0x83, 0x04, 0x84, 0x03,
+	0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04, 0x91, 0x03, 0x83, 0x05, 0x84, 0x01,
+	0x83, 0x05, 0x84, 0x03, 0x83, 0x04, 0x84, 0x03, 0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01,
+	0x83, 0x04, 0x91, 0x03, 0x83, 0x05, 0x84, 0x01, 0x83, 0x05, 0x84, 0x03, 0x83, 0x04, 0x84, 0x03,
+	0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x04, 0x91, 0x03, 0x83, 0x05, 0x84, 0x01,
+	0x83, 0x05, 0x84, 0x03, 0x83, 0x04, 0x84, 0x03, 0x83, 0x01, 0x96, 0x00, 0xa6, 0x00, 0x84, 0x01,
+	0x83, 0x04, 0x91, 0x03, 0x83, 0x05, 0x84, 0x01, 0x83, 0x05, 0x84, 0x03, 0x83, 0x04, 0x84, 0x03,
+	0x83, 0x01, 0x96, 0x00, 0xab, 0x00, 0x83, 0x01, 0x84, 0x03, 0x83, 0x04, 0x83, 0x03, 0x88, 0x05,
+	0x84, 0x01, 0x88, 0x05, 0x83, 0x03, 0x84, 0x01, 0x9a, 0x00, 0xab, 0x00, 0x83, 0x01, 0x84, 0x03,
+	0x83, 0x04, 0x83, 0x03, 0x88, 0x05, 0x84, 0x01, 0x88, 0x05, 0x83, 0x03, 0x84, 0x01, 0x9a, 0x00,
+	0xab, 0x00, 0x83, 0x01, 0x84, 0x03, 0x83, 0x04, 0x83, 0x03, 0x88, 0x05, 0x84, 0x01, 0x88, 0x05,
+	0x83, 0x03, 0x84, 0x01, 0x9a, 0x00, 0xab, 0x00, 0x83, 0x01, 0x84, 0x03, 0x83, 0x04, 0x83, 0x03,
+	0x88, 0x05, 0x84, 0x01, 0x88, 0x05, 0x83, 0x03, 0x84, 0x01, 0x9a, 0x00, 0xab, 0x00, 0x83, 0x01,
+	0x88, 0x03, 0x88, 0x05, 0x83, 0x01, 0x8d, 0x05, 0x83, 0x01, 0x9f, 0x00, 0xab, 0x00, 0x83, 0x01,
+	0x88, 0x03, 0x88, 0x05, 0x83, 0x01, 0x8d, 0x05, 0x83, 0x01, 0x9f, 0x00, 0xab, 0x00, 0x83, 0x01,
+	0x88, 0x03, 0x88, 0x05, 0x83, 0x01, 0x8d, 0x05, 0x83, 0x01, 0x9f, 0x00, 0xab, 0x00, 0x83, 0x01,
+	0x88, 0x03, 0x88, 0x05, 0x83, 0x01, 0x8d, 0x05, 0x83, 0x01, 0x9f, 0x00, 0xab, 0x00, 0x83, 0x01,
+	0x88, 0x03, 0x88, 0x05, 0x83, 0x01, 0x8d, 0x05, 0x83, 0x01, 0x9f, 0x00, 0x9d, 0x00, 0xc2, 0x01,
+	0x96, 0x00, 0x9d, 0x00, 0xc2, 0x01, 0x96, 0x00, 0x9d, 0x00, 0xc2, 0x01, 0x96, 0x00, 0x9d, 0x00,
+	0xc2, 0x01, 0x96, 0x00, 0x9d, 0x00, 0x84, 0x01, 0x91, 0x07, 0x83, 0x02, 0x88, 0x07, 0x83, 0x02,
+	0x84, 0x07, 0x8c, 0x02, 0x84, 0x06, 0x83, 0x01, 0x96, 0x00, 0x9d, 0x00, 0x84, 0x01, 0x91, 0x07,
+	0x83, 0x02, 0x88, 0x07, 0x83, 0x02, 0x84, 0x07, 0x8c, 0x02, 0x84, 0x06, 0x83, 0x01, 0x96, 0x00,
+	0x9d, 0x00, 0x84, 0x01, 0x91, 0x07, 0x83, 0x02, 0x88, 0x07, 0x83, 0x02, 0x84, 0x07, 0x8c, 0x02,
+	0x84, 0x06, 0x83, 0x01, 0x96, 0x00, 0x9d, 0x00, 0x84, 0x01, 0x91, 0x07, 0x83, 0x02, 0x88, 0x07,
+	0x83, 0x02, 0x84, 0x07, 0x8c, 0x02, 0x84, 0x06, 0x83, 0x01, 0x96, 0x00, 0xa2, 0x00, 0xb9, 0x01,
+	0x9a, 0x00, 0xa2, 0x00, 0xb9, 0x01, 0x9a, 0x00, 0xa2, 0x00, 0xb9, 0x01, 0x9a, 0x00, 0xa2, 0x00,
+	0xb9, 0x01, 0x9a, 0x00, 0xa2, 0x00, 0xb9, 0x01, 0x9a, 0x00, 0xa2, 0x00, 0x83, 0x01, 0x84, 0x07,
+	0xa2, 0x02, 0x88, 0x06, 0x84, 0x01, 0x9a, 0x00, 0xa2, 0x00, 0x83, 0x01, 0x84, 0x07, 0xa2, 0x02,
+	0x88, 0x06, 0x84, 0x01, 0x9a, 0x00, 0xa2, 0x00, 0x83, 0x01, 0x84, 0x07, 0xa2, 0x02, 0x88, 0x06,
+	0x84, 0x01, 0x9a, 0x00, 0xa2, 0x00, 0x83, 0x01, 0x84, 0x07, 0xa2, 0x02, 0x88, 0x06, 0x84, 0x01,
+	0x9a, 0x00, 0xa2, 0x00, 0x83, 0x01, 0x84, 0x07, 0xa2, 0x02, 0x88, 0x06, 0x84, 0x01, 0x9a, 0x00,
+	0xa2, 0x00, 0x83, 0x01, 0x84, 0x07, 0xa2, 0x02, 0x88, 0x06, 0x84, 0x01, 0x9a, 0x00, 0xa2, 0x00,
+	0x83, 0x01, 0x84, 0x07, 0xa2, 0x02, 0x88, 0x06, 0x84, 0x01, 0x9a, 0x00, 0xa2, 0x00, 0x83, 0x01,
+	0x84, 0x07, 0xa2, 0x02, 0x88, 0x06, 0x84, 0x01, 0x9a, 0x00, 0xa2, 0x00, 0x83, 0x01, 0x84, 0x07,
+	0xa2, 0x02, 0x88, 0x06, 0x84, 0x01, 0x9a, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x07, 0x9a, 0x02,
+	0x88, 0x06, 0x83, 0x01, 0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x07, 0x9a, 0x02, 0x88, 0x06,
+	0x83, 0x01, 0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x07, 0x9a, 0x02, 0x88, 0x06, 0x83, 0x01,
+	0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x07, 0x9a, 0x02, 0x88, 0x06, 0x83, 0x01, 0x9f, 0x00,
+	0xa6, 0x00, 0x84, 0x01, 0x83, 0x07, 0x9a, 0x02, 0x88, 0x06, 0x83, 0x01, 0x9f, 0x00, 0xa6, 0x00,
+	0x84, 0x01, 0x83, 0x07, 0x9a, 0x02, 0x88, 0x06, 0x83, 0x01, 0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01,
+	0x83, 0x07, 0x9a, 0x02, 0x88, 0x06, 0x83, 0x01, 0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x07,
+	0x9a, 0x02, 0x88, 0x06, 0x83, 0x01, 0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x07, 0x9a, 0x02,
+	0x88, 0x06, 0x83, 0x01, 0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x07, 0x9a, 0x02, 0x88, 0x06,
+	0x83, 0x01, 0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x07, 0x9a, 0x02, 0x88, 0x06, 0x83, 0x01,
+	0x9f, 0x00, 0xa6, 0x00, 0x84, 0x01, 0x83, 0x07, 0x9a, 0x02, 0x88, 0x06, 0x83, 0x01, 0x9f, 0x00,
+	0xa6, 0x00, 0x84, 0x01, 0x83, 0x07, 0x9a, 0x02, 0x88, 0x06, 0x83, 0x01, 0x9f, 0x00, 0xab, 0x00,
+	0x83, 0x01, 0x84, 0x07, 0x90, 0x02, 0x88, 0x06, 0x84, 0x01, 0xa3, 0x00, 0xab, 0x00, 0x83, 0x01,
+	0x84, 0x07, 0x90, 0x02, 0x88, 0x06, 0x84, 0x01, 0xa3, 0x00, 0xab, 0x00, 0x83, 0x01, 0x84, 0x07,
+	0x90, 0x02, 0x88, 0x06, 0x84, 0x01, 0xa3, 0x00, 0xab, 0x00, 0x83, 0x01, 0x84, 0x07, 0x90, 0x02,
+	0x88, 0x06, 0x84, 0x01, 0xa3, 0x00, 0xab, 0x00, 0x83, 0x01, 0x84, 0x07, 0x90, 0x02, 0x88, 0x06,
+	0x84, 0x01, 0xa3, 0x00, 0xab, 0x00, 0x83, 0x01, 0x84, 0x07, 0x90, 0x02, 0x88, 0x06, 0x84, 0x01,
+	0xa3, 0x00, 0xab, 0x00, 0x83, 0x01, 0x84, 0x07, 0x90, 0x02, 0x88, 0x06, 0x84, 0x01, 0xa3, 0x00,
+	0xab, 0x00, 0x83, 0x01, 0x84, 0x07, 0x90, 0x02, 0x88, 0x06, 0x84, 0x01, 0xa3, 0x00, 0xab, 0x00,
+	0x83, 0x01, 0x84, 0x07, 0x90, 0x02, 0x88, 0x06, 0x84, 0x01, 0xa3, 0x00, 0xaf, 0x00, 0x9e, 0x01,
+	0xa8, 0x00, 0xaf, 0x00, 0x9e, 0x01, 0xa8, 0x00, 0xaf, 0x00, 0x9e, 0x01, 0xa8, 0x00, 0xaf, 0x00,
+	0x9e, 0x01, 0xa8, 0x00
+};
+const omegaPackedImage icon_cactus1 = {120, 120, 10, 4, 0x00, icon_cactus1_palette, icon_cactus1_data, 0x01};
+
+// Total: 141800 bytes raw, 17092 bytes packed
+
+#endif // OMEGA_ASSET_PACK
+
+#endif // OMEGAPACKEDICONS_H
@@ -99,7 +99,7 @@ struct sensorData {
  * @brief Current state of the plant
  */
 struct plantState {
-    uint8_t plantID;
+    uint16_t plantID;
     uint8_t curMood;
     uint8_t curXP;
     uint8_t curEmotion;
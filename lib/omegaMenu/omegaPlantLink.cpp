@@ -0,0 +1,190 @@
+#include "omegaPlantLink.h"
+
+/*######################### PlantLink ####################################*/
+
+void PlantLink::delivered(uint32_t ms) {
+    stats.delivered++;
+    stats.success += (100 - stats.success + 3) / 4; // Moving average over roughly 4 frames
+    if (ms) {
+        uint32_t avg = stats.latency ? (stats.latency * 3 + ms) / 4 : ms;
+        stats.latency = avg > 0xFFFF ? 0xFFFF : avg;
+    }
+}
+
+void PlantLink::failed() {
+    stats.failed++;
+    stats.success -= (stats.success + 3) / 4;
+}
+
+bool PlantLink::healthy() const {
+    return stats.success >= LINK_MIN_SUCCESS && stats.latency <= LINK_MAX_LATENCY;
+}
+
+/*######################### nowPlantLink #################################*/
+
+bool nowPlantLink::send(uint8_t type, const uint8_t* payload, uint8_t len) {
+    // Until a display acknowledged a frame the pot is unpaired and goes
+    // through the mesh, afterwards frames go unicast with hardware acks
+    if (peers.count() == 0) return link.sendTo(NOW_ANY, type, payload, len);
+
+    // Now and then a broadcast instead, every display in range acks it and
+    // the ones not paired yet are paired from their ack
+    uint32_t now = millis();
+    if (now - discoveredAt >= LINK_DISCOVERY_INTERVAL) {
+        discoveredAt = now;
+        return link.send(NOW_BROADCAST, type, payload, len);
+    }
+
+    nowPeer peer;
+    bool queued = false;
+    for (uint8_t i = 0; i < NOW_MAX_PEERS; i++) {
+        if (peers.get(i, peer)) queued |= link.send(peer.mac, type, payload, len);
+    }
+    return queued;
+}
+
+bool nowPlantLink::flush() {
+    uint8_t len = batch.finish(millis());
+    bool queued = len && send(NOW_BATCH, batch.data(), len);
+    batch.clear();
+    return queued;
+}
+
+bool nowPlantLink::publish(const plantFrame& frame) {
+    stats.published++;
+
+    if (frame.type != NOW_SENSOR || batchSamples <= 1) {
+        if (send(frame.type, frame.payload, frame.len)) return true;
+        failed();
+        return false;
+    }
+
+    plantState state;
+    if (!plantStateSchema::fromBinary(frame.payload, frame.len, state)) return false;
+    if (batch.size() == 0) batchStarted = millis();
+    batch.add(state, millis());
+    if (batch.size() < batchSamples && !batch.full()) return true;
+
+    if (flush()) return true;
+    failed();
+    return false;
+}
+
+void nowPlantLink::loop() {
+    link.loop();
+
+    if (batch.size() && millis() - batchStarted >= LINK_BATCH_MAX_AGE && !flush()) failed();
+
+    // Acks and give-ups of the link since the last call, a batch counts once
+    for (; ackedSeen != link.stats.acked; ackedSeen++) delivered(link.stats.latency);
+    for (; droppedSeen != link.stats.dropped; droppedSeen++) failed();
+}
+
+/*######################### blePlantLink #################################*/
+
+#if defined(CONFIG_BLUEDROID_ENABLED)
+bool blePlantLink::publish(const plantFrame& frame) {
+    stats.published++;
+
+    plantState state;
+    if (frame.type != NOW_SENSOR || !plantStateSchema::fromBinary(frame.payload, frame.len, state) ||
+        !beacon.update(state)) {
+        failed();
+        return false;
+    }
+    return false; // Advertised, but nobody confirms it
+}
+#endif
+
+/*######################### mqttPlantLink ################################*/
+
+const mqttPlantLink::topicRoute* mqttPlantLink::find(uint8_t type) const {
+    for (uint8_t i = 0; i < routeCount; i++) {
+        if (routes[i].type == type) return &routes[i];
+    }
+    return nullptr;
+}
+
+bool mqttPlantLink::route(uint8_t type, const char* topic, plantLinkEncoder encoder, void* ctx) {
+    if (routeCount >= LINK_MQTT_ROUTES || find(type)) return false;
+    routes[routeCount++] = {type, topic, encoder, ctx};
+    return true;
+}
+
+bool mqttPlantLink::publish(const plantFrame& frame) {
+    stats.published++;
+
+    const topicRoute* r = find(frame.type);
+    if (!r) {
+        failed();
+        return false;
+    }
+
+    char buffer[LINK_MQTT_BUFFER];
+    size_t len = r->encoder(frame, buffer, sizeof(buffer), r->ctx);
+    if (len == 0) {
+        delivered(0); // Nothing changed, nothing to send
+        return true;
+    }
+
+    // Written to the TCP socket before publish returns, QoS 0 has no ack
+    uint32_t start = millis();
+    if (!client.publish(r->topic, (const uint8_t*)buffer, len)) {
+        failed();
+        return false;
+    }
+    delivered(millis() - start);
+    return true;
+}
+
+/*######################### plantLinkSelector ############################*/
+
+bool plantLinkSelector::add(PlantLink& link) {
+    if (count >= LINK_MAX_BACKENDS) return false;
+    links[count] = &link;
+    probedAt[count] = millis();
+    count++;
+    return true;
+}
+
+PlantLink* plantLinkSelector::publish(const plantFrame& frame) {
+    uint32_t now = millis();
+    int8_t fallback = -1;
+    PlantLink* probed = nullptr;
+
+    for (uint8_t i = 0; i < count; i++) {
+        PlantLink* link = links[i];
+        if (!link->supports(frame.type) || !link->available()) continue;
+
+        if (!link->healthy()) {
+            if (fallback < 0) fallback = i;
+            // A probe checks whether the link recovered, the frame still
+            // goes out on a healthy link
+            if (now - probedAt[i] >= LINK_PROBE_INTERVAL) {
+                probedAt[i] = now;
+                if (link->publish(frame) && !probed) probed = link;
+            }
+            continue;
+        }
+
+        if (link->publish(frame)) {
+            lastLink = link;
+            return link;
+        }
+    }
+
+    // No healthy link took it, a probe that did counts, otherwise try the cheapest unhealthy one
+    if (probed) {
+        lastLink = probed;
+        return probed;
+    }
+    if (fallback >= 0 && links[fallback]->publish(frame)) {
+        lastLink = links[fallback];
+        return lastLink;
+    }
+    return nullptr;
+}
+
+void plantLinkSelector::loop() {
+    for (uint8_t i = 0; i < count; i++) links[i]->loop();
+}
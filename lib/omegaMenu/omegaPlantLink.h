@@ -0,0 +1,266 @@
+/**
+ * @file omegaPlantLink.h
+ * @brief One publish call for every radio a pot can report over
+ *
+ * Frames are the binary schema payloads that ESP-NOW already carries,
+ * tagged with a nowFrameType. Each PlantLink backend turns them into what
+ * its transport needs: link frames for ESP-NOW, the beacon for BLE, JSON
+ * topics for MQTT. Backends track how many frames arrived and how long the
+ * receiver took to confirm them.
+ *
+ * plantLinkSelector publishes on the cheapest backend that is available and
+ * healthy, in the order the backends were added. Links that fall below
+ * LINK_MIN_SUCCESS or above LINK_MAX_LATENCY are skipped and probed again
+ * every LINK_PROBE_INTERVAL.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGAPLANTLINK_H
+#define OMEGAPLANTLINK_H
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+#include <ArduinoJson.h>
+#include <omegaPlant.h>
+#include <omegaSchema.h>
+#include <omegaNowLink.h>
+#include <omegaNowPeers.h>
+#include <omegaNowBatch.h>
+#include <omegaBLE.h>
+
+/** Settings */
+#define LINK_MAX_BACKENDS 4
+#define LINK_MIN_SUCCESS 70        // Percent of frames delivered below which a link is skipped
+#define LINK_MAX_LATENCY 500       // Milliseconds until confirmation above which a link is skipped
+#define LINK_PROBE_INTERVAL 60000  // Milliseconds between probes of a skipped link
+#define LINK_BATCH_MAX_AGE 1000    // Milliseconds a partial ESP-NOW batch waits for samples of further plants
+#define LINK_DISCOVERY_INTERVAL 300000 // Milliseconds between broadcasts that let further displays pair
+#define LINK_MQTT_BUFFER 512       // JSON size, fits the full PlantSaveData state
+#define LINK_MQTT_ROUTES 4
+/** End Settings */
+
+/**
+ * @struct plantFrame
+ * @brief Transport independent frame
+ */
+struct plantFrame {
+    uint8_t type;  // nowFrameType
+    uint16_t src;  // Device id of the pot
+    uint8_t len;
+    uint8_t payload[NOW_MAX_PAYLOAD];
+
+    /** @brief Frame with an object encoded by its schema */
+    template <typename S>
+    static plantFrame of(uint8_t type, uint16_t src, const typename S::type& o) {
+        static_assert(S::binarySize <= NOW_MAX_PAYLOAD, "Schema does not fit into one frame");
+        plantFrame frame;
+        frame.type = type;
+        frame.src = src;
+        frame.len = S::binarySize;
+        S::toBinary(frame.payload, frame.len, o);
+        return frame;
+    }
+};
+
+/**
+ * @struct plantLinkStats
+ * @brief Delivery counters of one backend
+ */
+struct plantLinkStats {
+    uint32_t published = 0; // Frames handed to the backend
+    uint32_t delivered = 0; // Frames the transport confirmed
+    uint32_t failed = 0;    // Frames lost or refused
+    uint8_t success = 100;  // Smoothed percent of frames delivered
+    uint16_t latency = 0;   // Smoothed milliseconds until confirmation, 0 if unknown
+};
+
+/**
+ * @class PlantLink
+ * @brief Transport backend
+ */
+class PlantLink {
+protected:
+    /** @brief A frame arrived, ms until it was confirmed or 0 if unknown */
+    void delivered(uint32_t ms);
+
+    /** @brief A frame was lost or refused */
+    void failed();
+
+public:
+    plantLinkStats stats;
+
+    virtual ~PlantLink() {}
+    virtual const char* name() const = 0;
+
+    /** @brief Whether the transport can send right now, e.g. the broker is connected */
+    virtual bool available() = 0;
+
+    /** @brief Whether the backend can carry frames of this type */
+    virtual bool supports(uint8_t /*type*/) const { return true; }
+
+    /**
+     * @brief Send a frame
+     * @return False if the frame was refused, asynchronous transports report
+     *         the outcome later through their stats
+     */
+    virtual bool publish(const plantFrame& frame) = 0;
+
+    /** @brief Regular work such as retries, call from the loop */
+    virtual void loop() {}
+
+    bool healthy() const;
+};
+
+/**
+ * @class nowPlantLink
+ * @brief ESP-NOW backend, unicast to paired displays or to the nearest sink
+ *
+ * Sensor frames of several plants can be collected into NOW_BATCH frames,
+ * a partial batch goes out LINK_BATCH_MAX_AGE after its first sample so
+ * samples are not held back waiting for later ones. Once paired, one
+ * frame every LINK_DISCOVERY_INTERVAL is broadcast instead of sent unicast,
+ * so displays that came up later ack it and get paired too.
+ */
+class nowPlantLink : public PlantLink {
+private:
+    omegaNowLink& link;
+    omegaNowPeers& peers;
+    nowBatchWriter batch;
+    uint8_t batchSamples;
+    uint32_t batchStarted = 0;
+    uint32_t discoveredAt = 0;
+    uint32_t ackedSeen = 0;
+    uint32_t droppedSeen = 0;
+
+    bool send(uint8_t type, const uint8_t* payload, uint8_t len);
+    bool flush();
+
+public:
+    /**
+     * @param batchSamples Sensor frames per NOW_BATCH frame, 1 sends each at once
+     */
+    nowPlantLink(omegaNowLink& nowLink, omegaNowPeers& nowPeers, uint8_t batchSamples = 1)
+        : link(nowLink), peers(nowPeers), batchSamples(batchSamples) {}
+
+    const char* name() const override { return "ESP-NOW"; }
+    bool available() override { return true; } // No association, health decides
+    bool publish(const plantFrame& frame) override;
+    void loop() override;
+};
+
+#if defined(CONFIG_BLUEDROID_ENABLED)
+/**
+ * @class blePlantLink
+ * @brief Beacon backend, carries the latest sensor frame only
+ *
+ * Advertisements are not confirmed. An update refreshes the beacon for any
+ * scanner in range but publish() still returns false, so the selector goes on
+ * to a backend that can confirm the frame. Neither delivered nor failed.
+ */
+class blePlantLink : public PlantLink {
+private:
+    omegaBLEBeacon& beacon;
+
+public:
+    explicit blePlantLink(omegaBLEBeacon& bleBeacon) : beacon(bleBeacon) {}
+
+    const char* name() const override { return "BLE"; }
+    bool available() override { return true; }
+    bool supports(uint8_t type) const override { return type == NOW_SENSOR; }
+    bool publish(const plantFrame& frame) override;
+};
+#endif
+
+/**
+ * @brief Turns a frame into an MQTT payload
+ * @return Payload length, 0 if there is nothing to publish
+ */
+typedef size_t (*plantLinkEncoder)(const plantFrame& frame, char* out, size_t size, void* ctx);
+
+/**
+ * @class mqttPlantLink
+ * @brief MQTT backend, publishes frames as JSON on per-type topics
+ */
+class mqttPlantLink : public PlantLink {
+private:
+    struct topicRoute {
+        uint8_t type;
+        const char* topic;
+        plantLinkEncoder encoder;
+        void* ctx;
+    };
+
+    PubSubClient& client;
+    topicRoute routes[LINK_MQTT_ROUTES];
+    uint8_t routeCount = 0;
+
+    const topicRoute* find(uint8_t type) const;
+
+    template <typename S>
+    static size_t schemaEncoder(const plantFrame& frame, char* out, size_t size, void* /*ctx*/) {
+        typename S::type o;
+        if (!S::fromBinary(frame.payload, frame.len, o)) return 0;
+        StaticJsonDocument<LINK_MQTT_BUFFER> doc;
+        S::toJson(doc.to<JsonObject>(), o);
+        return serializeJson(doc, out, size);
+    }
+
+public:
+    explicit mqttPlantLink(PubSubClient& mqttClient) : client(mqttClient) {}
+
+    /**
+     * @brief Publish frames of a type on a topic
+     * @param topic Must stay valid, e.g. a global buffer
+     */
+    bool route(uint8_t type, const char* topic, plantLinkEncoder encoder, void* ctx = nullptr);
+
+    /** @brief Publish frames of a type as the full JSON of their schema */
+    template <typename S>
+    bool routeSchema(uint8_t type, const char* topic) {
+        return route(type, topic, schemaEncoder<S>);
+    }
+
+    const char* name() const override { return "MQTT"; }
+    bool available() override { return client.connected(); }
+    bool supports(uint8_t type) const override { return find(type) != nullptr; }
+    bool publish(const plantFrame& frame) override;
+};
+
+/**
+ * @class plantLinkSelector
+ * @brief Publishes each frame on the cheapest working backend
+ */
+class plantLinkSelector {
+private:
+    PlantLink* links[LINK_MAX_BACKENDS];
+    uint32_t probedAt[LINK_MAX_BACKENDS];
+    uint8_t count = 0;
+    PlantLink* lastLink = nullptr;
+
+public:
+    /** @brief Add a backend, cheapest first */
+    bool add(PlantLink& link);
+
+    /**
+     * @brief Publish on the first available, healthy backend that accepts it
+     * Falls back to an unhealthy backend if no healthy one is left.
+     * @return Backend that took the frame, nullptr if none did
+     */
+    PlantLink* publish(const plantFrame& frame);
+
+    /** @brief Backend of the last successful publish */
+    PlantLink* last() const { return lastLink; }
+
+    /** @brief Run every backend's loop() */
+    void loop();
+
+    uint8_t size() const { return count; }
+    PlantLink* at(uint8_t index) const { return index < count ? links[index] : nullptr; }
+};
+
+#endif // OMEGAPLANTLINK_H
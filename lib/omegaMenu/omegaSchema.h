@@ -0,0 +1,283 @@
+/**
+ * @file omegaSchema.h
+ * @brief Compile-time message schema for the plant data structures
+ *
+ * Every wire key and binary layout used between PotPal and PlantPal is
+ * described exactly once in this file. The field lists are expanded at
+ * compile time into straight-line JSON and binary encoders/decoders, so both
+ * devices always agree on the key names and byte order.
+ *
+ * Binary encoding is packed little-endian in declaration order, its size is
+ * known at compile time through Schema::binarySize.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGASCHEMA_H
+#define OMEGASCHEMA_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <omegaPlant.h>
+
+namespace omegaSchema {
+
+/**
+ * @brief Value codec for a single field type (JSON and binary)
+ */
+template <typename V>
+struct codec;
+
+template <>
+struct codec<uint8_t> {
+    static const size_t size = 1;
+
+    static void toJson(JsonObject obj, const char* key, const uint8_t& v) { obj[key] = v; }
+    static void fromJson(JsonVariantConst var, uint8_t& v) { v = var.as<uint8_t>(); }
+
+    static uint8_t* put(uint8_t* p, const uint8_t& v) { *p = v; return p + 1; }
+    static const uint8_t* get(const uint8_t* p, uint8_t& v) { v = *p; return p + 1; }
+};
+
+template <>
+struct codec<uint16_t> {
+    static const size_t size = 2;
+
+    static void toJson(JsonObject obj, const char* key, const uint16_t& v) { obj[key] = v; }
+    static void fromJson(JsonVariantConst var, uint16_t& v) { v = var.as<uint16_t>(); }
+
+    static uint8_t* put(uint8_t* p, const uint16_t& v) {
+        p[0] = v & 0xFF;
+        p[1] = v >> 8;
+        return p + 2;
+    }
+    static const uint8_t* get(const uint8_t* p, uint16_t& v) {
+        v = p[0] | (p[1] << 8);
+        return p + 2;
+    }
+};
+
+template <size_t N>
+struct codec<char[N]> {
+    static const size_t size = N;
+
+    static void toJson(JsonObject obj, const char* key, const char (&v)[N]) {
+        char terminated[N + 1];
+        memcpy(terminated, v, N);
+        terminated[N] = 0;
+        obj[key] = terminated; // Copied into the document
+    }
+    static void fromJson(JsonVariantConst var, char (&v)[N]) {
+        const char* str = var.as<const char*>();
+        if (!str) return;
+        memset(v, 0, N);
+        strncpy(v, str, N - 1);
+    }
+
+    static uint8_t* put(uint8_t* p, const char (&v)[N]) { memcpy(p, v, N); return p + N; }
+    static const uint8_t* get(const uint8_t* p, char (&v)[N]) { memcpy(v, p, N); return p + N; }
+};
+
+/**
+ * @brief Expands a list of field descriptors into encoders and decoders
+ *
+ * Each step of the recursion handles exactly one field, the compiler
+ * flattens the chain into one specialised writer per message type.
+ * Index is the position of the first field, it selects the field's bit in
+ * the masks used for partial (delta) messages.
+ */
+template <uint8_t Index, typename... Fields>
+struct fieldList;
+
+template <uint8_t Index>
+struct fieldList<Index> {
+    static const size_t binarySize = 0;
+
+    template <typename T> static void toJson(JsonObject, const T&, uint32_t) {}
+    template <typename T> static uint32_t fromJson(JsonObjectConst, T&) { return 0; }
+    template <typename T> static uint8_t* toBinary(uint8_t* p, const T&) { return p; }
+    template <typename T> static const uint8_t* fromBinary(const uint8_t* p, T&) { return p; }
+};
+
+template <uint8_t Index, typename F, typename... Rest>
+struct fieldList<Index, F, Rest...> {
+    typedef codec<typename F::type> fieldCodec;
+    typedef fieldList<Index + 1, Rest...> next;
+    static const uint32_t bit = 1UL << Index;
+    static const size_t binarySize = fieldCodec::size + next::binarySize;
+
+    template <typename T>
+    static void toJson(JsonObject obj, const T& o, uint32_t mask) {
+        if (mask & bit) fieldCodec::toJson(obj, F::key(), F::ref(o));
+        next::toJson(obj, o, mask);
+    }
+
+    template <typename T>
+    static uint32_t fromJson(JsonObjectConst obj, T& o) {
+        uint32_t found = 0;
+        JsonVariantConst var = obj[F::key()];
+        if (!var.isNull()) {
+            fieldCodec::fromJson(var, F::ref(o));
+            found = bit;
+        }
+        return found | next::fromJson(obj, o);
+    }
+
+    template <typename T>
+    static uint8_t* toBinary(uint8_t* p, const T& o) {
+        return next::toBinary(fieldCodec::put(p, F::ref(o)), o);
+    }
+
+    template <typename T>
+    static const uint8_t* fromBinary(const uint8_t* p, T& o) {
+        return next::fromBinary(fieldCodec::get(p, F::ref(o)), o);
+    }
+};
+
+/**
+ * @brief Position of field F in a field list
+ */
+template <typename F, typename... Fields>
+struct indexOf;
+
+template <typename F, typename... Rest>
+struct indexOf<F, F, Rest...> {
+    static const uint8_t value = 0;
+};
+
+template <typename F, typename G, typename... Rest>
+struct indexOf<F, G, Rest...> {
+    static const uint8_t value = 1 + indexOf<F, Rest...>::value;
+};
+
+/**
+ * @brief Schema of a message type T built from its field descriptors
+ */
+template <typename T, typename... Fields>
+struct Schema {
+    typedef T type;
+    typedef fieldList<0, Fields...> fields;
+
+    static const size_t fieldCount = sizeof...(Fields);
+    static const size_t binarySize = fields::binarySize;
+    static const uint32_t allFields = (fieldCount >= 32) ? 0xFFFFFFFFUL : ((1UL << fieldCount) - 1);
+
+    /** Mask bit of field F, used to build partial messages */
+    template <typename F>
+    struct bit {
+        static const uint32_t value = 1UL << indexOf<F, Fields...>::value;
+    };
+
+    /** Write the fields of o selected by mask into obj */
+    static void toJson(JsonObject obj, const T& o, uint32_t mask = allFields) { fields::toJson(obj, o, mask); }
+
+    /** Read the fields present in obj into o, returns the mask of fields read */
+    static uint32_t fromJson(JsonObjectConst obj, T& o) { return fields::fromJson(obj, o); }
+
+    /** Serialize o into buf, returns bytes written or 0 if buf is too small */
+    static size_t toBinary(uint8_t* buf, size_t len, const T& o) {
+        if (len < binarySize) return 0;
+        fields::toBinary(buf, o);
+        return binarySize;
+    }
+
+    /** Deserialize o from buf, returns false if buf is too short */
+    static bool fromBinary(const uint8_t* buf, size_t len, T& o) {
+        if (len < binarySize) return false;
+        fields::fromBinary(buf, o);
+        return true;
+    }
+};
+
+} // namespace omegaSchema
+
+/**
+ * @brief Declare a schema field
+ * @param Owner Struct the field belongs to
+ * @param Name Name of the generated descriptor type
+ * @param Key Wire key used in JSON messages
+ * @param Member Member expression, may reach into nested structs
+ */
+#define OMEGA_FIELD(Owner, Name, Key, Member)                                  \
+    struct Name {                                                              \
+        typedef decltype(((Owner*)nullptr)->Member) type;                     \
+        static const char* key() { return Key; }                               \
+        static type& ref(Owner& o) { return o.Member; }                        \
+        static const type& ref(const Owner& o) { return o.Member; }            \
+    }
+
+namespace omegaSchema {
+
+/** sensorData */
+OMEGA_FIELD(sensorData, sdLight, "light", lightIntensity);
+OMEGA_FIELD(sensorData, sdTemp, "tempc", temperature);
+OMEGA_FIELD(sensorData, sdHum, "hum", humidity);
+OMEGA_FIELD(sensorData, sdSoil, "soilm", moisture);
+
+/** plantState, the sensor message published by every PotPal */
+OMEGA_FIELD(plantState, psID, "id", plantID);
+OMEGA_FIELD(plantState, psLight, "light", curData.lightIntensity);
+OMEGA_FIELD(plantState, psTemp, "tempc", curData.temperature);
+OMEGA_FIELD(plantState, psHum, "hum", curData.humidity);
+OMEGA_FIELD(plantState, psSoil, "soilm", curData.moisture);
+OMEGA_FIELD(plantState, psMood, "mood", curMood);
+OMEGA_FIELD(plantState, psXP, "xp", curXP);
+OMEGA_FIELD(plantState, psRcmnd, "rcmnd", curEmotion);
+
+/** PlantProfile, the config message */
+OMEGA_FIELD(PlantProfile, ppName, "name", name);
+OMEGA_FIELD(PlantProfile, ppTemp, "tempc", tempc);
+OMEGA_FIELD(PlantProfile, ppHum, "hum", hum);
+OMEGA_FIELD(PlantProfile, ppSoil, "soil_moisture", soil_moisture);
+OMEGA_FIELD(PlantProfile, ppLight, "light", light);
+OMEGA_FIELD(PlantProfile, ppRangeTemp, "range_temp", range_temp);
+OMEGA_FIELD(PlantProfile, ppRangeHum, "range_hum", range_hum);
+OMEGA_FIELD(PlantProfile, ppRangeLight, "range_light", range_light);
+OMEGA_FIELD(PlantProfile, ppRangeSoil, "range_soil_moisture", range_soil_moisture);
+
+/** PlantSaveData, the state message sent on level up */
+OMEGA_FIELD(PlantSaveData, svID, "id", plantID);
+OMEGA_FIELD(PlantSaveData, svXP, "xp", savedExp);
+OMEGA_FIELD(PlantSaveData, svLevel, "level", savedLvL);
+OMEGA_FIELD(PlantSaveData, svItems, "items", unlockedItems);
+OMEGA_FIELD(PlantSaveData, svBg, "bg", unlockedBg);
+OMEGA_FIELD(PlantSaveData, svAvatar, "avatar", unlockedAvatar);
+OMEGA_FIELD(PlantSaveData, svName, "name", savedProfile.name);
+OMEGA_FIELD(PlantSaveData, svTemp, "tempc", savedProfile.tempc);
+OMEGA_FIELD(PlantSaveData, svHum, "hum", savedProfile.hum);
+OMEGA_FIELD(PlantSaveData, svSoil, "soil_moisture", savedProfile.soil_moisture);
+OMEGA_FIELD(PlantSaveData, svLight, "light", savedProfile.light);
+OMEGA_FIELD(PlantSaveData, svRangeTemp, "range_temp", savedProfile.range_temp);
+OMEGA_FIELD(PlantSaveData, svRangeHum, "range_hum", savedProfile.range_hum);
+OMEGA_FIELD(PlantSaveData, svRangeLight, "range_light", savedProfile.range_light);
+OMEGA_FIELD(PlantSaveData, svRangeSoil, "range_soil_moisture", savedProfile.range_soil_moisture);
+
+} // namespace omegaSchema
+
+typedef omegaSchema::Schema<sensorData,
+    omegaSchema::sdLight, omegaSchema::sdTemp, omegaSchema::sdHum, omegaSchema::sdSoil
+> sensorDataSchema;
+
+typedef omegaSchema::Schema<plantState,
+    omegaSchema::psID, omegaSchema::psLight, omegaSchema::psTemp, omegaSchema::psHum,
+    omegaSchema::psSoil, omegaSchema::psMood, omegaSchema::psXP, omegaSchema::psRcmnd
+> plantStateSchema;
+
+typedef omegaSchema::Schema<PlantProfile,
+    omegaSchema::ppName, omegaSchema::ppTemp, omegaSchema::ppHum, omegaSchema::ppSoil,
+    omegaSchema::ppLight, omegaSchema::ppRangeTemp, omegaSchema::ppRangeHum,
+    omegaSchema::ppRangeLight, omegaSchema::ppRangeSoil
+> PlantProfileSchema;
+
+typedef omegaSchema::Schema<PlantSaveData,
+    omegaSchema::svID, omegaSchema::svXP, omegaSchema::svLevel, omegaSchema::svItems,
+    omegaSchema::svBg, omegaSchema::svAvatar, omegaSchema::svName, omegaSchema::svTemp,
+    omegaSchema::svHum, omegaSchema::svSoil, omegaSchema::svLight, omegaSchema::svRangeTemp,
+    omegaSchema::svRangeHum, omegaSchema::svRangeLight, omegaSchema::svRangeSoil
+> PlantSaveDataSchema;
+
+#endif // OMEGASCHEMA_H
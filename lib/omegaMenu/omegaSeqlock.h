@@ -0,0 +1,88 @@
+/**
+ * @file omegaSeqlock.h
+ * @brief Lock-free snapshot of a value shared between two tasks
+ *
+ * One task publishes complete values, any number of readers take consistent
+ * copies without a mutex. The writer bumps a sequence counter to odd before
+ * and back to even after copying, readers retry when the counter was odd or
+ * changed while they copied.
+ *
+ * The writer never waits. Readers only retry when a write overlapped their
+ * copy, so the writer must not be preempted by a reader on the same core:
+ * give the writing task the same or a higher priority (Wifi_Task runs at 5,
+ * Display_Task at 2).
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGASEQLOCK_H
+#define OMEGASEQLOCK_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <type_traits>
+
+/**
+ * @class omegaSeqlock
+ * @brief Single-writer sequence lock around a trivially copyable value
+ */
+template <typename T>
+class omegaSeqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "omegaSeqlock needs a plain struct");
+
+private:
+    std::atomic<uint32_t> seq;
+    T value;
+
+public:
+    omegaSeqlock() : seq(0), value() {}
+
+    /**
+     * @brief Publish a complete value, only one task may write
+     * @param v New value
+     */
+    void write(const T& v) {
+        uint32_t s = seq.load(std::memory_order_relaxed);
+        seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&value, &v, sizeof(T));
+        seq.store(s + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Try to copy the value once
+     * @param out Receives the value, undefined if false is returned
+     * @return False if a write overlapped the copy
+     */
+    bool tryRead(T& out) const {
+        uint32_t before = seq.load(std::memory_order_acquire);
+        if (before & 1) return false;
+        memcpy(&out, &value, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seq.load(std::memory_order_relaxed) == before;
+    }
+
+    /**
+     * @brief Copy the value, retrying until the copy is consistent
+     * @param out Receives the value
+     */
+    void read(T& out) const {
+        while (!tryRead(out)) {
+        }
+    }
+
+    T read() const {
+        T out;
+        read(out);
+        return out;
+    }
+
+    /** @brief Even number that changes with every write, lets readers skip redraws */
+    uint32_t version() const { return seq.load(std::memory_order_acquire) & ~1UL; }
+};
+
+#endif // OMEGASEQLOCK_H
@@ -14,6 +14,9 @@
 // Definiere den Radius, in dem die Icons angezeigt werden sollen
 #define ICON_RADIUS (SCREEN_WIDTH / 2 - 30) // Abstand vom Rand
 
+// Bereiche, die ein Animationsschritt zeichnet und der nächste wieder löscht
+#define MENU_DIRTY_RECTS 8
+
 
 
 enum menuType
@@ -36,6 +39,10 @@ public:
     static TFT_eSprite * accsrySprite ;
     bool forceDraw = true;
 
+    // drawSubMenu clears only the icons and the name strip of its last step. Whatever
+    // else draws on menuSprite must call this (or set forceDraw) before the menu is drawn again
+    static void invalidateMenu(){dirtyCount = -1;}
+
     typedef bool (*externalFunction)(TFT_eSPI *,TFT_eSprite *);
     typedef std::vector<omegaTFT>(*extMenu)(void);
 private:
@@ -49,7 +56,7 @@ private:
     omegaTFT * lastMenu = nullptr;
     omegaTFT * currentMenu;
     uint8_t subMenuCount;
-    const  uint16_t * icon;
+    const omegaPackedImage * icon;
     uint8_t selectedItem = 0;
     uint8_t dataValue = 0;
     uint8_t maxMenuItems =5;
@@ -58,6 +65,11 @@ private:
     externalFunction function;
     extMenu extMenuFunction;
 
+    // Areas of menuSprite the last drawSubMenu step drew, shared by all menus
+    static int16_t dirtyRects[MENU_DIRTY_RECTS][4];
+    static int8_t dirtyCount; // -1: clear the whole sprite
+    static omegaTFT* drawnBy;
+
 public:
 
     omegaTFT(menuType myType, const char * myName,externalFunction myFunction = nullptr) : 
@@ -72,13 +84,13 @@ public:
     dataValue(myData)
     {setDefaultIcons();}
 
-    omegaTFT(menuType myType, const char * myName, const  uint16_t* myIcon, externalFunction myFunction = nullptr) : 
+    omegaTFT(menuType myType, const char * myName, const omegaPackedImage* myIcon, externalFunction myFunction = nullptr) : 
     type(myType),
     name(myName), 
     icon(myIcon),
     function(myFunction){}
 
-    omegaTFT(menuType myType, const char * myName, const  uint16_t* myIcon,    extMenu funcSubMenu ) : 
+    omegaTFT(menuType myType, const char * myName, const omegaPackedImage* myIcon,    extMenu funcSubMenu ) : 
     type(myType),
     name(myName), 
     icon(myIcon),
@@ -86,13 +98,13 @@ public:
 
  
 
-    omegaTFT(menuType myType, const char * myName, const  uint16_t* myIcon, uint8_t & myData) :
+    omegaTFT(menuType myType, const char * myName, const omegaPackedImage* myIcon, uint8_t & myData) :
     type(myType),
     name(myName), 
     icon(myIcon),
     dataValue(myData){}
 
-    omegaTFT(menuType myType, char * myName,const  uint16_t* myIcon, omegaTFT* myMenus, uint8_t myCount) : 
+    omegaTFT(menuType myType, char * myName,const omegaPackedImage* myIcon, omegaTFT* myMenus, uint8_t myCount) : 
     type(myType),
     name(myName),
     icon(myIcon), 
@@ -126,14 +138,14 @@ public:
     void setDefaultIcons()
     {
         if(!icon){
-            if(type == EXIT) icon = icon_cross;    
-            if(type == EMPTY) icon = icon_question;
-            if(type == VALUE) icon = icon_numeric;
-            if(type == FUNCTION) icon = icon_function;
+            if(type == EXIT) icon = &icon_cross;    
+            if(type == EMPTY) icon = &icon_question;
+            if(type == VALUE) icon = &icon_numeric;
+            if(type == FUNCTION) icon = &icon_function;
         }
     }
     
-    const uint16_t *getIcon(){return icon;}
+    const omegaPackedImage *getIcon(){return icon;}
 
     void activateMenu()
     {
@@ -226,6 +238,7 @@ public:
             selectedItem =0;
             lastMenu->forceDraw= true;
             lastMenu=nullptr;
+            invalidateMenu();
             return;
         }
     }
@@ -242,6 +255,11 @@ public:
 
         static int oldIndex=0;
         if(oldIndex==selectedItem && !forceDraw)return;
+
+        // Only the icons and the name strip of the last step are cleared, unless the
+        // sprite was drawn by another menu in between, see invalidateMenu()
+        if(forceDraw || drawnBy != this) dirtyCount = -1;
+        drawnBy = this;
         forceDraw = false;
         //
         int currentX[subMenuCount];
@@ -287,7 +305,10 @@ public:
         for (int step = 1; step <= steps; step++) {
             // Lösche den Bildschirm
 
-            menuSprite->fillScreen(TFT_BLACK);
+            if(dirtyCount < 0) menuSprite->fillScreen(TFT_BLACK);
+            else for(int8_t d = 0; d < dirtyCount; d++)
+                menuSprite->fillRect(dirtyRects[d][0], dirtyRects[d][1], dirtyRects[d][2], dirtyRects[d][3], TFT_BLACK);
+            dirtyCount = 0;
 
             //menuSprite->pushImage(30-15*(step/steps),105,32,32,icon_diamond_with_a_dot_1f4a0, TFT_BLACK);
             
@@ -325,15 +346,22 @@ public:
             
             
             
-            // Zeichne das Icon an seiner interpolierten Position
-            menuSprite->setSwapBytes(1);
+            // Zeichne das Icon an seiner interpolierten Position, die Paletten sind schon in Sprite-Byte-Reihenfolge
             
 
-            if(newAngle<radians(180)+radians(90) && newAngle>radians(180)-radians(90) && x<SCREEN_WIDTH/2)
-                menuSprite->pushImage(x, y, ICON_SIZE, ICON_SIZE, subMenus[i].getIcon());
+            if(newAngle<radians(180)+radians(90) && newAngle>radians(180)-radians(90) && x<SCREEN_WIDTH/2 && subMenus[i].getIcon())
+            {
+                const omegaPackedImage* img = subMenus[i].getIcon();
+                pushPackedImage(menuSprite, x, y, *img);
+                if(dirtyCount >= 0 && dirtyCount < MENU_DIRTY_RECTS - 1)
+                {
+                    int16_t* d = dirtyRects[dirtyCount++];
+                    d[0] = x; d[1] = y; d[2] = img->width; d[3] = img->height;
+                }
+                else dirtyCount = -1;
+            }
             }
             
-            menuSprite->setSwapBytes(1);
             //menuSprite->pushImage(30-10*(step/steps),105,32,32,icon_diamond);
         //Serial.println("Before Push!");
         /*
@@ -354,6 +382,14 @@ public:
                 menuSprite->print(subMenus[selectedItem].getValue());
                 
             }
+
+            // Name and value strip, a wrapped name leaves the whole sprite dirty
+            if(dirtyCount >= 0 && menuSprite->getCursorY() == 110)
+            {
+                int16_t* d = dirtyRects[dirtyCount++];
+                d[0] = selectedIndent+ICON_SIZE+16; d[1] = 110; d[2] = SCREEN_WIDTH - d[0]; d[3] = menuSprite->fontHeight();
+            }
+            else dirtyCount = -1;
            
             //enuSprite->drawFastHLine(55,132,30-random(15),TFT_WHITE);
             //menuSprite->drawSmoothArc(SCREEN_WIDTH/2,SCREEN_HEIGHT/2,120,116,20,160,TFT_DARKCYAN,TFT_TRANSPARENT, true);
@@ -490,5 +526,8 @@ TFT_eSPI * omegaTFT::tft = nullptr;
 TFT_eSprite * omegaTFT::menuSprite =nullptr;
 TFT_eSprite * omegaTFT::valueSprite =nullptr;
 TFT_eSprite * omegaTFT::accsrySprite =nullptr;
+int16_t omegaTFT::dirtyRects[MENU_DIRTY_RECTS][4];
+int8_t omegaTFT::dirtyCount = -1;
+omegaTFT* omegaTFT::drawnBy = nullptr;
 
 #endif
\ No newline at end of file
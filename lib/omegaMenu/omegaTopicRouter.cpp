@@ -0,0 +1,122 @@
+#include "omegaTopicRouter.h"
+
+bool omegaTopicMatch::wildcardToID(uint8_t index, uint16_t& id) const {
+    if (index >= wildcardCount || wildcardLen[index] == 0 || wildcardLen[index] > 4) return false;
+
+    uint16_t value = 0;
+    for (uint8_t i = 0; i < wildcardLen[index]; i++) {
+        char c = wildcard[index][i];
+        value <<= 4;
+        if (c >= '0' && c <= '9') value |= c - '0';
+        else if (c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+        else if (c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+        else return false;
+    }
+    id = value;
+    return true;
+}
+
+omegaTopicRouter::omegaTopicRouter() : nodeCount(1) {
+    // Node 0 is the root, it has no label
+    nodes[0].labelLen = 0;
+    nodes[0].firstChild = NO_NODE;
+    nodes[0].nextSibling = NO_NODE;
+    nodes[0].handler = nullptr;
+    nodes[0].ctx = nullptr;
+}
+
+uint8_t omegaTopicRouter::findChild(uint8_t parent, const char* label, uint8_t len) const {
+    for (uint8_t i = nodes[parent].firstChild; i != NO_NODE; i = nodes[i].nextSibling) {
+        if (nodes[i].labelLen == len && memcmp(nodes[i].label, label, len) == 0) return i;
+    }
+    return NO_NODE;
+}
+
+uint8_t omegaTopicRouter::addChild(uint8_t parent, const char* label, uint8_t len) {
+    if (nodeCount >= TOPIC_MAX_NODES) return NO_NODE;
+
+    node& n = nodes[nodeCount];
+    memcpy(n.label, label, len);
+    n.labelLen = len;
+    n.firstChild = NO_NODE;
+    n.nextSibling = nodes[parent].firstChild;
+    n.handler = nullptr;
+    n.ctx = nullptr;
+    nodes[parent].firstChild = nodeCount;
+    return nodeCount++;
+}
+
+bool omegaTopicRouter::subscribe(const char* filter, topicHandler handler, void* ctx) {
+    uint8_t current = 0;
+    const char* level = filter;
+
+    while (true) {
+        const char* end = strchr(level, '/');
+        size_t len = end ? (size_t)(end - level) : strlen(level);
+        if (len >= TOPIC_MAX_LEVEL_LEN) return false;
+        if (len == 1 && level[0] == '#' && end) return false; // # must be the last level
+
+        uint8_t child = findChild(current, level, len);
+        if (child == NO_NODE) child = addChild(current, level, len);
+        if (child == NO_NODE) return false;
+        current = child;
+
+        if (!end) break;
+        level = end + 1;
+    }
+
+    nodes[current].handler = handler;
+    nodes[current].ctx = ctx;
+    return true;
+}
+
+uint8_t omegaTopicRouter::invoke(const node& n, const omegaTopicMatch& m, const uint8_t* payload, unsigned int length) {
+    if (!n.handler) return 0;
+    n.handler(m, payload, length, n.ctx);
+    return 1;
+}
+
+uint8_t omegaTopicRouter::match(uint8_t parent, const char* level, omegaTopicMatch& m,
+                                const uint8_t* payload, unsigned int length) const {
+    const char* end = strchr(level, '/');
+    size_t len = end ? (size_t)(end - level) : strlen(level);
+    uint8_t invoked = 0;
+
+    for (uint8_t i = nodes[parent].firstChild; i != NO_NODE; i = nodes[i].nextSibling) {
+        const node& n = nodes[i];
+        bool isPlus = n.labelLen == 1 && n.label[0] == '+';
+        bool isHash = n.labelLen == 1 && n.label[0] == '#';
+
+        if (isHash) {
+            invoked += invoke(n, m, payload, length);
+            continue;
+        }
+
+        if (!isPlus && (n.labelLen != len || memcmp(n.label, level, len) != 0)) continue;
+
+        uint8_t captured = m.wildcardCount;
+        if (isPlus && captured < TOPIC_MAX_WILDCARDS) {
+            m.wildcard[captured] = level;
+            m.wildcardLen[captured] = len < 0xFF ? len : 0xFF;
+            m.wildcardCount++;
+        }
+
+        if (end) {
+            invoked += match(i, end + 1, m, payload, length);
+        } else {
+            invoked += invoke(n, m, payload, length);
+            // "a/#" also matches "a"
+            for (uint8_t c = n.firstChild; c != NO_NODE; c = nodes[c].nextSibling) {
+                if (nodes[c].labelLen == 1 && nodes[c].label[0] == '#') invoked += invoke(nodes[c], m, payload, length);
+            }
+        }
+
+        m.wildcardCount = captured;
+    }
+    return invoked;
+}
+
+uint8_t omegaTopicRouter::dispatch(const char* topic, const uint8_t* payload, unsigned int length) const {
+    omegaTopicMatch m;
+    return match(0, topic, m, payload, length);
+}
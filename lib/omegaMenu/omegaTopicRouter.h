@@ -0,0 +1,100 @@
+/**
+ * @file omegaTopicRouter.h
+ * @brief MQTT topic trie with + and # wildcard subscriptions
+ *
+ * Subscriptions are stored level by level in a fixed node pool. Incoming
+ * topics are matched in a single walk over the topic string without any
+ * String or heap allocation, the segments matched by + wildcards are handed
+ * to the handler as pointer/length pairs.
+ *
+ * @author
+ *  - Nico Grümmert
+ *
+ *
+ * @date 2024-07-14
+ */
+
+#ifndef OMEGATOPICROUTER_H
+#define OMEGATOPICROUTER_H
+
+#include <Arduino.h>
+
+/** Settings */
+#define TOPIC_MAX_NODES 24     // Trie nodes shared by all subscriptions
+#define TOPIC_MAX_LEVEL_LEN 16 // Max characters of one topic level
+#define TOPIC_MAX_WILDCARDS 4  // Max + wildcards in one subscription
+/** End Settings */
+
+/** Per-device topics, e.g. plantpal/5001/sensor */
+#define TOPIC_PLANT_FORMAT "plantpal/%04X/%s"
+#define TOPIC_PLANT_LEN 32
+
+/**
+ * @struct omegaTopicMatch
+ * @brief Segments of a topic matched by + wildcards
+ */
+struct omegaTopicMatch {
+    const char* wildcard[TOPIC_MAX_WILDCARDS];
+    uint8_t wildcardLen[TOPIC_MAX_WILDCARDS];
+    uint8_t wildcardCount = 0;
+
+    /**
+     * @brief Parse a wildcard segment as hexadecimal device id
+     * @param index Wildcard index in the subscription
+     * @param id Parsed id
+     * @return True if the segment is a valid 1-4 digit hex number
+     */
+    bool wildcardToID(uint8_t index, uint16_t& id) const;
+};
+
+typedef void (*topicHandler)(const omegaTopicMatch& match, const uint8_t* payload, unsigned int length, void* ctx);
+
+/**
+ * @class omegaTopicRouter
+ * @brief Dispatches MQTT messages to the handlers of matching subscriptions
+ */
+class omegaTopicRouter {
+private:
+    struct node {
+        char label[TOPIC_MAX_LEVEL_LEN];
+        uint8_t labelLen;
+        uint8_t firstChild;
+        uint8_t nextSibling;
+        topicHandler handler;
+        void* ctx;
+    };
+
+    static const uint8_t NO_NODE = 0xFF;
+
+    node nodes[TOPIC_MAX_NODES];
+    uint8_t nodeCount;
+
+    uint8_t findChild(uint8_t parent, const char* label, uint8_t len) const;
+    uint8_t addChild(uint8_t parent, const char* label, uint8_t len);
+    uint8_t match(uint8_t parent, const char* level, omegaTopicMatch& m,
+                  const uint8_t* payload, unsigned int length) const;
+    static uint8_t invoke(const node& n, const omegaTopicMatch& m, const uint8_t* payload, unsigned int length);
+
+public:
+    omegaTopicRouter();
+
+    /**
+     * @brief Register a handler for a topic filter
+     * @param filter MQTT topic filter, may contain + and a trailing #
+     * @param handler Function called for every matching message
+     * @param ctx User pointer passed to the handler
+     * @return True if the filter fits into the node pool
+     */
+    bool subscribe(const char* filter, topicHandler handler, void* ctx = nullptr);
+
+    /**
+     * @brief Route a message to all matching handlers
+     * @param topic Topic the message arrived on
+     * @param payload Message payload
+     * @param length Payload length
+     * @return Number of handlers invoked
+     */
+    uint8_t dispatch(const char* topic, const uint8_t* payload, unsigned int length) const;
+};
+
+#endif // OMEGATOPICROUTER_H
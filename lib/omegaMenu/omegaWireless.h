@@ -69,12 +69,13 @@ public:
   omegaWireless(char *);
   ~omegaWireless();
 
+  // Runs in the WiFi task, must not block
   static void receiveCallback(const uint8_t *macAddr, const uint8_t *data, int dataLen)
   {
 
     char buffer[ESP_NOW_MAX_DATA_LEN + 1];
     int msgLen = min(ESP_NOW_MAX_DATA_LEN, dataLen);
-    strncpy(buffer, (const char *)data, msgLen);
+    memcpy(buffer, data, msgLen);
     buffer[msgLen] = 0;
     onMessageReceived(buffer);
   }
@@ -87,10 +88,8 @@ public:
   static void onMessageReceived(const char *message)
   {
     if(message[0]%5 == 0 ){
-    // Handle the received message
-    digitalWrite(15, 1);
-    delay(50);
-    digitalWrite(15, 0);
+    // Handle the received message, toggle instead of blinking with a delay
+    digitalWrite(15, !digitalRead(15));
     }
   }
 
@@ -196,21 +195,24 @@ void omegaWireless::initESPNOW(bool addClients)
     esp_now_register_send_cb(sentCallback);
     if (addClients)
     {
-      esp_now_del_peer(lastClients[0].mac);
-
-      esp_now_peer_info_t peerInfo;
-      memset(&peerInfo, 0, sizeof(peerInfo));
-      peerInfo.channel = 0;     // Set the channel (0 for auto)
-      peerInfo.encrypt = false; // No encryption
-      // Replace this MAC address with the sender's MAC address
-      Serial.println("Adding: ");
-      Serial.println(lastClients[0].mac[5]);
-      memcpy(peerInfo.peer_addr, lastClients[0].mac, 6);
-
-      // Add peer
-      if (esp_now_add_peer(&peerInfo) != ESP_OK)
+      // Every device that was connected to the AP, not only the first one
+      for (const MacAddress &client : lastClients)
       {
-        Serial.println("Failed to add peer");
+        esp_now_del_peer(client.mac);
+
+        esp_now_peer_info_t peerInfo;
+        memset(&peerInfo, 0, sizeof(peerInfo));
+        peerInfo.channel = 0;     // Set the channel (0 for auto)
+        peerInfo.encrypt = false; // No encryption
+        Serial.println("Adding: ");
+        Serial.println(client.mac[5]);
+        memcpy(peerInfo.peer_addr, client.mac, 6);
+
+        // Add peer
+        if (esp_now_add_peer(&peerInfo) != ESP_OK)
+        {
+          Serial.println("Failed to add peer");
+        }
       }
     }
   }
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+Pack icons and VLW fonts into an asset partition image for omegaAssets.h.
+
+Images are read from image2cpp headers like assets/omegaIcons.h and stored
+in the omegaImage.h palette + RLE format (see omegaPackIcons.py). Fonts are
+either .vlw files or headers with a `const uint8_t Name[] PROGMEM = {...}`
+array. Every asset is looked up by its C name, e.g. "icon_cactus1" or
+"NotoSansBold15".
+
+Layout, little endian:
+    header  magic "OAP1", u16 version, u16 count, u32 size
+    table   count entries of 52 bytes, sorted by name:
+            char name[32], u8 type, u8 bits, u8 transparent, u8 flags,
+            u16 width, u16 height, u16 colors, u16 0, u32 offset, u32 size
+    data    every entry 4-byte aligned
+
+Image palettes are byte swapped (flags PACKED_SWAPPED) unless --no-swap
+is given, like the arrays of omegaPackIcons.py.
+
+Usage:
+    python3 tools/omegaAssetPack.py --images assets/omegaIcons.h \\
+        --font lib/omegaMenu/NotoSansBold15.h --font lib/omegaMenu/NotoSansMonoSCB20.h \\
+        -o assets.bin
+    parttool.py write_partition --partition-name assets --input assets.bin
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from omegaPackIcons import PACKED_SWAPPED, parse_images, pack_image, swap_bytes  # noqa: E402
+
+ASSET_MAGIC = b"OAP1"
+ASSET_VERSION = 1
+ASSET_NAME_LEN = 32
+ASSET_IMAGE = 1
+ASSET_FONT = 2
+
+HEADER = struct.Struct("<4sHHI")
+ENTRY = struct.Struct("<32sBBBBHHHHII")
+
+FONT_RE = re.compile(r"const\s+uint8_t\s+(\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", re.S)
+
+
+def read_fonts(path):
+    """Yield (name, bytes) for a .vlw file or every byte array in a header."""
+    if path.lower().endswith(".vlw"):
+        with open(path, "rb") as f:
+            yield os.path.splitext(os.path.basename(path))[0], f.read()
+        return
+    with open(path) as f:
+        # The TFT_eSPI font headers show an example array in a comment
+        text = re.sub(r"/\*.*?\*/", "", f.read(), flags=re.S)
+    for m in FONT_RE.finditer(text):
+        yield m.group(1), bytes(int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", m.group(2)))
+
+
+def build(assets):
+    """assets: list of (name, type, bits, transparent, flags, width, height, colors, blob)."""
+    assets = sorted(assets, key=lambda a: a[0].encode())
+    for a, b in zip(assets, assets[1:]):
+        if a[0] == b[0]:
+            sys.exit("%s: duplicate asset name" % a[0])
+
+    offset = HEADER.size + ENTRY.size * len(assets)
+    table = b""
+    data = b""
+    for name, kind, bits, trans, flags, w, h, colors, blob in assets:
+        raw = name.encode()
+        if len(raw) >= ASSET_NAME_LEN:
+            sys.exit("%s: name longer than %d characters" % (name, ASSET_NAME_LEN - 1))
+        pad = (-(offset + len(data))) % 4
+        data += b"\0" * pad
+        table += ENTRY.pack(raw, kind, bits, trans, flags, w, h, colors, 0, offset + len(data), len(blob))
+        data += blob
+
+    size = offset + len(data)
+    return HEADER.pack(ASSET_MAGIC, ASSET_VERSION, len(assets), size) + table + data
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--images", action="append", default=[], help="image2cpp header with RGB565 arrays")
+    parser.add_argument("--font", action="append", default=[], help=".vlw file or header with a font array")
+    parser.add_argument("-o", "--output", required=True, help="partition image to write")
+    parser.add_argument("--transparent", default="0x0000", help="RGB565 colour that is not drawn")
+    parser.add_argument("--max-colors", type=int, default=256, help="palette size limit, at most 256")
+    parser.add_argument("--partition-size", type=lambda v: int(v, 0), help="fail if the pack does not fit")
+    parser.add_argument("--no-swap", action="store_true", help="palettes in RGB565 order instead of sprite order")
+    args = parser.parse_args()
+
+    transparent = int(args.transparent, 0)
+    max_colors = min(args.max_colors, 256)
+    flags = 0 if args.no_swap else PACKED_SWAPPED
+
+    assets = []
+    for path in args.images:
+        with open(path) as f:
+            text = f.read()
+        for _, w, h, name, pixels in parse_images(text):
+            palette, bits, trans, data = pack_image(w, h, pixels, transparent, max_colors)
+            if flags & PACKED_SWAPPED:
+                palette = swap_bytes(palette)
+            blob = struct.pack("<%dH" % len(palette), *palette) + bytes(data)
+            assets.append((name, ASSET_IMAGE, bits, trans, flags, w, h, len(palette), blob))
+    for path in args.font:
+        for name, blob in read_fonts(path):
+            assets.append((name, ASSET_FONT, 0, 0, 0, 0, 0, 0, blob))
+
+    image = build(assets)
+    if args.partition_size and len(image) > args.partition_size:
+        sys.exit("%s: %d bytes do not fit into 0x%x" % (args.output, len(image), args.partition_size))
+
+    with open(args.output, "wb") as f:
+        f.write(image)
+    print("%s: %d assets, %d bytes" % (args.output, len(assets), len(image)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""
+Convert RGB565 icon arrays into palette + RLE images for omegaImage.h.
+
+Input is a header as exported by image2cpp: every image is a
+    // 'name', WxHpx
+    const uint16_t icon_name [] PROGMEM = { 0x0000, ... };
+block. Pointer tables and other declarations in the input are ignored.
+
+Images with at most 16 colours get 4-bit indices, up to 256 colours 8-bit.
+Images with more colours are reduced by merging the rarest colour into its
+nearest neighbour until they fit. The transparent colour is never merged.
+
+Palettes are written byte swapped with the PACKED_SWAPPED flag, the order
+16-bit sprites store their pixels in, so blits copy them unchanged.
+--no-swap keeps them in RGB565 order.
+
+The header lists every image in OMEGA_PACKED_ICONS(X). The arrays are left
+out when OMEGA_ASSET_PACK is defined, the images then come from the asset
+partition (tools/omegaAssetPack.py).
+
+Usage:
+    python3 tools/omegaPackIcons.py assets/omegaIcons.h -o lib/omegaMenu/omegaPackedIcons.h
+"""
+
+import argparse
+import re
+import sys
+
+IMAGE_RE = re.compile(
+    r"//\s*'([^']+)',\s*(\d+)x(\d+)px\s*\n"
+    r"const\s+uint16_t\s+(\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};",
+    re.S)
+
+PACKED_RUN = 0x80
+PACKED_MAX = 128
+PACKED_OPAQUE = 0xFF
+PACKED_SWAPPED = 0x01
+
+
+def parse_images(text):
+    """Yield (label, width, height, name, pixels) for every image array."""
+    for m in IMAGE_RE.finditer(text):
+        label, w, h, name, body = m.groups()
+        pixels = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body)]
+        w, h = int(w), int(h)
+        if len(pixels) != w * h:
+            sys.exit("%s: %d pixels, expected %dx%d" % (name, len(pixels), w, h))
+        yield label, w, h, name, pixels
+
+
+def rgb(c):
+    return (c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F
+
+
+def distance(a, b):
+    ra, ga, ba = rgb(a)
+    rb, gb, bb = rgb(b)
+    # Green has twice the resolution, scale red and blue up to it
+    return (2 * (ra - rb)) ** 2 + (ga - gb) ** 2 + (2 * (ba - bb)) ** 2
+
+
+def reduce_colors(pixels, max_colors, transparent):
+    """Map rare colours onto their nearest neighbour until max_colors remain."""
+    counts = {}
+    for p in pixels:
+        counts[p] = counts.get(p, 0) + 1
+    mapping = {c: c for c in counts}
+
+    while len(counts) > max_colors:
+        rare = min((c for c in counts if c != transparent), key=lambda c: counts[c])
+        target = min((c for c in counts if c != rare and c != transparent),
+                     key=lambda c: distance(c, rare))
+        counts[target] += counts.pop(rare)
+        for c, m in mapping.items():
+            if m == rare:
+                mapping[c] = target
+
+    return [mapping[p] for p in pixels]
+
+
+def pack_indices(indices, bits):
+    if bits == 8:
+        return list(indices)
+    out = []
+    for i in range(0, len(indices), 2):
+        hi = indices[i]
+        lo = indices[i + 1] if i + 1 < len(indices) else 0
+        out.append((hi << 4) | lo)
+    return out
+
+
+def encode_row(row, bits):
+    """Runs of three or more equal indices, literals for the rest."""
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:PACKED_MAX]
+            del literal[:PACKED_MAX]
+            out.append(len(chunk) - 1)
+            out.extend(pack_indices(chunk, bits))
+
+    i = 0
+    while i < len(row):
+        j = i
+        while j < len(row) and row[j] == row[i] and j - i < PACKED_MAX:
+            j += 1
+        if j - i >= 3:
+            flush_literal()
+            out.append(PACKED_RUN | (j - i - 1))
+            out.append(row[i])
+        else:
+            literal.extend(row[i:j])
+        i = j
+    flush_literal()
+    return out
+
+
+def decode(data, w, h, bits):
+    """Reference decoder, checks the encoder."""
+    out = []
+    p = 0
+    for _ in range(h):
+        col = 0
+        while col < w:
+            header = data[p]
+            p += 1
+            count = (header & 0x7F) + 1
+            if header & PACKED_RUN:
+                out.extend([data[p]] * count)
+                p += 1
+            else:
+                for i in range(count):
+                    if bits == 4:
+                        b = data[p + (i >> 1)]
+                        out.append((b >> 4) if i % 2 == 0 else (b & 0x0F))
+                    else:
+                        out.append(data[p + i])
+                p += (count + 1) // 2 if bits == 4 else count
+            col += count
+    return out
+
+
+def pack_image(w, h, pixels, transparent, max_colors):
+    pixels = reduce_colors(pixels, max_colors, transparent)
+    # Most used colours first
+    counts = {}
+    for p in pixels:
+        counts[p] = counts.get(p, 0) + 1
+    palette = sorted(counts, key=lambda c: -counts[c])
+    index = {c: i for i, c in enumerate(palette)}
+    bits = 4 if len(palette) <= 16 else 8
+    indices = [index[p] for p in pixels]
+
+    data = []
+    for y in range(h):
+        data.extend(encode_row(indices[y * w:(y + 1) * w], bits))
+
+    assert decode(data, w, h, bits) == indices
+    return palette, bits, index.get(transparent, PACKED_OPAQUE), data
+
+
+def swap_bytes(palette):
+    """RGB565 to the byte order of 16-bit sprite pixels."""
+    return [((c >> 8) | (c << 8)) & 0xFFFF for c in palette]
+
+
+def c_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("\t" + ", ".join(fmt % v for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("input", help="image2cpp header with RGB565 arrays")
+    parser.add_argument("-o", "--output", required=True, help="header to write")
+    parser.add_argument("--transparent", default="0x0000", help="RGB565 colour that is not drawn")
+    parser.add_argument("--max-colors", type=int, default=256, help="palette size limit, at most 256")
+    parser.add_argument("--no-swap", action="store_true", help="palettes in RGB565 order instead of sprite order")
+    args = parser.parse_args()
+
+    transparent = int(args.transparent, 0)
+    max_colors = min(args.max_colors, 256)
+    flags = 0 if args.no_swap else PACKED_SWAPPED
+
+    with open(args.input) as f:
+        text = f.read()
+
+    images = list(parse_images(text))
+    out = [
+        "// Generated by tools/omegaPackIcons.py from %s, do not edit" % args.input.replace("\\", "/"),
+        "",
+        "#ifndef OMEGAPACKEDICONS_H",
+        "#define OMEGAPACKEDICONS_H",
+        "",
+        "#include <omegaImage.h>",
+        "",
+        "#define OMEGA_PACKED_ICONS(X) \\",
+    ]
+    out.extend("    X(%s) \\" % name for _, _, _, name, _ in images)
+    out.extend(["", "#ifndef OMEGA_ASSET_PACK", ""])
+
+    raw_total = packed_total = 0
+    for label, w, h, name, pixels in images:
+        palette, bits, trans, data = pack_image(w, h, pixels, transparent, max_colors)
+        if flags & PACKED_SWAPPED:
+            palette = swap_bytes(palette)
+        raw = w * h * 2
+        packed = len(palette) * 2 + len(data)
+        raw_total += raw
+        packed_total += packed
+
+        out.append("// '%s', %dx%dpx, %d colours, %d -> %d bytes" % (label, w, h, len(palette), raw, packed))
+        out.append("const uint16_t %s_palette[] PROGMEM = {\n%s\n};" % (name, c_array(palette, "0x%04x", 12)))
+        out.append("const uint8_t %s_data[] PROGMEM = {\n%s\n};" % (name, c_array(data, "0x%02x", 16)))
+        out.append("const omegaPackedImage %s = {%d, %d, %d, %d, 0x%02X, %s_palette, %s_data, 0x%02X};" %
+                   (name, w, h, len(palette), bits, trans, name, name, flags))
+        out.append("")
+
+    out.append("// Total: %d bytes raw, %d bytes packed" % (raw_total, packed_total))
+    out.append("")
+    out.append("#endif // OMEGA_ASSET_PACK")
+    out.append("")
+    out.append("#endif // OMEGAPACKEDICONS_H")
+    out.append("")
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(out))
+    print("%s: %d -> %d bytes" % (args.output, raw_total, packed_total))
+
+
+if __name__ == "__main__":
+    main()